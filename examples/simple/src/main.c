@@ -83,12 +83,18 @@ int32_t main(void)
 
 void _print_buffer(void)
 {
-    for (size_t i = 0; i < sizeof(buffer); i++)
+    int data[sizeof(buffer) / sizeof(int)];
+    size_t free_elements;
+
+    // Copy all stored elements at once, instead of peeking them one by one
+    RING_BUFFER_GetFreeElements(&rb, &free_elements);
+    size_t count = rb.max_elements - free_elements;
+
+    if (RING_BUFFER_STATUS_OK == RING_BUFFER_PeekRange(&rb, 0, count, data))
     {
-        int data;
-        if (RING_BUFFER_STATUS_OK == RING_BUFFER_Peek(&rb, i, &data))
+        for (size_t i = 0; i < count; i++)
         {
-            printf("Element at index %zu: %d\n", i, data);
+            printf("Element at index %zu: %d\n", i, data[i]);
         }
     }
 }
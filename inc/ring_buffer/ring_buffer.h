@@ -1,197 +1,726 @@
-/***********************************************************************************************************************
- *
- * @file        ring_buffer.h
- * @brief       The Component RING BUFFER provides an efficient circular buffer for handling data in a fixed-size memory
- *              structure. It ensures seamless storage and retrieval with minimal memory overhead, ideal for
- *              applications requiring high-performance, low-latency data management.
- *              - Using dynamic memory
- * @author      Blaz Baskovc
- * @copyright   Copyright 2025 Blaz Baskovc
- * @date        2025-03-12
- * @version     1.0.0
- *
- *  Author          Date        Version     Comments on that revision
- * ---------------------------------------------------------------------------------------------------------------------
- *  Blaz Baskovc    2025-03-12  1.0.0       First release.
- *
- **********************************************************************************************************************/
-
-#ifndef RING_BUFFER_H
-#define RING_BUFFER_H
-
-// C++ wrapper - Start
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-// --- Includes --------------------------------------------------------------------------------------------------------
-
-#include <stdbool.h>
-#include <stddef.h>
-
-#if __has_include("ring_buffer_conf.h")
-#include "ring_buffer_conf.h"
-#endif /* __has_include("ring_buffer_conf.h") */
-
-#include "ring_buffer/ring_buffer_gtypes.h"
-
-// --- Public Defines --------------------------------------------------------------------------------------------------
-
-/**
- * @brief   Component version.
- */
-#define RING_BUFFER_NAME    "RING-BUFFER" //< Component name as string.
-#define RING_BUFFER_VERSION (0x01000000U) //< Component version as uint32_t (major.minor.patch.fix).
-
-// --- Public Functions Prototypes -------------------------------------------------------------------------------------
-
-/**
- * @brief Initializes a ring buffer with the given configuration.
- *
- * This function initializes a ring buffer structure by allocating memory and setting the buffer size and other
- * configuration parameters. It must be called before using the ring buffer for reading or writing.
- *
- * @param[in] rb A pointer to the ring buffer structure to be initialized.
- * @param[in] conf The configuration structure containing parameters for the buffer.
- *
- * @return ring_buffer_status_e Status of the initialization:
- *         - RING_BUFFER_STATUS_OK: Successful initialization
- */
-ring_buffer_status_e RING_BUFFER_Init(ring_buffer_t *rb, ring_buffer_conf_t conf);
-
-/**
- * @brief Deinitialize a ring buffer and frees any allocated resources.
- *
- * This function deinitialize the ring buffer, releasing any resources associated with it and resetting its internal
- * state. After calling this function, the ring buffer is no longer usable unless reinitialized.
- *
- * @param[in] rb A pointer to the ring buffer structure to be deinitialize.
- *
- * @return ring_buffer_status_e Status of the deinitialization:
- *         - RING_BUFFER_STATUS_OK: Successful deinitialization
- */
-ring_buffer_status_e RING_BUFFER_DeInit(ring_buffer_t *rb);
-
-/**
- * @brief Inserts data into the ring buffer.
- *
- * This function inserts a data element into the ring buffer. If there is enough space in the buffer, the data is added;
- * otherwise, it may return an error indicating that the buffer is full.
- *
- * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
- * @param[in] data A pointer to the data to be inserted into the buffer.
- *
- * @return ring_buffer_status_e Status of the insertion:
- *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
- */
-ring_buffer_status_e RING_BUFFER_Insert(ring_buffer_t *rb, const void *data);
-
-/**
- * @brief Retrieves data from the ring buffer.
- *
- * This function retrieves a data element from the ring buffer. If data is available, it is copied into the provided
- * buffer. If the buffer is empty, it may return an error indicating that no data is available for retrieval.
- *
- * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
- * @param[out] data A pointer to the buffer where the retrieved data will be stored.
- *
- * @return ring_buffer_status_e Status of the retrieval:
- *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
- */
-ring_buffer_status_e RING_BUFFER_Retrieve(ring_buffer_t *rb, void *data);
-
-/**
- * @brief Peeks at data from the ring buffer without removing it.
- *
- * This function retrieves a data element from the ring buffer at the specified index without removing it from the
- * buffer. The buffer remains unchanged after the peek operation. If the index is out of range or if the buffer is
- * empty, it may return an error.
- *
- * @param[in] rb A pointer to the ring buffer structure from which data will be peeked.
- * @param[in] index The index of the data element to peek.
- * @param[out] data A pointer to the buffer where the peeked data will be stored.
- *
- * @return ring_buffer_status_e Status of the peek operation:
- *         - RING_BUFFER_STATUS_OK: Data successfully peeked from the buffer
- */
-ring_buffer_status_e RING_BUFFER_Peek(ring_buffer_t *rb, size_t index, void *data);
-
-/**
- * @brief Replaces a data element at the specified index in the ring buffer.
- *
- * This function replaces the data element at the given index with new data. The buffer is not altered in size, and the
- * existing data at that index is overwritten. If the index is out of range or if the buffer is empty, an error will be
- * returned.
- *
- * @param[in] rb A pointer to the ring buffer structure where the data will be replaced.
- * @param[in] index The index of the data element to replace.
- * @param[in] data A pointer to the new data that will replace the existing element.
- *
- * @return ring_buffer_status_e Status of the replace operation:
- *         - RING_BUFFER_STATUS_OK: Data successfully replaced at the specified index
- */
-ring_buffer_status_e RING_BUFFER_Replace(ring_buffer_t *rb, size_t index, const void *data);
-
-/**
- * @brief Checks if the ring buffer is empty.
- *
- * This function checks whether the ring buffer contains any data. It returns a status  indicating whether the buffer is
- * empty or contains data that can be retrieved.
- *
- * @param[in] rb A pointer to the ring buffer structure to check.
- *
- * @return ring_buffer_status_e Status of the check:
- *         - RING_BUFFER_STATUS_OK: The buffer is empty
- */
-ring_buffer_status_e RING_BUFFER_IsEmpty(ring_buffer_t *rb);
-
-/**
- * @brief Checks if the ring buffer is full.
- *
- * This function checks whether the ring buffer is full and cannot accommodate more data.
- * It returns a status indicating whether the buffer is full or still has space available.
- *
- * @param[in] rb A pointer to the ring buffer structure to check.
- *
- * @return ring_buffer_status_e Status of the check:
- *         - RING_BUFFER_STATUS_OK: The buffer is full and cannot accept more data
- */
-ring_buffer_status_e RING_BUFFER_IsFull(ring_buffer_t *rb);
-
-/**
- * @brief Gets the number of free elements in the ring buffer.
- *
- * This function retrieves the number of available (free) slots in the ring buffer
- * that can be used to insert new data. It returns the count of unused elements.
- *
- * @param[in] rb A pointer to the ring buffer structure to check.
- * @param[out] result A pointer to a variable where the number of free elements will be stored.
- *
- * @return ring_buffer_status_e Status of the operation:
- *         - RING_BUFFER_STATUS_OK: The number of free elements was successfully retrieved.
- */
-ring_buffer_status_e RING_BUFFER_GetFreeElements(ring_buffer_t *rb, size_t *result);
-
-/**
- * @brief Gets the size of each element in the ring buffer.
- *
- * This function retrieves the size of each element stored in the ring buffer.
- * It is useful when the buffer stores elements of varying sizes or when a
- * consistent element size is required for processing.
- *
- * @param[in] rb A pointer to the ring buffer structure to check.
- * @param[out] result A pointer to a variable where the size of element will be stored.
- *
- * @return ring_buffer_status_e Status of the operation:
- *         - RING_BUFFER_STATUS_OK: The element size was successfully retrieved.
- */
-ring_buffer_status_e RING_BUFFER_GetElementSize(ring_buffer_t *rb, size_t *result);
-
-// C++ wrapper - End
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* RING_BUFFER_H */
-
-// --- EOF -------------------------------------------------------------------------------------------------------------
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer.h
+ * @brief       The Component RING BUFFER provides an efficient circular buffer for handling data in a fixed-size memory
+ *              structure. It ensures seamless storage and retrieval with minimal memory overhead, ideal for
+ *              applications requiring high-performance, low-latency data management.
+ *              - Using dynamic memory
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-12
+ * @version     1.0.0
+ *
+ *  Author          Date        Version     Comments on that revision
+ * ---------------------------------------------------------------------------------------------------------------------
+ *  Blaz Baskovc    2025-03-12  1.0.0       First release.
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#if __has_include("ring_buffer_conf.h")
+#include "ring_buffer_conf.h"
+#endif /* __has_include("ring_buffer_conf.h") */
+
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Component version.
+ */
+#define RING_BUFFER_NAME    "RING-BUFFER" //< Component name as string.
+#define RING_BUFFER_VERSION (0x01000000U) //< Component version as uint32_t (major.minor.patch.fix).
+
+/**
+ * @brief   Timeout of the wait functions that never expires.
+ */
+#define RING_BUFFER_WAIT_FOREVER (UINT32_MAX)
+
+/**
+ * @brief   Size of the length header stored in front of every record in record mode (ring_buffer_conf_t.records).
+ */
+#define RING_BUFFER_RECORD_HEADER_SIZE (sizeof(uint32_t))
+
+/**
+ * @brief   Maximum number of buffers of RING_BUFFER_MirrorAlloc mapped at the same time.
+ */
+#ifndef RING_BUFFER_CONF_MIRROR_MAX
+#define RING_BUFFER_CONF_MIRROR_MAX 16
+#endif /* RING_BUFFER_CONF_MIRROR_MAX */
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes a ring buffer with the given configuration.
+ *
+ * This function initializes a ring buffer structure by allocating memory and setting the buffer size and other
+ * configuration parameters. It must be called before using the ring buffer for reading or writing.
+ *
+ * With the producer_lock / consumer_lock hooks configured, inserting functions take the producer lock and retrieving
+ * functions (including Peek and Replace) the consumer lock, so one insert and one retrieve can run at the same time.
+ * Only an insert that evicts elements in overwrite mode takes both (always producer first).
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be initialized.
+ * @param[in] conf The configuration structure containing parameters for the buffer.
+ *
+ * @return ring_buffer_status_e Status of the initialization:
+ *         - RING_BUFFER_STATUS_OK: Successful initialization
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid configuration, a lock hook without both functions, or mirrored
+ *           set on a buffer that does not come from RING_BUFFER_MirrorAlloc
+ */
+ring_buffer_status_e RING_BUFFER_Init(ring_buffer_t *rb, ring_buffer_conf_t conf);
+
+/**
+ * @brief Deinitialize a ring buffer and frees any allocated resources.
+ *
+ * This function deinitialize the ring buffer, releasing any resources associated with it and resetting its internal
+ * state. After calling this function, the ring buffer is no longer usable unless reinitialized.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be deinitialize.
+ *
+ * @return ring_buffer_status_e Status of the deinitialization:
+ *         - RING_BUFFER_STATUS_OK: Successful deinitialization
+ */
+ring_buffer_status_e RING_BUFFER_DeInit(ring_buffer_t *rb);
+
+/**
+ * @brief Inserts data into the ring buffer.
+ *
+ * This function inserts a data element into the ring buffer. If there is enough space in the buffer, the data is added;
+ * otherwise, it may return an error indicating that the buffer is full.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to the data to be inserted into the buffer.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_Insert(ring_buffer_t *rb, const void *data);
+
+/**
+ * @brief Retrieves data from the ring buffer.
+ *
+ * This function retrieves a data element from the ring buffer. If data is available, it is copied into the provided
+ * buffer. If the buffer is empty, it may return an error indicating that no data is available for retrieval.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer where the retrieved data will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_Retrieve(ring_buffer_t *rb, void *data);
+
+/**
+ * @brief Inserts multiple data elements into the ring buffer.
+ *
+ * This function inserts up to n consecutive elements from data with at most two block copies, one on each side of the
+ * wrap point. Without overwrite only the elements that fit are inserted. With overwrite the whole batch is accepted and
+ * the oldest elements are evicted, leaving the buffer exactly as n consecutive calls of RING_BUFFER_Insert would.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to n consecutive elements to be inserted into the buffer.
+ * @param[in] n The number of elements to insert.
+ * @param[out] written A pointer to a variable where the number of accepted elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully inserted (see written for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space for any element and overwrite is disabled
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_InsertMany(ring_buffer_t *rb, const void *data, size_t n, size_t *written);
+
+/**
+ * @brief Retrieves multiple data elements from the ring buffer.
+ *
+ * This function retrieves up to n of the oldest elements from the ring buffer with at most two block copies, one on
+ * each side of the wrap point. The retrieved elements are removed from the buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer with room for n elements where the retrieved data will be stored.
+ * @param[in] n The maximum number of elements to retrieve.
+ * @param[out] read A pointer to a variable where the number of retrieved elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully retrieved (see read for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_RetrieveMany(ring_buffer_t *rb, void *data, size_t n, size_t *read);
+
+#if defined(__linux__)
+
+/**
+ * @brief Inserts data into the ring buffer, sleeping while it is full.
+ *
+ * The caller waits until a retrieving thread frees an element or the timeout expires, with the strategy selected in
+ * ring_buffer_conf_t.wait (sleeping on a futex by default, or spinning / yielding first). Retrieving threads only
+ * issue the wake system call while a thread is actually parked, so the plain functions stay as fast as before. Other
+ * threads can only wake the caller when the buffer is configured with lock hooks, so without them
+ * RING_BUFFER_WAIT_FOREVER is rejected.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to the data to be inserted into the buffer.
+ * @param[in] timeout_ms Maximum time to wait in milliseconds (0 does not wait, RING_BUFFER_WAIT_FOREVER never expires).
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: The buffer stayed full until the timeout
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Record mode, or RING_BUFFER_WAIT_FOREVER without lock hooks
+ */
+ring_buffer_status_e RING_BUFFER_InsertWait(ring_buffer_t *rb, const void *data, uint32_t timeout_ms);
+
+/**
+ * @brief Retrieves data from the ring buffer, sleeping while it is empty.
+ *
+ * The caller waits until an inserting thread publishes an element or the timeout expires (see
+ * RING_BUFFER_InsertWait).
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer where the retrieved data will be stored.
+ * @param[in] timeout_ms Maximum time to wait in milliseconds (0 does not wait, RING_BUFFER_WAIT_FOREVER never expires).
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The buffer stayed empty until the timeout
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Record mode, or RING_BUFFER_WAIT_FOREVER without lock hooks
+ */
+ring_buffer_status_e RING_BUFFER_RetrieveWait(ring_buffer_t *rb, void *data, uint32_t timeout_ms);
+
+/**
+ * @brief Retrieves up to n elements from the ring buffer, waiting until all of them arrive or the timeout expires.
+ *
+ * Elements are taken as they arrive, so on timeout the caller gets whatever was inserted until then.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer with room for n elements where the retrieved data will be stored.
+ * @param[in] n The maximum number of elements to retrieve.
+ * @param[out] read A pointer to a variable where the number of retrieved elements will be stored.
+ * @param[in] timeout_ms Maximum time to wait in milliseconds (0 does not wait, RING_BUFFER_WAIT_FOREVER never expires).
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully retrieved (n, or fewer when the timeout expired)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No element arrived until the timeout
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Record mode, or RING_BUFFER_WAIT_FOREVER without lock hooks
+ */
+ring_buffer_status_e RING_BUFFER_RetrieveManyWait(ring_buffer_t *rb, void *data, size_t n, size_t *read,
+                                                  uint32_t timeout_ms);
+
+/**
+ * @brief Allocates a mirrored buffer: the same memfd pages mapped twice, back to back.
+ *
+ * The mapping continues past buffer_size with the start of the buffer, so with conf.mirrored set every element and
+ * every run of elements is virtually contiguous: inserts and retrievals are always one copy, and
+ * RING_BUFFER_ReserveWrite / RING_BUFFER_PeekSpans always return a single region (seg2 is NULL).
+ *
+ * The mapping is made of whole pages, so size is rounded up to a multiple of the page size and conf.buffer_size
+ * receives the rounded size, which is what the ring buffer then holds (e.g. 4096 bytes for a size of 100). Pick an
+ * element size that divides it when the whole mapping should be used (needed for power_of_two mode anyway).
+ *
+ * Only this function sets conf.mirrored: the mapping is tracked until RING_BUFFER_MirrorFree, and RING_BUFFER_Init
+ * rejects a mirrored configuration whose buffer and buffer_size are not such a mapping, so the flag cannot be set by
+ * hand on a plain buffer (whose end the wrap-free accesses would overrun).
+ *
+ * @param[out] conf A pointer to the configuration whose buffer, buffer_size and mirrored fields are filled in.
+ * @param[in] size The minimum buffer size in bytes (rounded up to whole pages).
+ *
+ * @return ring_buffer_status_e Status of the allocation:
+ *         - RING_BUFFER_STATUS_OK: Buffer successfully mapped
+ *         - RING_BUFFER_STATUS_ERROR: memfd_create, ftruncate or mmap failed, or RING_BUFFER_CONF_MIRROR_MAX
+ *           buffers are already mapped
+ */
+ring_buffer_status_e RING_BUFFER_MirrorAlloc(ring_buffer_conf_t *conf, size_t size);
+
+/**
+ * @brief Unmaps a buffer allocated with RING_BUFFER_MirrorAlloc (after RING_BUFFER_DeInit of its ring buffers).
+ *
+ * @param[in] conf A pointer to the configuration holding the mirrored buffer (cleared on success).
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Buffer successfully unmapped
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Buffer and size are not a live mapping of RING_BUFFER_MirrorAlloc
+ */
+ring_buffer_status_e RING_BUFFER_MirrorFree(ring_buffer_conf_t *conf);
+
+/**
+ * @brief Creates the eventfd notifiers of a ring buffer, so it can be multiplexed with sockets and timers in epoll.
+ *
+ * The data notifier is signalled when the buffer goes from empty to non-empty and the space notifier when it goes from
+ * full to not full. A notifier signals once and then stays quiet until RING_BUFFER_NotifyAck re-arms it, so a burst of
+ * transitions costs at most one write system call. Right after creation the data notifier is readable when the buffer
+ * holds elements and the space notifier when it has free space. Must be called before any thread starts using the
+ * ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to attach the notifiers to.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Notifiers created
+ *         - RING_BUFFER_STATUS_ERROR: Notifiers already created or eventfd creation failed
+ */
+ring_buffer_status_e RING_BUFFER_NotifyInit(ring_buffer_t *rb);
+
+/**
+ * @brief Closes the eventfd notifiers of a ring buffer (also done by RING_BUFFER_DeInit).
+ *
+ * @param[in] rb A pointer to the ring buffer structure with the notifiers.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Notifiers closed
+ *         - RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED: No notifiers were created
+ */
+ring_buffer_status_e RING_BUFFER_NotifyDeInit(ring_buffer_t *rb);
+
+/**
+ * @brief Gets the eventfd of a notifier to register it in an epoll set (for EPOLLIN).
+ *
+ * @param[in] rb A pointer to the ring buffer structure with the notifiers.
+ * @param[in] notify The notifier (RING_BUFFER_NOTIFY_DATA for consumers, RING_BUFFER_NOTIFY_SPACE for producers).
+ * @param[out] fd A pointer to a variable where the file descriptor will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The file descriptor was successfully retrieved
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Unknown notifier
+ *         - RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED: No notifiers were created
+ */
+ring_buffer_status_e RING_BUFFER_GetNotifyFd(ring_buffer_t *rb, ring_buffer_notify_e notify, int *fd);
+
+/**
+ * @brief Clears a readable notifier and re-arms it for the next edge.
+ *
+ * Call it when epoll reports the notifier readable, then drain the buffer until RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY
+ * (or fill it until RING_BUFFER_STATUS_ERROR_BUFFER_FULL for the space notifier) before waiting again. An edge that
+ * happened before the ack is covered by that drain, every later one signals the notifier again.
+ *
+ * @param[in] rb A pointer to the ring buffer structure with the notifiers.
+ * @param[in] notify The notifier to acknowledge.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The notifier was cleared and re-armed
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Unknown notifier
+ *         - RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED: No notifiers were created
+ */
+ring_buffer_status_e RING_BUFFER_NotifyAck(ring_buffer_t *rb, ring_buffer_notify_e notify);
+
+/**
+ * @brief Writes the oldest elements of the ring buffer to a file descriptor with one writev system call.
+ *
+ * The up to two stored regions (see RING_BUFFER_PeekSpans) go out as one gather write and only the elements the
+ * descriptor accepted are removed. The call never waits: when the descriptor accepts part of an element, the element
+ * stays in the ring buffer and the next call writes the rest of it first, also after RING_BUFFER_STATUS_ERROR. Keep
+ * calling with the same descriptor until it is written. Removing the element with another function (retrieve, consume,
+ * discard, clear or an overwriting insert) abandons the pending bytes: the next call starts at the new oldest element
+ * and the descriptor is left with a torn element. Not available in record mode.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be drained.
+ * @param[in] fd The file descriptor to write to (file, pipe or socket).
+ * @param[in] max The maximum number of elements to write.
+ * @param[out] drained A pointer to a variable where the number of removed elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Elements written (drained is 0 when a non-blocking descriptor would block)
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ *         - RING_BUFFER_STATUS_ERROR: writev failed (see errno), nothing was removed
+ */
+ring_buffer_status_e RING_BUFFER_DrainToFd(ring_buffer_t *rb, int fd, size_t max, size_t *drained);
+
+/**
+ * @brief Reads elements from a file descriptor into the free space of the ring buffer with one readv system call.
+ *
+ * The up to two free regions (see RING_BUFFER_ReserveWrite) are filled by one scatter read and only the elements that
+ * arrived are added. The call never waits: when part of an element arrives, the bytes are kept in the free space and
+ * the next call reads the rest of the element first. Inserting with another function (or committing or discarding
+ * the newest elements) in between takes that space and abandons the bytes read so far: the next call starts a new
+ * element and the rest of the torn one is read as the start of it. Only free space is used, also in overwrite mode.
+ * Not available in record mode.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] fd The file descriptor to read from (file, pipe or socket).
+ * @param[in] max The maximum number of elements to read.
+ * @param[out] filled A pointer to a variable where the number of added elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Elements read (filled is 0 when a non-blocking descriptor has no data)
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The descriptor is at end of file
+ *         - RING_BUFFER_STATUS_ERROR: readv failed (see errno) or the file ended inside an element, nothing was
+ *                                     added and the bytes of the element read so far stay pending
+ */
+ring_buffer_status_e RING_BUFFER_FillFromFd(ring_buffer_t *rb, int fd, size_t max, size_t *filled);
+
+#endif /* defined(__linux__) */
+
+/**
+ * @brief Reserves space for elements to be written directly into the ring buffer memory.
+ *
+ * This function returns up to two contiguous regions of the buffer memory (the second one is only used when the space
+ * wraps around the end of the buffer) where up to n elements can be serialized or transferred by DMA. The elements
+ * become visible to readers only after RING_BUFFER_CommitWrite. Lengths are in bytes, an element may be split between
+ * the two regions when the buffer size is not a multiple of the element size. A mirrored buffer (conf.mirrored) always
+ * returns one region. Without overwrite the reservation is limited to the free elements; with overwrite it may cover
+ * the oldest elements, which are evicted on commit.
+ *
+ * With a producer lock configured, a successful reservation keeps it until RING_BUFFER_CommitWrite (and also the
+ * consumer lock when the reservation covers stored elements).
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be written.
+ * @param[in] n The number of elements to reserve.
+ * @param[out] seg1 A pointer to a variable where the start of the first region will be stored.
+ * @param[out] len1 A pointer to a variable where the length of the first region in bytes will be stored.
+ * @param[out] seg2 A pointer to a variable where the start of the second region (or NULL) will be stored.
+ * @param[out] len2 A pointer to a variable where the length of the second region in bytes will be stored.
+ *
+ * @return ring_buffer_status_e Status of the reservation:
+ *         - RING_BUFFER_STATUS_OK: Space successfully reserved (len1 + len2 bytes)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space for any element and overwrite is disabled
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_ReserveWrite(ring_buffer_t *rb, size_t n, void **seg1, size_t *len1, void **seg2,
+                                              size_t *len2);
+
+/**
+ * @brief Commits elements written into the space reserved by RING_BUFFER_ReserveWrite.
+ *
+ * This function publishes the first n reserved elements by advancing the head and the element count in one step, once
+ * all the element data has been written in place. Committing fewer elements than reserved is allowed, the rest of the
+ * reservation is released. Every call ends the reservation and releases the locks taken by RING_BUFFER_ReserveWrite,
+ * also the one failing with RING_BUFFER_STATUS_ERROR_INPUT_ARGS (which commits nothing). A call without an open
+ * reservation (RING_BUFFER_ReserveWrite failed, or the reservation was already committed) is rejected and releases no
+ * lock.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data was written.
+ * @param[in] n The number of elements to commit.
+ *
+ * @return ring_buffer_status_e Status of the commit:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully committed
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: No open reservation, more elements than reserved, or record mode
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: Elements inserted since the reservation leave no room for the commit
+ */
+ring_buffer_status_e RING_BUFFER_CommitWrite(ring_buffer_t *rb, size_t n);
+
+/**
+ * @brief Gives direct access to the oldest elements stored in the ring buffer without copying them.
+ *
+ * This function returns up to two contiguous regions of the buffer memory (the second one is only used when the data
+ * wraps around the end of the buffer) holding up to max of the oldest elements, so they can be parsed or written out
+ * in place. The elements stay in the buffer until they are released with RING_BUFFER_Consume. Lengths are in bytes,
+ * an element may be split between the two regions when the buffer size is not a multiple of the element size. A
+ * mirrored buffer (conf.mirrored) always returns one region.
+ *
+ * With a consumer lock configured, a successful call keeps it until RING_BUFFER_Consume.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be peeked.
+ * @param[in] max The maximum number of elements to expose.
+ * @param[out] seg1 A pointer to a variable where the start of the first region will be stored.
+ * @param[out] len1 A pointer to a variable where the length of the first region in bytes will be stored.
+ * @param[out] seg2 A pointer to a variable where the start of the second region (or NULL) will be stored.
+ * @param[out] len2 A pointer to a variable where the length of the second region in bytes will be stored.
+ *
+ * @return ring_buffer_status_e Status of the peek operation:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully exposed (len1 + len2 bytes)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_PeekSpans(ring_buffer_t *rb, size_t max, const void **seg1, size_t *len1,
+                                           const void **seg2, size_t *len2);
+
+/**
+ * @brief Releases the oldest elements from the ring buffer without copying them.
+ *
+ * This function removes the n oldest elements after they were processed in place, at most as many as the last
+ * successful RING_BUFFER_PeekSpans exposed. Every call ends the peek and releases the consumer lock taken there, also
+ * one failing with RING_BUFFER_STATUS_ERROR_INPUT_ARGS because n exceeds the exposed elements (which releases no
+ * elements). A call without an open peek (RING_BUFFER_PeekSpans failed, or the peek was already consumed) is rejected
+ * and releases no lock.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be released.
+ * @param[in] n The number of elements to release.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully released
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: No open peek, more elements than exposed by the peek, or record mode
+ */
+ring_buffer_status_e RING_BUFFER_Consume(ring_buffer_t *rb, size_t n);
+
+/**
+ * @brief Drops the oldest elements from the ring buffer without copying them.
+ *
+ * Only the tail and the count move, so the cost does not depend on n. Asking for more elements than stored drops all
+ * of them.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be dropped.
+ * @param[in] n The number of elements to drop.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully dropped
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ */
+ring_buffer_status_e RING_BUFFER_Discard(ring_buffer_t *rb, size_t n);
+
+/**
+ * @brief Drops the newest elements from the ring buffer without copying them.
+ *
+ * Only the head and the count move, so the cost does not depend on n. Asking for more elements than stored drops all
+ * of them. With lock hooks configured both locks are taken (producer first).
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be dropped.
+ * @param[in] n The number of elements to drop.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully dropped
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ */
+ring_buffer_status_e RING_BUFFER_DiscardNewest(ring_buffer_t *rb, size_t n);
+
+/**
+ * @brief Drops all elements (or records) from the ring buffer in O(1).
+ *
+ * With lock hooks configured both locks are taken (producer first).
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be emptied.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The buffer is empty
+ */
+ring_buffer_status_e RING_BUFFER_Clear(ring_buffer_t *rb);
+
+/**
+ * @brief Inserts a variable-length record into a ring buffer in record mode (ring_buffer_conf_t.records).
+ *
+ * The record is stored as a RING_BUFFER_RECORD_HEADER_SIZE length header followed by the payload, always in one
+ * contiguous piece: when it does not fit before the wrap point the rest of the buffer end is skipped (a mirrored buffer
+ * never skips). In overwrite mode whole oldest records are evicted until the new one fits. RING_BUFFER_GetFreeElements
+ * reports free bytes in record mode (headers and skipped ends count as used).
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the record will be inserted.
+ * @param[in] data A pointer to the record payload.
+ * @param[in] len The payload length in bytes.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Record successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is not in record mode
+ *         - RING_BUFFER_STATUS_ERROR_OVERFLOW: The record with its header is larger than the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available and overwrite is disabled
+ */
+ring_buffer_status_e RING_BUFFER_InsertRecord(ring_buffer_t *rb, const void *data, size_t len);
+
+/**
+ * @brief Retrieves the oldest record from a ring buffer in record mode.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which the record will be retrieved.
+ * @param[out] out A pointer to the buffer where the record payload will be stored.
+ * @param[in] cap The size of the out buffer in bytes.
+ * @param[out] len A pointer to a variable where the payload length will be stored (also when it does not fit).
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Record successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is not in record mode
+ *         - RING_BUFFER_STATUS_ERROR_OVERFLOW: The record is longer than cap and stays in the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No record available
+ */
+ring_buffer_status_e RING_BUFFER_RetrieveRecord(ring_buffer_t *rb, void *out, size_t cap, size_t *len);
+
+/**
+ * @brief Peeks at data from the ring buffer without removing it.
+ *
+ * This function retrieves a data element from the ring buffer at the specified index without removing it from the
+ * buffer. The buffer remains unchanged after the peek operation. If the index is out of range or if the buffer is
+ * empty, it may return an error.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be peeked.
+ * @param[in] index The index of the data element to peek.
+ * @param[out] data A pointer to the buffer where the peeked data will be stored.
+ *
+ * @return ring_buffer_status_e Status of the peek operation:
+ *         - RING_BUFFER_STATUS_OK: Data successfully peeked from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_Peek(ring_buffer_t *rb, size_t index, void *data);
+
+/**
+ * @brief Replaces a data element at the specified index in the ring buffer.
+ *
+ * This function replaces the data element at the given index with new data. The buffer is not altered in size, and the
+ * existing data at that index is overwritten. If the index is out of range or if the buffer is empty, an error will be
+ * returned.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be replaced.
+ * @param[in] index The index of the data element to replace.
+ * @param[in] data A pointer to the new data that will replace the existing element.
+ *
+ * @return ring_buffer_status_e Status of the replace operation:
+ *         - RING_BUFFER_STATUS_OK: Data successfully replaced at the specified index
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_Replace(ring_buffer_t *rb, size_t index, const void *data);
+
+/**
+ * @brief Copies a window of consecutive elements out of the ring buffer without removing them.
+ *
+ * The position of the first element is resolved once and the window is copied as at most two block copies (one
+ * around the wrap point), instead of one RING_BUFFER_Peek call per element.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be peeked.
+ * @param[in] start The index of the first element of the window, 0 is the oldest.
+ * @param[in] n The number of elements in the window.
+ * @param[out] out A pointer to the buffer with room for n elements where the window will be stored.
+ *
+ * @return ring_buffer_status_e Status of the peek operation:
+ *         - RING_BUFFER_STATUS_OK: Window successfully copied
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ *         - RING_BUFFER_STATUS_ERROR_INVALID_INDEX: The window reaches past the newest element
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_PeekRange(ring_buffer_t *rb, size_t start, size_t n, void *out);
+
+/**
+ * @brief Overwrites a window of consecutive stored elements with new data.
+ *
+ * The counterpart of RING_BUFFER_PeekRange: the buffer is not altered in size and the window is written as at most
+ * two block copies.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be replaced.
+ * @param[in] start The index of the first element of the window, 0 is the oldest.
+ * @param[in] n The number of elements in the window.
+ * @param[in] in A pointer to n consecutive elements that will replace the window.
+ *
+ * @return ring_buffer_status_e Status of the replace operation:
+ *         - RING_BUFFER_STATUS_OK: Window successfully replaced
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ *         - RING_BUFFER_STATUS_ERROR_INVALID_INDEX: The window reaches past the newest element
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: The ring buffer is in record mode
+ */
+ring_buffer_status_e RING_BUFFER_ReplaceRange(ring_buffer_t *rb, size_t start, size_t n, const void *in);
+
+/**
+ * @brief Calls a function for every stored element, from the oldest to the newest, without copying them.
+ *
+ * The storage is walked as at most two contiguous segments and the callback gets a pointer into conf.buffer. The
+ * buffer size must be a whole number of elements (or the buffer mirrored), so no element is split at the wrap point.
+ * The consumer lock is held during the walk, the callback must not call functions that take it.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to walk.
+ * @param[in] fn The function called with each element and ctx (returning false stops the walk).
+ * @param[in] ctx A user pointer passed to fn.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Elements visited (all of them, or up to the one that stopped the walk)
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Record mode, or elements may be split at the wrap point
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ */
+ring_buffer_status_e RING_BUFFER_ForEach(ring_buffer_t *rb, ring_buffer_visit_fn_t fn, void *ctx);
+
+/**
+ * @brief Calls a function that may modify every stored element in place, from the oldest to the newest.
+ *
+ * Same walk as RING_BUFFER_ForEach, with a writable pointer to each element, replacing a Peek / Replace round trip
+ * per element.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to walk.
+ * @param[in] fn The function called with each element and ctx (returning false stops the walk).
+ * @param[in] ctx A user pointer passed to fn.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Elements visited (all of them, or up to the one that stopped the walk)
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Record mode, or elements may be split at the wrap point
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ */
+ring_buffer_status_e RING_BUFFER_MapInPlace(ring_buffer_t *rb, ring_buffer_map_fn_t fn, void *ctx);
+
+/**
+ * @brief Calls a function for each contiguous run of stored elements (at most two, one with a mirrored buffer).
+ *
+ * The callback gets whole runs of elements, oldest first, so it can process them with vectorized loops. The elements
+ * may be modified in place. Same requirements as RING_BUFFER_ForEach.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to walk.
+ * @param[in] fn The function called with each run, its number of elements and ctx (returning false stops the walk).
+ * @param[in] ctx A user pointer passed to fn.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Runs visited
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Record mode, or elements may be split at the wrap point
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+ */
+ring_buffer_status_e RING_BUFFER_ForEachSegment(ring_buffer_t *rb, ring_buffer_segment_fn_t fn, void *ctx);
+
+/**
+ * @brief Checks if the ring buffer is empty.
+ *
+ * This function checks whether the ring buffer contains any data. It returns a status  indicating whether the buffer is
+ * empty or contains data that can be retrieved.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to check.
+ *
+ * @return ring_buffer_status_e Status of the check:
+ *         - RING_BUFFER_STATUS_OK: The buffer is empty
+ */
+ring_buffer_status_e RING_BUFFER_IsEmpty(ring_buffer_t *rb);
+
+/**
+ * @brief Checks if the ring buffer is full.
+ *
+ * This function checks whether the ring buffer is full and cannot accommodate more data.
+ * It returns a status indicating whether the buffer is full or still has space available.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to check.
+ *
+ * @return ring_buffer_status_e Status of the check:
+ *         - RING_BUFFER_STATUS_OK: The buffer is full and cannot accept more data
+ */
+ring_buffer_status_e RING_BUFFER_IsFull(ring_buffer_t *rb);
+
+/**
+ * @brief Gets the number of free elements in the ring buffer.
+ *
+ * This function retrieves the number of available (free) slots in the ring buffer
+ * that can be used to insert new data. It returns the count of unused elements.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to check.
+ * @param[out] result A pointer to a variable where the number of free elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The number of free elements was successfully retrieved.
+ */
+ring_buffer_status_e RING_BUFFER_GetFreeElements(ring_buffer_t *rb, size_t *result);
+
+/**
+ * @brief Gets the size of each element in the ring buffer.
+ *
+ * This function retrieves the size of each element stored in the ring buffer.
+ * It is useful when the buffer stores elements of varying sizes or when a
+ * consistent element size is required for processing.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to check.
+ * @param[out] result A pointer to a variable where the size of element will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The element size was successfully retrieved.
+ */
+ring_buffer_status_e RING_BUFFER_GetElementSize(ring_buffer_t *rb, size_t *result);
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
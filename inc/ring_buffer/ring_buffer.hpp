@@ -0,0 +1,290 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer.hpp
+ * @brief       The component RING-BUFFER header-only C++17 template. bbaskovc::ring_buffer<T, N, Overwrite> follows the
+ *              semantics and status codes of ring_buffer_t, with the capacity, index mask and overwrite policy resolved
+ *              at compile time.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-18
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+namespace bbaskovc
+{
+
+/**
+ * @brief   Fixed capacity ring buffer with inline storage.
+ *
+ * @tparam  T Element type.
+ * @tparam  N Number of elements, a power of two turns index wrapping into a mask.
+ * @tparam  Overwrite Enable inserting new elements even if full (the oldest element is evicted).
+ */
+template <typename T, std::size_t N, bool Overwrite = false> class ring_buffer
+{
+    static_assert(N > 0, "ring_buffer capacity must be greater than zero");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+
+    static constexpr size_type capacity = N;                                   //< Maximum number of elements.
+    static constexpr bool overwrite = Overwrite;                               //< Overwrite policy.
+    static constexpr bool power_of_two = (0 == (N & (N - 1)));                 //< Index wrapping uses the mask.
+    static constexpr size_type mask = power_of_two ? (N - 1) : 0;              //< Element index mask (pow2 N only).
+    static constexpr bool nothrow_copy = std::is_nothrow_copy_assignable_v<T>; //< Copying an element never throws.
+    static constexpr bool nothrow_move = std::is_nothrow_move_assignable_v<T>; //< Moving an element never throws.
+
+    /**
+     * @brief Inserts an element (RING_BUFFER_Insert).
+     *
+     * @param[in] value Element to insert.
+     *
+     * @return ring_buffer_status_e Status of the insertion:
+     *         - RING_BUFFER_STATUS_OK: Element successfully inserted into the buffer
+     *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: Buffer is full and overwrite is disabled
+     */
+    ring_buffer_status_e push(const T &value) noexcept(nothrow_copy)
+    {
+        if (false == _has_room())
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+        _items[_head] = value;
+        _advance_head();
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    /**
+     * @brief Inserts an element by moving it into the buffer (RING_BUFFER_Insert).
+     *
+     * @param[in] value Element to insert.
+     *
+     * @return ring_buffer_status_e Status of the insertion:
+     *         - RING_BUFFER_STATUS_OK: Element successfully inserted into the buffer
+     *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: Buffer is full and overwrite is disabled
+     */
+    ring_buffer_status_e push(T &&value) noexcept(nothrow_move)
+    {
+        if (false == _has_room())
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+        _items[_head] = std::move(value);
+        _advance_head();
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    /**
+     * @brief Retrieves the oldest element (RING_BUFFER_Retrieve).
+     *
+     * @param[out] value Retrieved element.
+     *
+     * @return ring_buffer_status_e Status of the retrieval:
+     *         - RING_BUFFER_STATUS_OK: Element successfully retrieved from the buffer
+     *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+     */
+    ring_buffer_status_e pop(T &value) noexcept(nothrow_move)
+    {
+        if (0 == _count)
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+        }
+        value = std::move(_items[_tail]);
+        _tail = _wrap(_tail + 1);
+        _count--;
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    /**
+     * @brief Retrieves the oldest element if there is one.
+     *
+     * @return std::optional<T> Retrieved element, or std::nullopt when the buffer is empty.
+     */
+    std::optional<T> try_pop() noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (0 == _count)
+        {
+            return std::nullopt;
+        }
+        std::optional<T> value(std::move(_items[_tail]));
+        _tail = _wrap(_tail + 1);
+        _count--;
+        return value;
+    }
+
+    /**
+     * @brief Reads an element without removing it (RING_BUFFER_Peek).
+     *
+     * @param[in] index Index of the element, 0 is the oldest.
+     * @param[out] value Peeked element.
+     *
+     * @return ring_buffer_status_e Status of the peek operation:
+     *         - RING_BUFFER_STATUS_OK: Element successfully peeked from the buffer
+     *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+     *         - RING_BUFFER_STATUS_ERROR_INVALID_INDEX: Index is out of range
+     */
+    ring_buffer_status_e peek(size_type index, T &value) const noexcept(nothrow_copy)
+    {
+        ring_buffer_status_e status = _check_index(index);
+        if (RING_BUFFER_STATUS_OK == status)
+        {
+            value = (*this)[index];
+        }
+        return status;
+    }
+
+    /**
+     * @brief Replaces an element (RING_BUFFER_Replace).
+     *
+     * @param[in] index Index of the element, 0 is the oldest.
+     * @param[in] value New element value.
+     *
+     * @return ring_buffer_status_e Status of the replace operation:
+     *         - RING_BUFFER_STATUS_OK: Element successfully replaced
+     *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available
+     *         - RING_BUFFER_STATUS_ERROR_INVALID_INDEX: Index is out of range
+     */
+    ring_buffer_status_e replace(size_type index, const T &value) noexcept(nothrow_copy)
+    {
+        ring_buffer_status_e status = _check_index(index);
+        if (RING_BUFFER_STATUS_OK == status)
+        {
+            (*this)[index] = value;
+        }
+        return status;
+    }
+
+    /**
+     * @brief Accesses an element for peek or replace without a range check.
+     *
+     * @param[in] index Index of the element, 0 is the oldest (must be less than size()).
+     *
+     * @return reference The element.
+     */
+    reference operator[](size_type index) noexcept
+    {
+        return _items[_wrap(_tail + index)];
+    }
+
+    /**
+     * @brief Accesses an element for peek without a range check.
+     *
+     * @param[in] index Index of the element, 0 is the oldest (must be less than size()).
+     *
+     * @return const_reference The element.
+     */
+    const_reference operator[](size_type index) const noexcept
+    {
+        return _items[_wrap(_tail + index)];
+    }
+
+    /**
+     * @brief Removes all elements, resetting each stored one to T{} so the resources it holds are released.
+     */
+    void clear() noexcept(std::is_nothrow_default_constructible_v<T> && nothrow_move)
+    {
+        // Oldest first, so a throwing reset leaves the not yet cleared elements in the buffer
+        while (0 != _count)
+        {
+            _items[_tail] = T{};
+            _tail = _wrap(_tail + 1);
+            _count--;
+        }
+        _head = 0;
+        _tail = 0;
+    }
+
+    size_type size() const noexcept
+    {
+        return _count;
+    }
+
+    size_type free_elements() const noexcept
+    {
+        return N - _count;
+    }
+
+    bool empty() const noexcept
+    {
+        return (0 == _count);
+    }
+
+    bool full() const noexcept
+    {
+        return (N == _count);
+    }
+
+  private:
+    static constexpr size_type _wrap(size_type slot) noexcept
+    {
+        if constexpr (power_of_two)
+        {
+            return slot & mask;
+        }
+        else
+        {
+            return (slot >= N) ? (slot - N) : slot;
+        }
+    }
+
+    bool _has_room() const noexcept
+    {
+        return Overwrite || (_count < N);
+    }
+
+    // Runs only after the element is stored: a throwing assignment leaves every index as it was, so nothing is evicted
+    void _advance_head() noexcept
+    {
+        _head = _wrap(_head + 1);
+        if (N == _count)
+        {
+            _tail = _head;
+        }
+        else
+        {
+            _count++;
+        }
+    }
+
+    ring_buffer_status_e _check_index(size_type index) const noexcept
+    {
+        if (0 == _count)
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+        }
+        if (index >= _count)
+        {
+            return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;
+        }
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    std::array<T, N> _items{}; //< Element storage.
+    size_type _head = 0;       //< Slot for the next write operation.
+    size_type _tail = 0;       //< Slot for the next read operation.
+    size_type _count = 0;      //< Number of elements currently in the buffer.
+};
+
+} // namespace bbaskovc
+
+#endif /* RING_BUFFER_HPP */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,233 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_aio.h
+ * @brief       The component RING-BUFFER asynchronous drain engine (Linux). It writes the stored elements of a ring
+ *              buffer to a file without blocking the draining thread: the contiguous regions are submitted as io_uring
+ *              writes (from a registered buffer when the kernel allows pinning the ring memory), or handed to a small
+ *              pool of pwrite threads when io_uring is not available. Elements stay in the ring buffer until their
+ *              write completes, so the producer keeps filling the free space while the disk works.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-26
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_AIO_H
+#define RING_BUFFER_AIO_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if __has_include("ring_buffer_conf.h")
+#include "ring_buffer_conf.h"
+#endif /* __has_include("ring_buffer_conf.h") */
+
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif /* defined(__linux__) */
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__linux__)
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Maximum number of writes in flight per drain engine (ring_buffer_aio_conf_t.depth).
+ */
+#ifndef RING_BUFFER_CONF_AIO_DEPTH
+#define RING_BUFFER_CONF_AIO_DEPTH 32
+#endif /* RING_BUFFER_CONF_AIO_DEPTH */
+
+/**
+ * @brief   Maximum number of pwrite threads of the fallback backend (ring_buffer_aio_conf_t.threads).
+ */
+#ifndef RING_BUFFER_CONF_AIO_THREADS
+#define RING_BUFFER_CONF_AIO_THREADS 4
+#endif /* RING_BUFFER_CONF_AIO_THREADS */
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Enumeration representing the backend that performs the writes.
+ */
+typedef enum
+{
+    RING_BUFFER_AIO_BACKEND_AUTO = 0u, /// io_uring when the kernel provides it, pwrite threads otherwise.
+    RING_BUFFER_AIO_BACKEND_IO_URING,  /// io_uring only (raw system calls, no liburing).
+    RING_BUFFER_AIO_BACKEND_THREADS,   /// Pool of threads calling pwrite.
+    RING_BUFFER_AIO_BACKEND_MAX
+} ring_buffer_aio_backend_e;
+
+/**
+ * @brief   Structure representing the drain engine configurations.
+ */
+typedef struct
+{
+    int fd;                            /// Destination file, written at explicit offsets.
+    uint64_t offset;                   /// File offset of the first drained byte.
+    size_t depth;                      /// Writes in flight at most (0 for RING_BUFFER_CONF_AIO_DEPTH).
+    size_t chunk;                      /// Bytes per write at most (0 for whole contiguous regions).
+    size_t threads;                    /// Threads of the pwrite backend (0 for RING_BUFFER_CONF_AIO_THREADS).
+    ring_buffer_aio_backend_e backend; /// Requested backend.
+} ring_buffer_aio_conf_t;
+
+/**
+ * @brief   Structure representing one write of a contiguous piece of the ring buffer.
+ */
+typedef struct
+{
+    const uint8_t *data; /// Start of the piece in the ring buffer memory.
+    size_t len;          /// Length of the piece in bytes.
+    size_t done;         /// Bytes already written (a short write is continued).
+    uint64_t offset;     /// File offset of the piece.
+    int state;           /// Free, queued, running, done or failed.
+    int error;           /// errno of a failed write.
+} ring_buffer_aio_request_t;
+
+/**
+ * @brief   Structure representing the mapped rings of an io_uring instance.
+ */
+typedef struct
+{
+    int fd;              /// io_uring instance.
+    bool registered;     /// Ring buffer memory is registered as fixed buffer 0.
+    void *sq_ring;       /// Submission queue ring mapping.
+    void *cq_ring;       /// Completion queue ring mapping (same as sq_ring with a single mapping).
+    void *sqes;          /// Submission queue entries mapping.
+    size_t sq_ring_size; /// Size of the submission queue ring mapping.
+    size_t cq_ring_size; /// Size of the completion queue ring mapping.
+    size_t sqes_size;    /// Size of the submission queue entries mapping.
+    uint32_t *sq_head;   /// Submission queue head (written by the kernel).
+    uint32_t *sq_tail;   /// Submission queue tail.
+    uint32_t *sq_mask;   /// Submission queue index mask.
+    uint32_t *sq_array;  /// Submission queue index array.
+    uint32_t *cq_head;   /// Completion queue head.
+    uint32_t *cq_tail;   /// Completion queue tail (written by the kernel).
+    uint32_t *cq_mask;   /// Completion queue index mask.
+    void *cqes;          /// Completion queue entries.
+} ring_buffer_aio_uring_t;
+
+/**
+ * @brief   Structure representing a drain engine object.
+ *
+ * The engine is the only consumer of its ring buffer and all its functions are called from one draining thread.
+ */
+typedef struct
+{
+    ring_buffer_aio_conf_t conf;                                    /// Drain engine configurations.
+    ring_buffer_t *rb;                                              /// Drained ring buffer.
+    ring_buffer_aio_backend_e backend;                              /// Backend in use.
+    ring_buffer_aio_request_t requests[RING_BUFFER_CONF_AIO_DEPTH]; /// Writes in ring buffer order (circular).
+    size_t first;                                                   /// Oldest request in flight.
+    size_t used;                                                    /// Number of requests in flight.
+    size_t submitted;                                               /// Bytes from the tail covered by requests.
+    size_t completed;                                               /// Written bytes not released (part of an element).
+    uint64_t offset;                                                /// File offset of the next request.
+    ring_buffer_aio_uring_t uring;                                  /// io_uring backend.
+    pthread_t workers[RING_BUFFER_CONF_AIO_THREADS];                /// pwrite backend threads.
+    pthread_mutex_t mutex;                                          /// pwrite backend request state guard.
+    pthread_cond_t work;                                            /// Signals queued requests to the threads.
+    pthread_cond_t finished;                                        /// Signals completed requests to the engine.
+    bool stop;                                                      /// Asks the pwrite threads to exit.
+} ring_buffer_aio_t;
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes a drain engine for an initialized ring buffer and starts its backend.
+ *
+ * The ring buffer must not be in overwrite or record mode, since elements in flight may not be evicted and skip
+ * markers are not part of the file. With RING_BUFFER_AIO_BACKEND_AUTO a kernel without io_uring (or a sandbox that
+ * blocks it) silently selects the pwrite threads.
+ *
+ * @param[in] aio A pointer to the drain engine structure to be initialized.
+ * @param[in] rb A pointer to the ring buffer to drain.
+ * @param[in] conf The configuration structure (destination, depth, chunk size and backend).
+ *
+ * @return ring_buffer_status_e Status of the initialization:
+ *         - RING_BUFFER_STATUS_OK: Engine started, see aio->backend for the backend in use
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid configuration or an overwrite / record mode ring buffer
+ *         - RING_BUFFER_STATUS_ERROR: The requested backend could not be started
+ */
+ring_buffer_status_e RING_BUFFER_AIO_Init(ring_buffer_aio_t *aio, ring_buffer_t *rb, ring_buffer_aio_conf_t conf);
+
+/**
+ * @brief Waits for the writes in flight and stops the backend (elements not submitted stay in the ring buffer).
+ *
+ * @param[in] aio A pointer to the drain engine structure to be stopped.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Engine stopped
+ */
+ring_buffer_status_e RING_BUFFER_AIO_DeInit(ring_buffer_aio_t *aio);
+
+/**
+ * @brief Submits writes for the stored elements that are not in flight yet, without waiting for them.
+ *
+ * @param[in] aio A pointer to the drain engine structure.
+ * @param[out] submitted A pointer to a variable where the number of newly submitted bytes will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Writes submitted (submitted is 0 when nothing is stored or no request is free)
+ *         - RING_BUFFER_STATUS_ERROR: The kernel refused the submission
+ */
+ring_buffer_status_e RING_BUFFER_AIO_Submit(ring_buffer_aio_t *aio, size_t *submitted);
+
+/**
+ * @brief Collects completed writes and releases the elements they cover from the ring buffer.
+ *
+ * Writes may complete in any order, elements are released in ring buffer order once every write before them
+ * completed. A short write is submitted again for its rest.
+ *
+ * @param[in] aio A pointer to the drain engine structure.
+ * @param[in] wait True to wait until the oldest write in flight completes (returns at once when none is in flight).
+ * @param[out] released A pointer to a variable where the number of released elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Completions collected
+ *         - RING_BUFFER_STATUS_ERROR: The oldest write failed (its errno is in the request), nothing after it is
+ *                                     released until the engine is restarted
+ */
+ring_buffer_status_e RING_BUFFER_AIO_Reap(ring_buffer_aio_t *aio, bool wait, size_t *released);
+
+/**
+ * @brief Submits and reaps until the ring buffer is empty and no write is in flight.
+ *
+ * @param[in] aio A pointer to the drain engine structure.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Everything stored was written
+ *         - RING_BUFFER_STATUS_ERROR: A submission or a write failed
+ */
+ring_buffer_status_e RING_BUFFER_AIO_Flush(ring_buffer_aio_t *aio);
+
+/**
+ * @brief Gets the number of writes in flight.
+ *
+ * @param[in] aio A pointer to the drain engine structure.
+ * @param[out] result A pointer to a variable where the number of writes will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The number of writes was successfully retrieved.
+ */
+ring_buffer_status_e RING_BUFFER_AIO_GetInFlight(ring_buffer_aio_t *aio, size_t *result);
+
+#endif /* defined(__linux__) */
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_AIO_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,60 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_atomic.h
+ * @brief       The component RING-BUFFER atomic and cache line helpers shared by the concurrent ring buffer variants.
+ *              Atomics map to C11 <stdatomic.h> in C and to std::atomic in C++, so the concurrent types can be included
+ *              from both languages.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-19
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_ATOMIC_H
+#define RING_BUFFER_ATOMIC_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#if __has_include("ring_buffer_conf.h")
+#include "ring_buffer_conf.h"
+#endif /* __has_include("ring_buffer_conf.h") */
+
+#ifdef __cplusplus
+#include <atomic>
+#else
+#include <stdatomic.h>
+#endif /* __cplusplus */
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Cache line size used to keep data written by different threads apart (avoids false sharing).
+ */
+#ifndef RING_BUFFER_CONF_CACHE_LINE_SIZE
+#define RING_BUFFER_CONF_CACHE_LINE_SIZE 64
+#endif /* RING_BUFFER_CONF_CACHE_LINE_SIZE */
+
+// --- Public Macros ---------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Declares an atomic object of the given type.
+ * @param   type Underlying type (must be lock-free on the target, e.g. size_t).
+ */
+#ifdef __cplusplus
+#define RING_BUFFER_ATOMIC(type) std::atomic<type>
+#else
+#define RING_BUFFER_ATOMIC(type) _Atomic type
+#endif /* __cplusplus */
+
+/**
+ * @brief   Aligns a structure member to the start of a cache line.
+ */
+#ifdef __cplusplus
+#define RING_BUFFER_CACHE_ALIGNED alignas(RING_BUFFER_CONF_CACHE_LINE_SIZE)
+#else
+#define RING_BUFFER_CACHE_ALIGNED _Alignas(RING_BUFFER_CONF_CACHE_LINE_SIZE)
+#endif /* __cplusplus */
+
+#endif /* RING_BUFFER_ATOMIC_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,159 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_copy.h
+ * @brief       The component RING-BUFFER copy kernels used to move element data in and out of the buffer memory.
+ *              The kernel used by the component is selected at build time with RING_BUFFER_CONF_COPY_KERNEL, or at
+ *              initialization when RING_BUFFER_COPY_KERNEL_AUTO is configured.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-14
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_COPY_H
+#define RING_BUFFER_COPY_H
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Available copy kernels (values for RING_BUFFER_CONF_COPY_KERNEL).
+ */
+#define RING_BUFFER_COPY_KERNEL_LOOP (0u) //< Portable byte loop, fallback for freestanding targets.
+#define RING_BUFFER_COPY_KERNEL_LIBC (1u) //< Standard library memcpy / memset.
+#define RING_BUFFER_COPY_KERNEL_WORD (2u) //< Aligned machine word copies.
+#define RING_BUFFER_COPY_KERNEL_SSE2 (3u) //< 128-bit SSE2 copies (x86-64 only).
+#define RING_BUFFER_COPY_KERNEL_AVX2 (4u) //< 256-bit AVX2 copies (x86-64 only, CPU must support AVX2).
+#define RING_BUFFER_COPY_KERNEL_AUTO (5u) //< Fastest kernel supported by the CPU, selected at initialization.
+
+/**
+ * @brief   Defined when the x86-64 vector kernels are available for the target.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define RING_BUFFER_COPY_X86_64
+#endif /* defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) */
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Copy kernel function type.
+ */
+typedef void (*ring_buffer_copy_fn)(void *dst, const void *src, size_t len);
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Copies memory one byte at a time.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] src Source memory block.
+ * @param[in] len Number of bytes to copy.
+ */
+void RING_BUFFER_CopyLoop(void *dst, const void *src, size_t len);
+
+/**
+ * @brief Copies memory with machine words when source and destination share the same alignment.
+ *
+ * Leading bytes are copied until both blocks are word aligned, the bulk is copied in words and the trailing bytes one
+ * at a time. Blocks with different alignment fall back to the byte loop.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] src Source memory block.
+ * @param[in] len Number of bytes to copy.
+ */
+void RING_BUFFER_CopyWord(void *dst, const void *src, size_t len);
+
+#if __STDC_HOSTED__
+/**
+ * @brief Copies memory with the standard library memcpy.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] src Source memory block.
+ * @param[in] len Number of bytes to copy.
+ */
+void RING_BUFFER_CopyLibc(void *dst, const void *src, size_t len);
+#endif /* __STDC_HOSTED__ */
+
+#ifdef RING_BUFFER_COPY_X86_64
+/**
+ * @brief Copies memory with unaligned 128-bit SSE2 loads and stores.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] src Source memory block.
+ * @param[in] len Number of bytes to copy.
+ */
+void RING_BUFFER_CopySse2(void *dst, const void *src, size_t len);
+
+/**
+ * @brief Copies memory with unaligned 256-bit AVX2 loads and stores.
+ *
+ * Must only be called when RING_BUFFER_CopyAvx2Supported() returns true.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] src Source memory block.
+ * @param[in] len Number of bytes to copy.
+ */
+void RING_BUFFER_CopyAvx2(void *dst, const void *src, size_t len);
+
+/**
+ * @brief Checks whether the running CPU supports the AVX2 kernel.
+ *
+ * @return bool True when RING_BUFFER_CopyAvx2 can be used.
+ */
+bool RING_BUFFER_CopyAvx2Supported(void);
+#endif /* RING_BUFFER_COPY_X86_64 */
+
+/**
+ * @brief Copies memory with the kernel selected by RING_BUFFER_CopySelect.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] src Source memory block.
+ * @param[in] len Number of bytes to copy.
+ */
+void RING_BUFFER_CopyAuto(void *dst, const void *src, size_t len);
+
+/**
+ * @brief Selects the fastest copy kernel supported by the running CPU for RING_BUFFER_CopyAuto.
+ *
+ * Called by RING_BUFFER_Init, calling it again is harmless.
+ *
+ * @return ring_buffer_copy_fn The selected kernel.
+ */
+ring_buffer_copy_fn RING_BUFFER_CopySelect(void);
+
+/**
+ * @brief Sets memory one byte at a time.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] val Byte value to set.
+ * @param[in] len Number of bytes to set.
+ */
+void RING_BUFFER_SetLoop(void *dst, uint8_t val, size_t len);
+
+/**
+ * @brief Sets memory with aligned machine words.
+ *
+ * @param[out] dst Destination memory block.
+ * @param[in] val Byte value to set.
+ * @param[in] len Number of bytes to set.
+ */
+void RING_BUFFER_SetWord(void *dst, uint8_t val, size_t len);
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_COPY_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,235 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_file.h
+ * @brief       The component RING-BUFFER persistent variant backed by a memory-mapped file (Linux). Elements live in
+ *              file slots stamped with their sequence number and a CRC, and two alternating header copies hold head,
+ *              tail, count and a generation protected by a CRC. Reopening the file after a crash restores the ring in
+ *              O(1) from the newest valid header copy, and only falls back to a scan of the slots when both copies are
+ *              torn. An msync policy trades durability against throughput.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-25
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_FILE_H
+#define RING_BUFFER_FILE_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__linux__)
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+#define RING_BUFFER_FILE_MAGIC   (0x52424649U) //< Marks a valid header copy ("RBFI").
+#define RING_BUFFER_FILE_VERSION (1U)          //< Layout version of the file.
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Enumeration representing when the mapping is flushed to the file with msync.
+ */
+typedef enum
+{
+    RING_BUFFER_FILE_SYNC_NONE = 0u, /// Never, the kernel writes back on its own (survives a process crash only).
+    RING_BUFFER_FILE_SYNC_BATCH,     /// After every insert / retrieve call, slots before the header that covers them.
+    RING_BUFFER_FILE_SYNC_PERIODIC,  /// From the first call after period_ms passed since the last flush.
+    RING_BUFFER_FILE_SYNC_MAX
+} ring_buffer_file_sync_e;
+
+/**
+ * @brief   Enumeration representing how RING_BUFFER_FILE_Open restored the ring buffer.
+ */
+typedef enum
+{
+    RING_BUFFER_FILE_RECOVERY_NEW = 0u, /// File was created (or empty), the ring buffer starts empty.
+    RING_BUFFER_FILE_RECOVERY_HEADER,   /// State taken from the newest valid header copy in O(1).
+    RING_BUFFER_FILE_RECOVERY_SCAN,     /// Both header copies were torn, state rebuilt from the slots.
+    RING_BUFFER_FILE_RECOVERY_MAX
+} ring_buffer_file_recovery_e;
+
+/**
+ * @brief   Structure representing a persistent ring buffer configurations.
+ */
+typedef struct
+{
+    const char *path;             /// Path of the backing file (created when missing).
+    size_t element_size;          /// Size of one element in bytes.
+    size_t elements;              /// Maximum number of elements.
+    ring_buffer_file_sync_e sync; /// msync policy.
+    uint32_t period_ms;           /// Flush period of RING_BUFFER_FILE_SYNC_PERIODIC.
+} ring_buffer_file_conf_t;
+
+/**
+ * @brief   Structure representing one header copy stored at the start of the file.
+ */
+typedef struct
+{
+    uint32_t magic;        /// RING_BUFFER_FILE_MAGIC.
+    uint32_t version;      /// RING_BUFFER_FILE_VERSION.
+    uint64_t element_size; /// Size of one element in bytes.
+    uint64_t elements;     /// Maximum number of elements.
+    uint64_t head;         /// Sequence number of the next inserted element.
+    uint64_t tail;         /// Sequence number of the oldest element.
+    uint64_t count;        /// Number of stored elements (head - tail).
+    uint64_t generation;   /// Incremented on every update, selects the copy written next.
+    uint32_t crc;          /// CRC-32 of all fields above.
+    uint32_t reserved;     /// Zero.
+} ring_buffer_file_header_t;
+
+/**
+ * @brief   Structure representing a persistent ring buffer object.
+ *
+ * Not thread-safe, serialize the calls when several threads share it.
+ */
+typedef struct
+{
+    ring_buffer_file_conf_t conf;         /// Ring Buffer configurations.
+    int fd;                               /// Backing file.
+    uint8_t *map;                         /// Mapping of the whole file.
+    size_t map_size;                      /// Size of the file and the mapping.
+    size_t slot_size;                     /// Bytes per slot (slot header and element).
+    uint64_t head;                        /// Sequence number of the next inserted element.
+    uint64_t tail;                        /// Sequence number of the oldest element.
+    uint64_t generation;                  /// Generation of the last written header copy.
+    uint64_t synced_ms;                   /// Monotonic time of the last flush (periodic policy).
+    ring_buffer_file_recovery_e recovery; /// How RING_BUFFER_FILE_Open restored the state.
+} ring_buffer_file_t;
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Opens a persistent ring buffer, creating the file or re-attaching to the state it holds.
+ *
+ * The newest header copy with a valid CRC gives head and tail in O(1). Elements inserted after that header was written
+ * are picked up by checking the slot at the head. When both copies are torn, every slot is scanned and the longest run
+ * of valid slots ending at the newest sequence number becomes the content, so elements retrieved since the last
+ * header may be delivered again.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be initialized.
+ * @param[in] conf The configuration structure (path, element size, number of elements and msync policy).
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Ring buffer opened, see rb->recovery for how
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid configuration, a file size that does not fit into size_t,
+ *           or a file with another geometry
+ *         - RING_BUFFER_STATUS_ERROR: The file could not be opened, sized or mapped
+ */
+ring_buffer_status_e RING_BUFFER_FILE_Open(ring_buffer_file_t *rb, ring_buffer_file_conf_t conf);
+
+/**
+ * @brief Closes a persistent ring buffer (flushes the mapping first unless the policy is RING_BUFFER_FILE_SYNC_NONE).
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be closed.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Ring buffer closed
+ */
+ring_buffer_status_e RING_BUFFER_FILE_Close(ring_buffer_file_t *rb);
+
+/**
+ * @brief Inserts data into the persistent ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to the data to be inserted into the buffer.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available
+ *         - RING_BUFFER_STATUS_ERROR: The flush of the msync policy failed (the data is in the ring buffer)
+ */
+ring_buffer_status_e RING_BUFFER_FILE_Insert(ring_buffer_file_t *rb, const void *data);
+
+/**
+ * @brief Retrieves data from the persistent ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer where the retrieved data will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ *         - RING_BUFFER_STATUS_ERROR: The flush of the msync policy failed (the data was retrieved), or the slot
+ *           was corrupted (see RING_BUFFER_FILE_RetrieveMany)
+ */
+ring_buffer_status_e RING_BUFFER_FILE_Retrieve(ring_buffer_file_t *rb, void *data);
+
+/**
+ * @brief Inserts up to n elements into the persistent ring buffer as one batch (one header update and flush).
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to n consecutive elements to be inserted into the buffer.
+ * @param[in] n The number of elements to insert.
+ * @param[out] written A pointer to a variable where the number of inserted elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully inserted (see written for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space for any element
+ *         - RING_BUFFER_STATUS_ERROR: The flush of the msync policy failed (the data is in the ring buffer)
+ */
+ring_buffer_status_e RING_BUFFER_FILE_InsertMany(ring_buffer_file_t *rb, const void *data, size_t n, size_t *written);
+
+/**
+ * @brief Retrieves up to n elements from the persistent ring buffer as one batch (one header update and flush).
+ *
+ * Every slot is checked against its sequence number and CRC before it is copied. Like the recovery in
+ * RING_BUFFER_FILE_Open, the ring ends at the first slot that fails the check: the intact elements before it are
+ * retrieved, the slot and everything after it is dropped. The dropped slots are invalidated before the header is
+ * committed, so a later recovery scan does not bring them back.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer with room for n elements where the retrieved data will be stored.
+ * @param[in] n The maximum number of elements to retrieve.
+ * @param[out] read A pointer to a variable where the number of retrieved elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully retrieved (see read for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ *         - RING_BUFFER_STATUS_ERROR: The flush of the msync policy failed (the data was retrieved), or a corrupted
+ *           slot was found (see read for the intact elements retrieved before it)
+ */
+ring_buffer_status_e RING_BUFFER_FILE_RetrieveMany(ring_buffer_file_t *rb, void *data, size_t n, size_t *read);
+
+/**
+ * @brief Gets the number of elements currently in the persistent ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to check.
+ * @param[out] result A pointer to a variable where the number of elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The number of elements was successfully retrieved.
+ */
+ring_buffer_status_e RING_BUFFER_FILE_GetCount(ring_buffer_file_t *rb, size_t *result);
+
+/**
+ * @brief Flushes the whole mapping to the file now, independent of the msync policy.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to flush.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Mapping written to the file
+ *         - RING_BUFFER_STATUS_ERROR: msync failed
+ */
+ring_buffer_status_e RING_BUFFER_FILE_Sync(ring_buffer_file_t *rb);
+
+#endif /* defined(__linux__) */
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_FILE_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
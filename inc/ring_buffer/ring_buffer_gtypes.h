@@ -1,73 +1,158 @@
-/***********************************************************************************************************************
- *
- * @file        ring_buffer_gtypes.h
- * @brief       The component RING-BUFFER global types separate to main files to include for defines.
- * @author      Blaz Baskovc
- * @copyright   Copyright 2025 Blaz Baskovc
- * @date        2025-02-24
- *
- **********************************************************************************************************************/
-
-#ifndef RING_BUFFER_GTYPES_H
-#define RING_BUFFER_GTYPES_H
-
-// C++ wrapper - Start
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-// --- Includes --------------------------------------------------------------------------------------------------------
-
-#include <stdbool.h>
-#include <stdint.h>
-#include <stddef.h>
-
-// --- Public Types Prototypes -----------------------------------------------------------------------------------------
-
-/**
- * @brief   Enumeration representing the response status of a function.
- */
-typedef enum
-{
-    RING_BUFFER_STATUS_OK = 0u,
-    RING_BUFFER_STATUS_ERROR,
-    RING_BUFFER_STATUS_ERROR_INPUT_ARGS,
-    RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED,
-    RING_BUFFER_STATUS_ERROR_INVALID_INDEX,
-    RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY,
-    RING_BUFFER_STATUS_ERROR_BUFFER_FULL,
-    RING_BUFFER_STATUS_ERROR_OVERFLOW,
-    RING_BUFFER_STATUS_MAX
-} ring_buffer_status_e;
-
-/**
- * @brief   Structure representing a ring buffer configurations.
- */
-typedef struct
-{
-    uint8_t *buffer;     /// Pointer to the ring buffer memory.
-    size_t buffer_size;  /// Number of bytes in the buffer.
-    size_t element_size; /// Size of one element in bytes.
-    bool overwrite;      /// Enable inserting new elements even if full.
-} ring_buffer_conf_t;
-
-/**
- * @brief   Structure representing a ring buffer object.
- */
-typedef struct
-{
-    ring_buffer_conf_t conf; /// Ring Buffer configurations.
-    size_t head;             /// Index for the next write operation.
-    size_t tail;             /// Index for the next read operation.
-    size_t count;            /// Number of elements currently in the buffer.
-    size_t max_elements;     /// Maximum number of elements that fit in the buffer.
-} ring_buffer_t;
-
-// C++ wrapper - End
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* RING_BUFFER_GTYPES_H */
-
-// --- EOF -------------------------------------------------------------------------------------------------------------
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_gtypes.h
+ * @brief       The component RING-BUFFER global types separate to main files to include for defines.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-02-24
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_GTYPES_H
+#define RING_BUFFER_GTYPES_H
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Enumeration representing the response status of a function.
+ */
+typedef enum
+{
+    RING_BUFFER_STATUS_OK = 0u,
+    RING_BUFFER_STATUS_ERROR,
+    RING_BUFFER_STATUS_ERROR_INPUT_ARGS,
+    RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED,
+    RING_BUFFER_STATUS_ERROR_INVALID_INDEX,
+    RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY,
+    RING_BUFFER_STATUS_ERROR_BUFFER_FULL,
+    RING_BUFFER_STATUS_ERROR_OVERFLOW,
+    RING_BUFFER_STATUS_MAX
+} ring_buffer_status_e;
+
+/**
+ * @brief   Structure representing a lock hook (see ring_buffer_lock.h for the pthread and FreeRTOS backends).
+ *
+ * A hook with a NULL lock function is not used, so a zeroed configuration keeps the buffer lock-free for single
+ * threaded use.
+ */
+typedef struct
+{
+    void (*lock)(void *ctx);   /// Takes the lock (blocking).
+    void (*unlock)(void *ctx); /// Releases the lock.
+    void *ctx;                 /// Context passed to both functions (mutex handle).
+} ring_buffer_lock_t;
+
+/**
+ * @brief   Callback of RING_BUFFER_ForEach, gets one stored element in place (return false to stop).
+ */
+typedef bool (*ring_buffer_visit_fn_t)(const void *element, void *ctx);
+
+/**
+ * @brief   Callback of RING_BUFFER_MapInPlace, may modify one stored element in place (return false to stop).
+ */
+typedef bool (*ring_buffer_map_fn_t)(void *element, void *ctx);
+
+/**
+ * @brief   Callback of RING_BUFFER_ForEachSegment, gets a contiguous run of n stored elements (return false to stop).
+ */
+typedef bool (*ring_buffer_segment_fn_t)(void *elements, size_t n, void *ctx);
+
+/**
+ * @brief   Enumeration representing how the wait functions wait for elements or free space.
+ */
+typedef enum
+{
+    RING_BUFFER_WAIT_PARK = 0u,  /// Sleep on a futex right away (lowest CPU usage).
+    RING_BUFFER_WAIT_SPIN,       /// Busy-spin with the CPU pause hint until the deadline (isolated cores).
+    RING_BUFFER_WAIT_SPIN_YIELD, /// Spin a bounded number of pauses, then call sched_yield between retries.
+    RING_BUFFER_WAIT_SPIN_PARK,  /// Spin with exponential backoff up to the spin budget, then sleep on a futex.
+    RING_BUFFER_WAIT_MAX
+} ring_buffer_wait_e;
+
+/**
+ * @brief   Enumeration representing the eventfd notifiers of a ring buffer.
+ */
+typedef enum
+{
+    RING_BUFFER_NOTIFY_DATA = 0u, /// Signalled when the buffer goes from empty to non-empty (for the consumer).
+    RING_BUFFER_NOTIFY_SPACE,     /// Signalled when the buffer goes from full to not full (for the producer).
+    RING_BUFFER_NOTIFY_MAX
+} ring_buffer_notify_e;
+
+/**
+ * @brief   Structure representing a wait strategy of the wait functions.
+ */
+typedef struct
+{
+    ring_buffer_wait_e strategy; /// Wait strategy.
+    uint32_t spin;               /// Pause budget before yielding / sleeping (0 uses RING_BUFFER_CONF_WAIT_SPIN).
+} ring_buffer_wait_t;
+
+/**
+ * @brief   Structure representing a ring buffer configurations.
+ */
+typedef struct
+{
+    uint8_t *buffer;                  /// Pointer to the ring buffer memory.
+    size_t buffer_size;               /// Number of bytes in the buffer.
+    size_t element_size;              /// Size of one element in bytes.
+    bool overwrite;                   /// Enable inserting new elements even if full.
+    bool power_of_two;                /// Use free-running element indices with mask indexing (power-of-two count).
+    ring_buffer_lock_t producer_lock; /// Lock serializing inserting threads (optional).
+    ring_buffer_lock_t consumer_lock; /// Lock serializing retrieving threads (optional).
+    ring_buffer_wait_t wait;          /// Wait strategy of the wait functions (zeroed sleeps right away).
+    bool mirrored;                    /// Buffer is mapped twice back to back (set by RING_BUFFER_MirrorAlloc only).
+    bool records;                     /// Byte-stream record mode (RING_BUFFER_InsertRecord), element_size ignored.
+} ring_buffer_conf_t;
+
+/**
+ * @brief   Structure representing a ring buffer object.
+ */
+typedef struct
+{
+    ring_buffer_conf_t conf; /// Ring Buffer configurations.
+    size_t head;             /// Index for the next write operation.
+    size_t tail;             /// Index for the next read operation.
+    size_t count;            /// Number of elements currently in the buffer.
+    size_t max_elements;     /// Maximum number of elements that fit in the buffer.
+    size_t mask;             /// Element index mask (power-of-two mode only).
+    size_t element_shift;    /// Shift replacing the multiply by element size (power-of-two mode only).
+    bool element_shift_use;  /// Element size is a power of two and element_shift is used.
+    size_t reserved;         /// Elements reserved by RING_BUFFER_ReserveWrite and not committed yet.
+    bool reserve_locked;     /// RING_BUFFER_ReserveWrite also holds the consumer lock (reservation evicts).
+    bool reserve_active;     /// A reservation is open and RING_BUFFER_CommitWrite may end it.
+    size_t peeked;           /// Elements exposed by RING_BUFFER_PeekSpans and not consumed yet.
+    bool peek_active;        /// RING_BUFFER_PeekSpans succeeded and RING_BUFFER_Consume has not ended it yet.
+    bool shared;             /// Lock hooks are configured, count is updated atomically.
+    uint32_t data_seq;       /// Futex word bumped when elements are published to parked consumers.
+    uint32_t data_waiters;   /// Number of consumers parked in a wait function.
+    uint32_t space_seq;      /// Futex word bumped when elements are freed for parked producers.
+    uint32_t space_waiters;  /// Number of producers parked in a wait function.
+    bool notify;             /// Eventfd notifiers are created by RING_BUFFER_NotifyInit.
+    int data_fd;             /// Eventfd signalled when the buffer goes from empty to non-empty.
+    uint32_t data_armed;     /// Data notifier may signal its next edge (cleared when it signals, set by the ack).
+    int space_fd;            /// Eventfd signalled when the buffer goes from full to not full.
+    uint32_t space_armed;    /// Space notifier may signal its next edge (cleared when it signals, set by the ack).
+    size_t drain_partial;    /// Bytes of the oldest element RING_BUFFER_DrainToFd has written so far.
+    size_t fill_partial;     /// Bytes of the next element RING_BUFFER_FillFromFd has read so far.
+} ring_buffer_t;
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_GTYPES_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
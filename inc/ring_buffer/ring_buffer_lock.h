@@ -0,0 +1,101 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_lock.h
+ * @brief       The component RING-BUFFER lock hook backends. A backend fills a ring_buffer_lock_t that is set as the
+ *              producer_lock or consumer_lock of ring_buffer_conf_t. Inserting threads only take the producer lock
+ *              and retrieving threads only the consumer lock, so an insert and a retrieve never wait for each other.
+ *              - RING_BUFFER_CONF_PTHREAD_USE: POSIX threads mutex
+ *              - RING_BUFFER_CONF_FREERTOS_USE: FreeRTOS mutex semaphore
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-22
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_LOCK_H
+#define RING_BUFFER_LOCK_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+
+#if __has_include("ring_buffer_conf.h")
+#include "ring_buffer_conf.h"
+#endif /* __has_include("ring_buffer_conf.h") */
+
+#ifdef RING_BUFFER_CONF_PTHREAD_USE
+#if (true == RING_BUFFER_CONF_PTHREAD_USE)
+
+#include <pthread.h>
+
+#endif /* (true == RING_BUFFER_CONF_PTHREAD_USE) */
+#endif /* RING_BUFFER_CONF_PTHREAD_USE */
+
+#ifdef RING_BUFFER_CONF_FREERTOS_USE
+#if (true == RING_BUFFER_CONF_FREERTOS_USE)
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#endif /* (true == RING_BUFFER_CONF_FREERTOS_USE) */
+#endif /* RING_BUFFER_CONF_FREERTOS_USE */
+
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+#ifdef RING_BUFFER_CONF_PTHREAD_USE
+#if (true == RING_BUFFER_CONF_PTHREAD_USE)
+
+/**
+ * @brief Fills a lock hook backed by a POSIX threads mutex.
+ *
+ * The mutex is owned by the caller and must stay valid while the ring buffer uses the hook.
+ *
+ * @param[out] lock A pointer to the lock hook to be filled.
+ * @param[in] mutex A pointer to an initialized mutex.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Lock hook successfully filled
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid arguments
+ */
+ring_buffer_status_e RING_BUFFER_LOCK_Pthread(ring_buffer_lock_t *lock, pthread_mutex_t *mutex);
+
+#endif /* (true == RING_BUFFER_CONF_PTHREAD_USE) */
+#endif /* RING_BUFFER_CONF_PTHREAD_USE */
+
+#ifdef RING_BUFFER_CONF_FREERTOS_USE
+#if (true == RING_BUFFER_CONF_FREERTOS_USE)
+
+/**
+ * @brief Fills a lock hook backed by a FreeRTOS mutex semaphore (not usable from interrupts).
+ *
+ * The semaphore is owned by the caller (xSemaphoreCreateMutex) and must stay valid while the ring buffer uses the
+ * hook. The lock waits forever (portMAX_DELAY).
+ *
+ * @param[out] lock A pointer to the lock hook to be filled.
+ * @param[in] mutex Handle of the mutex semaphore.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Lock hook successfully filled
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid arguments
+ */
+ring_buffer_status_e RING_BUFFER_LOCK_FreeRtos(ring_buffer_lock_t *lock, SemaphoreHandle_t mutex);
+
+#endif /* (true == RING_BUFFER_CONF_FREERTOS_USE) */
+#endif /* RING_BUFFER_CONF_FREERTOS_USE */
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_LOCK_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,135 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_mpmc.h
+ * @brief       The component RING-BUFFER lock-free multi-producer / multi-consumer variant. Every slot carries a
+ *              sequence number telling whether it is free for the producer of a given lap or filled for its consumer,
+ *              so producers claim a slot with one CAS on the head and consumers with one CAS on the tail. Slots are
+ *              padded to whole cache lines.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-20
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_MPMC_H
+#define RING_BUFFER_MPMC_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ring_buffer/ring_buffer_atomic.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Public Macros ---------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Size of one slot (sequence number and element, rounded up to whole cache lines).
+ * @param   element_size Size of one element in bytes.
+ */
+#define RING_BUFFER_MPMC_SLOT_SIZE(element_size)                                                                       \
+    (((sizeof(size_t) + (element_size) + RING_BUFFER_CONF_CACHE_LINE_SIZE - 1) / RING_BUFFER_CONF_CACHE_LINE_SIZE) *   \
+     RING_BUFFER_CONF_CACHE_LINE_SIZE)
+
+/**
+ * @brief   Buffer size needed for a number of elements.
+ * @param   element_size Size of one element in bytes.
+ * @param   elements Number of elements (power of two).
+ */
+#define RING_BUFFER_MPMC_BUFFER_SIZE(element_size, elements) (RING_BUFFER_MPMC_SLOT_SIZE(element_size) * (elements))
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Structure representing a multi-producer / multi-consumer ring buffer object.
+ *
+ * The buffer holds the largest power-of-two number of slots of RING_BUFFER_MPMC_SLOT_SIZE(element_size) bytes that
+ * fits into it, and must be aligned at least to size_t (a cache line aligned buffer avoids false sharing completely).
+ */
+typedef struct
+{
+    ring_buffer_conf_t conf;                                   /// Ring Buffer configurations (overwrite not supported).
+    size_t max_elements;                                       /// Number of slots (power of two).
+    size_t mask;                                               /// Slot index mask.
+    size_t slot_size;                                          /// Bytes per slot.
+    RING_BUFFER_CACHE_ALIGNED RING_BUFFER_ATOMIC(size_t) head; /// Next position claimed by a producer.
+    RING_BUFFER_CACHE_ALIGNED RING_BUFFER_ATOMIC(size_t) tail; /// Next position claimed by a consumer.
+} ring_buffer_mpmc_t;
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes a multi-producer / multi-consumer ring buffer with the given configuration.
+ *
+ * Must be called before any thread starts using the ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be initialized.
+ * @param[in] conf The configuration structure containing parameters for the buffer (overwrite must be disabled).
+ *
+ * @return ring_buffer_status_e Status of the initialization:
+ *         - RING_BUFFER_STATUS_OK: Successful initialization
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid configuration, unaligned buffer or overwrite enabled
+ */
+ring_buffer_status_e RING_BUFFER_MPMC_Init(ring_buffer_mpmc_t *rb, ring_buffer_conf_t conf);
+
+/**
+ * @brief Deinitialize a multi-producer / multi-consumer ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be deinitialize.
+ *
+ * @return ring_buffer_status_e Status of the deinitialization:
+ *         - RING_BUFFER_STATUS_OK: Successful deinitialization
+ */
+ring_buffer_status_e RING_BUFFER_MPMC_DeInit(ring_buffer_mpmc_t *rb);
+
+/**
+ * @brief Inserts data into the ring buffer (any number of producer threads).
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to the data to be inserted into the buffer.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available
+ */
+ring_buffer_status_e RING_BUFFER_MPMC_Insert(ring_buffer_mpmc_t *rb, const void *data);
+
+/**
+ * @brief Retrieves data from the ring buffer (any number of consumer threads).
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer where the retrieved data will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ */
+ring_buffer_status_e RING_BUFFER_MPMC_Retrieve(ring_buffer_mpmc_t *rb, void *data);
+
+/**
+ * @brief Gets the number of claimed elements in the ring buffer.
+ *
+ * The value is a snapshot, other threads may change it right after the call.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to check.
+ * @param[out] result A pointer to a variable where the number of elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The number of elements was successfully retrieved.
+ */
+ring_buffer_status_e RING_BUFFER_MPMC_GetCount(ring_buffer_mpmc_t *rb, size_t *result);
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_MPMC_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,139 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_mpsc.h
+ * @brief       The component RING-BUFFER wait-free multi-producer / single-consumer variant for fan-in of log and
+ *              telemetry records into one drain thread. Producers take a free-slot credit and claim a position with a
+ *              single fetch-add each (no retry loops), then publish a per-slot ready flag. The consumer drains the
+ *              contiguous run of ready slots in one batch, reading only the flags and returning the credits once per
+ *              batch.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-21
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_MPSC_H
+#define RING_BUFFER_MPSC_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ring_buffer/ring_buffer_atomic.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Public Macros ---------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Buffer size needed for a number of elements (ready flags followed by the element data).
+ * @param   element_size Size of one element in bytes.
+ * @param   elements Number of elements (power of two).
+ */
+#define RING_BUFFER_MPSC_BUFFER_SIZE(element_size, elements) ((sizeof(size_t) + (element_size)) * (elements))
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Structure representing a multi-producer / single-consumer ring buffer object.
+ *
+ * The buffer holds the ready flags of all slots followed by the element data, for the largest power-of-two number of
+ * elements that fits into it. It must be aligned at least to size_t.
+ */
+typedef struct
+{
+    ring_buffer_conf_t conf;                                        /// Ring Buffer configurations (no overwrite).
+    size_t max_elements;                                            /// Number of slots (power of two).
+    size_t mask;                                                    /// Slot index mask.
+    RING_BUFFER_ATOMIC(size_t) * flags;                             /// Ready flags (position + 1 once published).
+    uint8_t *data;                                                  /// Element data area.
+    RING_BUFFER_CACHE_ALIGNED RING_BUFFER_ATOMIC(size_t) head;      /// Next position claimed by a producer.
+    RING_BUFFER_ATOMIC(ptrdiff_t) credits;                          /// Free slots not taken, briefly negative on full.
+    RING_BUFFER_CACHE_ALIGNED size_t tail;                          /// Next position read by the consumer.
+} ring_buffer_mpsc_t;
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes a multi-producer / single-consumer ring buffer with the given configuration.
+ *
+ * Must be called before any thread starts using the ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be initialized.
+ * @param[in] conf The configuration structure containing parameters for the buffer (overwrite must be disabled).
+ *
+ * @return ring_buffer_status_e Status of the initialization:
+ *         - RING_BUFFER_STATUS_OK: Successful initialization
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid configuration, unaligned buffer or overwrite enabled
+ */
+ring_buffer_status_e RING_BUFFER_MPSC_Init(ring_buffer_mpsc_t *rb, ring_buffer_conf_t conf);
+
+/**
+ * @brief Deinitialize a multi-producer / single-consumer ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be deinitialize.
+ *
+ * @return ring_buffer_status_e Status of the deinitialization:
+ *         - RING_BUFFER_STATUS_OK: Successful deinitialization
+ */
+ring_buffer_status_e RING_BUFFER_MPSC_DeInit(ring_buffer_mpsc_t *rb);
+
+/**
+ * @brief Inserts data into the ring buffer (any number of producer threads, wait-free).
+ *
+ * A producer takes a free-slot credit with a fetch-sub and, when none was left, gives it back with a fetch-add before
+ * returning RING_BUFFER_STATUS_ERROR_BUFFER_FULL. Until it has given it back the credits may read negative, so another
+ * producer can also get RING_BUFFER_STATUS_ERROR_BUFFER_FULL although the consumer has just freed a slot. Such a
+ * spurious full is transient, a retry succeeds once the failing producers have returned their credits.
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to the data to be inserted into the buffer.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available
+ */
+ring_buffer_status_e RING_BUFFER_MPSC_Insert(ring_buffer_mpsc_t *rb, const void *data);
+
+/**
+ * @brief Retrieves one element from the ring buffer (consumer thread only).
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer where the retrieved data will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The oldest element is not published yet
+ */
+ring_buffer_status_e RING_BUFFER_MPSC_Retrieve(ring_buffer_mpsc_t *rb, void *data);
+
+/**
+ * @brief Drains the contiguous run of published elements from the ring buffer (consumer thread only).
+ *
+ * Retrieval stops at the first slot whose producer has claimed it but not published it yet, so elements are always
+ * delivered in position order.
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer with room for n elements where the retrieved data will be stored.
+ * @param[in] n The maximum number of elements to retrieve.
+ * @param[out] read A pointer to a variable where the number of retrieved elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully retrieved (see read for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The oldest element is not published yet
+ */
+ring_buffer_status_e RING_BUFFER_MPSC_RetrieveMany(ring_buffer_mpsc_t *rb, void *data, size_t n, size_t *read);
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_MPSC_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
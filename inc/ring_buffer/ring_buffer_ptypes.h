@@ -1,96 +1,263 @@
-/***********************************************************************************************************************
- *
- * @file        ring_buffer_ptypes.h
- * @brief       The component RING-BUFFER private types (do not use it outside of component).
- * @author      Blaz Baskovc
- * @copyright   Copyright 2025 Blaz Baskovc
- * @date        2025-02-17
- *
- **********************************************************************************************************************/
-
-#ifndef RING_BUFFER_PTYPES_H
-#define RING_BUFFER_PTYPES_H
-
-// C++ wrapper - Start
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-// --- Includes --------------------------------------------------------------------------------------------------------
-
-#include <stdbool.h>
-#include <stddef.h>
-
-// --- Private Macros --------------------------------------------------------------------------------------------------
-
-/**
- * @brief   Macro to check for a NULL pointer and execute an action if the pointer is NULL.
- * @param   ptr Pointer to be checked for NULL.
- * @param   action Action to be executed if the pointer is NULL.
- */
-#define CHECK_ARGS_NULL_PTR(ptr, action)                                                                               \
-    if (NULL == ptr)                                                                                                   \
-    {                                                                                                                  \
-        return action;                                                                                                 \
-    }
-
-/**
- * @brief   Macro to check for a NULL pointer and execute an action if the pointer is NULL.
- * @param   value Value of size_t to be checked for 0.
- * @param   action Action to be executed if the size is 0.
- */
-#define CHECK_ARGS_SIZE(value, check, action)                                                                          \
-    if (check == value)                                                                                                \
-    {                                                                                                                  \
-        return action;                                                                                                 \
-    }
-
-/**
- * @brief   Set destination memory buffer to byte value.
- * @param   dst Destination buffer.
- * @param   val Overwrite value.
- * @param   len Buffer length.
- */
-#define MEMSET(dst, val, len)                                                                                          \
-    do                                                                                                                 \
-    {                                                                                                                  \
-        uint8_t *_dstp = (uint8_t *)(dst);                                                                             \
-        if (_dstp != NULL)                                                                                             \
-        {                                                                                                              \
-            for (size_t _i = 0; _i < (len); _i++)                                                                      \
-            {                                                                                                          \
-                _dstp[_i] = (uint8_t)(val);                                                                            \
-            }                                                                                                          \
-        }                                                                                                              \
-    } while (0)
-
-/**
- * @brief   Macro to copy a block of memory from a source to a destination.
- * @param   dst Destination memory block where the data will be copied.
- * @param   src Source memory block to copy the data from.
- * @param   len Number of bytes to copy.
- */
-#define MEMCPY(dst, src, len)                                                                                          \
-    do                                                                                                                 \
-    {                                                                                                                  \
-        const uint8_t *_srcp = (uint8_t *)(src);                                                                       \
-        uint8_t *_dstp = (uint8_t *)(dst);                                                                             \
-        if ((_srcp != NULL) && (_dstp != NULL))                                                                        \
-        {                                                                                                              \
-            for (size_t _i = 0; _i < (len); _i++)                                                                      \
-            {                                                                                                          \
-                _dstp[_i] = _srcp[_i];                                                                                 \
-            }                                                                                                          \
-        }                                                                                                              \
-    } while (0)
-
-// --- Private Types Prototypes ----------------------------------------------------------------------------------------
-
-// C++ wrapper - End
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* RING_BUFFER_PTYPES_H */
-
-// --- EOF -------------------------------------------------------------------------------------------------------------
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_ptypes.h
+ * @brief       The component RING-BUFFER private types (do not use it outside of component).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-02-17
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_PTYPES_H
+#define RING_BUFFER_PTYPES_H
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if __STDC_HOSTED__
+#include <string.h>
+#endif /* __STDC_HOSTED__ */
+
+#if __has_include("ring_buffer_conf.h")
+#include "ring_buffer_conf.h"
+#endif /* __has_include("ring_buffer_conf.h") */
+
+#include "ring_buffer/ring_buffer_copy.h"
+
+// --- Private Macros --------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Macro to check for a NULL pointer and execute an action if the pointer is NULL.
+ * @param   ptr Pointer to be checked for NULL.
+ * @param   action Action to be executed if the pointer is NULL.
+ */
+#define CHECK_ARGS_NULL_PTR(ptr, action)                                                                               \
+    if (NULL == ptr)                                                                                                   \
+    {                                                                                                                  \
+        return action;                                                                                                 \
+    }
+
+/**
+ * @brief   Macro to check for a NULL pointer and execute an action if the pointer is NULL.
+ * @param   value Value of size_t to be checked for 0.
+ * @param   action Action to be executed if the size is 0.
+ */
+#define CHECK_ARGS_SIZE(value, check, action)                                                                          \
+    if (check == value)                                                                                                \
+    {                                                                                                                  \
+        return action;                                                                                                 \
+    }
+
+/**
+ * @brief   Copy kernel used by the component, selected with RING_BUFFER_CONF_COPY_KERNEL (libc when hosted, otherwise
+ *          the portable byte loop).
+ */
+#ifndef RING_BUFFER_CONF_COPY_KERNEL
+#if __STDC_HOSTED__
+#define RING_BUFFER_CONF_COPY_KERNEL RING_BUFFER_COPY_KERNEL_LIBC
+#else
+#define RING_BUFFER_CONF_COPY_KERNEL RING_BUFFER_COPY_KERNEL_LOOP
+#endif /* __STDC_HOSTED__ */
+#endif /* RING_BUFFER_CONF_COPY_KERNEL */
+
+#if ((RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_SSE2) ||                                                 \
+     (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AVX2)) &&                                                \
+    !defined(RING_BUFFER_COPY_X86_64)
+#error "RING_BUFFER_CONF_COPY_KERNEL: SSE2 / AVX2 kernels need an x86-64 target built with GCC or Clang"
+#endif /* SSE2 / AVX2 kernel on a target without them */
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_LIBC)
+#define RING_BUFFER_COPY_KERNEL(dst, src, len) memcpy((dst), (src), (len))
+#define RING_BUFFER_SET_KERNEL(dst, val, len)  memset((dst), (val), (len))
+#elif (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_WORD)
+#define RING_BUFFER_COPY_KERNEL(dst, src, len) RING_BUFFER_CopyWord((dst), (src), (len))
+#define RING_BUFFER_SET_KERNEL(dst, val, len)  RING_BUFFER_SetWord((dst), (uint8_t)(val), (len))
+#elif (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_SSE2)
+#define RING_BUFFER_COPY_KERNEL(dst, src, len) RING_BUFFER_CopySse2((dst), (src), (len))
+#define RING_BUFFER_SET_KERNEL(dst, val, len)  RING_BUFFER_SetWord((dst), (uint8_t)(val), (len))
+#elif (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AVX2)
+#define RING_BUFFER_COPY_KERNEL(dst, src, len) RING_BUFFER_CopyAvx2((dst), (src), (len))
+#define RING_BUFFER_SET_KERNEL(dst, val, len)  RING_BUFFER_SetWord((dst), (uint8_t)(val), (len))
+#elif (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+#define RING_BUFFER_COPY_KERNEL(dst, src, len) RING_BUFFER_CopyAuto((dst), (src), (len))
+#define RING_BUFFER_SET_KERNEL(dst, val, len)  RING_BUFFER_SetWord((dst), (uint8_t)(val), (len))
+#else
+#define RING_BUFFER_COPY_KERNEL(dst, src, len) RING_BUFFER_CopyLoop((dst), (src), (len))
+#define RING_BUFFER_SET_KERNEL(dst, val, len)  RING_BUFFER_SetLoop((dst), (uint8_t)(val), (len))
+#endif /* RING_BUFFER_CONF_COPY_KERNEL */
+
+/**
+ * @brief   Set destination memory buffer to byte value.
+ * @param   dst Destination buffer.
+ * @param   val Overwrite value.
+ * @param   len Buffer length.
+ */
+#define MEMSET(dst, val, len)                                                                                          \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        uint8_t *_dstp = (uint8_t *)(dst);                                                                             \
+        if (_dstp != NULL)                                                                                             \
+        {                                                                                                              \
+            RING_BUFFER_SET_KERNEL(_dstp, (val), (len));                                                               \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief   Macro to copy a block of memory from a source to a destination.
+ * @param   dst Destination memory block where the data will be copied.
+ * @param   src Source memory block to copy the data from.
+ * @param   len Number of bytes to copy.
+ */
+#define MEMCPY(dst, src, len)                                                                                          \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        const uint8_t *_srcp = (const uint8_t *)(src);                                                                 \
+        uint8_t *_dstp = (uint8_t *)(dst);                                                                             \
+        if ((_srcp != NULL) && (_dstp != NULL))                                                                        \
+        {                                                                                                              \
+            RING_BUFFER_COPY_KERNEL(_dstp, _srcp, (len));                                                              \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief   Memory barrier ordering element data written in place before the head / count update that publishes it.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define RING_BUFFER_RELEASE_FENCE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+#define RING_BUFFER_RELEASE_FENCE()
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+/**
+ * @brief   Atomic access to a size_t shared between the producer and the consumer side (count with split locks).
+ *          Updates are sequentially consistent so they pair with the waiter registration of the wait functions.
+ * @param   ptr Pointer to the value.
+ * @param   value Value to add / subtract.
+ * @return  Value before the update (ADD / SUB).
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define RING_BUFFER_ATOMIC_LOAD(ptr)       __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define RING_BUFFER_ATOMIC_ADD(ptr, value) __atomic_fetch_add((ptr), (value), __ATOMIC_SEQ_CST)
+#define RING_BUFFER_ATOMIC_SUB(ptr, value) __atomic_fetch_sub((ptr), (value), __ATOMIC_SEQ_CST)
+#else
+#define RING_BUFFER_ATOMIC_LOAD(ptr)       (*(ptr))
+#define RING_BUFFER_ATOMIC_ADD(ptr, value) ((*(ptr) += (value)) - (value))
+#define RING_BUFFER_ATOMIC_SUB(ptr, value) ((*(ptr) -= (value)) + (value))
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+/**
+ * @brief   CPU hint used inside busy-wait loops (lets the sibling hyper-thread run and saves power).
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define RING_BUFFER_CPU_PAUSE() __builtin_ia32_pause()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || defined(__arm__))
+#define RING_BUFFER_CPU_PAUSE() __asm__ __volatile__("yield" ::: "memory")
+#else
+#define RING_BUFFER_CPU_PAUSE()
+#endif /* CPU pause hint */
+
+/**
+ * @brief   Default pause budget of the spinning wait strategies (ring_buffer_wait_t.spin set to 0).
+ */
+#ifndef RING_BUFFER_CONF_WAIT_SPIN
+#define RING_BUFFER_CONF_WAIT_SPIN 256
+#endif /* RING_BUFFER_CONF_WAIT_SPIN */
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Number of elements between the tail and the head position of a ring with positions in [0, limit).
+ * @param   limit Position wrap limit (2 * max_elements).
+ * @param   head Head position.
+ * @param   tail Tail position.
+ * @return  Number of elements.
+ */
+static inline size_t RING_BUFFER_PosUsed(size_t limit, size_t head, size_t tail)
+{
+    return (head >= tail) ? (head - tail) : (head + limit - tail);
+}
+
+/**
+ * @brief   Moves a position forward by up to max_elements elements.
+ * @param   limit Position wrap limit (2 * max_elements).
+ * @param   pos Head / tail position.
+ * @param   elements Number of elements to move forward.
+ * @return  New position.
+ */
+static inline size_t RING_BUFFER_PosNext(size_t limit, size_t pos, size_t elements)
+{
+    pos += elements;
+
+    return (pos >= limit) ? (pos - limit) : pos;
+}
+
+/**
+ * @brief   Copies elements into the storage starting at a position, as at most two copies around the wrap point.
+ * @param   base Element storage.
+ * @param   max_elements Number of element slots in the storage.
+ * @param   element_size Size of one element in bytes.
+ * @param   pos Position of the first element.
+ * @param   src Source elements.
+ * @param   elements Number of elements to copy.
+ */
+static inline void RING_BUFFER_PosCopyIn(uint8_t *base, size_t max_elements, size_t element_size, size_t pos,
+                                         const uint8_t *src, size_t elements)
+{
+    size_t slot = (pos >= max_elements) ? (pos - max_elements) : pos;
+    size_t first = max_elements - slot;
+
+    if (first >= elements)
+    {
+        MEMCPY(base + slot * element_size, src, elements * element_size);
+    }
+    else
+    {
+        MEMCPY(base + slot * element_size, src, first * element_size);
+        MEMCPY(base, src + first * element_size, (elements - first) * element_size);
+    }
+}
+
+/**
+ * @brief   Copies elements out of the storage starting at a position, as at most two copies around the wrap point.
+ * @param   base Element storage.
+ * @param   max_elements Number of element slots in the storage.
+ * @param   element_size Size of one element in bytes.
+ * @param   pos Position of the first element.
+ * @param   dst Destination elements.
+ * @param   elements Number of elements to copy.
+ */
+static inline void RING_BUFFER_PosCopyOut(const uint8_t *base, size_t max_elements, size_t element_size, size_t pos,
+                                          uint8_t *dst, size_t elements)
+{
+    size_t slot = (pos >= max_elements) ? (pos - max_elements) : pos;
+    size_t first = max_elements - slot;
+
+    if (first >= elements)
+    {
+        MEMCPY(dst, base + slot * element_size, elements * element_size);
+    }
+    else
+    {
+        MEMCPY(dst, base + slot * element_size, first * element_size);
+        MEMCPY(dst + first * element_size, base, (elements - first) * element_size);
+    }
+}
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_PTYPES_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
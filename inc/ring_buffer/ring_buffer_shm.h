@@ -0,0 +1,222 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_shm.h
+ * @brief       The component RING-BUFFER shared-memory single-producer / single-consumer variant for passing elements
+ *              between processes (Linux). The control block (configuration, head and tail) and the element storage
+ *              live together in one shm_open or memfd region and refer to each other by offsets only, so every
+ *              process can map the region at its own address. One process creates the region, the other attaches to
+ *              it by name or file descriptor, and from then on elements move without any system call.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-24
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_SHM_H
+#define RING_BUFFER_SHM_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_atomic.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__linux__)
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+#define RING_BUFFER_SHM_MAGIC   (0x52425348U) //< Marks an initialized shared region ("RBSH").
+#define RING_BUFFER_SHM_VERSION (1U)          //< Layout version of the shared control block.
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Control block at the start of a shared region, followed by the element storage at data_offset.
+ *
+ * Positions run from 0 to 2 * max_elements - 1 like in ring_buffer_spsc_t. The magic is published last by the
+ * creator, so an attaching process never sees a half initialized block.
+ */
+typedef struct
+{
+    RING_BUFFER_ATOMIC(uint32_t) magic;                        /// RING_BUFFER_SHM_MAGIC once initialized.
+    uint32_t version;                                          /// RING_BUFFER_SHM_VERSION of the creator.
+    size_t element_size;                                       /// Size of one element in bytes.
+    size_t max_elements;                                       /// Maximum number of elements that fit in the region.
+    size_t limit;                                              /// Position wrap limit (2 * max_elements).
+    size_t data_offset;                                        /// Offset of the element storage from the block.
+    size_t region_size;                                        /// Size of the whole region in bytes.
+    RING_BUFFER_CACHE_ALIGNED RING_BUFFER_ATOMIC(size_t) head; /// Next write position, written by the producer.
+    RING_BUFFER_CACHE_ALIGNED RING_BUFFER_ATOMIC(size_t) tail; /// Next read position, written by the consumer.
+} ring_buffer_shm_ctrl_t;
+
+/**
+ * @brief   Structure representing one process' handle to a shared-memory ring buffer.
+ *
+ * Only the handle holds pointers, the shared region itself holds offsets. The geometry is copied from the control
+ * block once it is validated, so a peer rewriting the block later cannot move accesses outside the mapping.
+ */
+typedef struct
+{
+    ring_buffer_shm_ctrl_t *ctrl; /// Control block, mapped at this process' address.
+    uint8_t *data;                /// Element storage, mapped at this process' address.
+    int fd;                       /// Descriptor of the shared region (pass it to another process for memfd).
+    size_t element_size;          /// Validated size of one element in bytes.
+    size_t max_elements;          /// Validated maximum number of elements.
+    size_t limit;                 /// Validated position wrap limit (2 * max_elements).
+    size_t region_size;           /// Size of the mapping in bytes.
+    size_t head_cached;           /// Consumer's last observed head.
+    size_t tail_cached;           /// Producer's last observed tail.
+} ring_buffer_shm_t;
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Creates a shared region with a ring buffer for the given number of elements and maps it.
+ *
+ * @param[in] rb A pointer to the handle to be initialized.
+ * @param[in] name The shm_open name ("/name"), or NULL for an anonymous memfd shared through its descriptor.
+ * @param[in] element_size The size of one element in bytes.
+ * @param[in] elements The number of elements the ring buffer holds.
+ *
+ * @return ring_buffer_status_e Status of the creation:
+ *         - RING_BUFFER_STATUS_OK: Region created, mapped and initialized
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Zero element size or number of elements, or a region too large for
+ *           the address space
+ *         - RING_BUFFER_STATUS_ERROR: The region exists already or could not be created or mapped
+ */
+ring_buffer_status_e RING_BUFFER_SHM_Create(ring_buffer_shm_t *rb, const char *name, size_t element_size,
+                                            size_t elements);
+
+/**
+ * @brief Attaches to a shared region created by RING_BUFFER_SHM_Create under a name.
+ *
+ * @param[in] rb A pointer to the handle to be initialized.
+ * @param[in] name The shm_open name used by the creator.
+ *
+ * @return ring_buffer_status_e Status of the attachment:
+ *         - RING_BUFFER_STATUS_OK: Region mapped and validated
+ *         - RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED: The creator has not finished the initialization yet
+ *         - RING_BUFFER_STATUS_ERROR: The region does not exist, could not be mapped or its control block describes
+ *           another version or a layout outside of the region
+ */
+ring_buffer_status_e RING_BUFFER_SHM_Attach(ring_buffer_shm_t *rb, const char *name);
+
+/**
+ * @brief Attaches to a shared region through a file descriptor (memfd passed over fork or a UNIX socket).
+ *
+ * The descriptor is duplicated, the caller keeps ownership of fd.
+ *
+ * @param[in] rb A pointer to the handle to be initialized.
+ * @param[in] fd The descriptor of the shared region.
+ *
+ * @return ring_buffer_status_e Status of the attachment (see RING_BUFFER_SHM_Attach).
+ */
+ring_buffer_status_e RING_BUFFER_SHM_AttachFd(ring_buffer_shm_t *rb, int fd);
+
+/**
+ * @brief Unmaps the shared region from this process (the region lives on while other processes map it).
+ *
+ * @param[in] rb A pointer to the handle to be detached.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Region unmapped
+ */
+ring_buffer_status_e RING_BUFFER_SHM_Detach(ring_buffer_shm_t *rb);
+
+/**
+ * @brief Removes the name of a shared region, so no further process can attach to it.
+ *
+ * @param[in] name The shm_open name used by the creator.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Name removed
+ *         - RING_BUFFER_STATUS_ERROR: No region with this name
+ */
+ring_buffer_status_e RING_BUFFER_SHM_Unlink(const char *name);
+
+/**
+ * @brief Inserts data into the ring buffer (producer process only).
+ *
+ * @param[in] rb A pointer to the handle of the ring buffer where the data will be inserted.
+ * @param[in] data A pointer to the data to be inserted into the buffer.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available
+ *         - RING_BUFFER_STATUS_ERROR: The shared head and tail describe more elements than the ring holds
+ */
+ring_buffer_status_e RING_BUFFER_SHM_Insert(ring_buffer_shm_t *rb, const void *data);
+
+/**
+ * @brief Retrieves data from the ring buffer (consumer process only).
+ *
+ * @param[in] rb A pointer to the handle of the ring buffer from which data will be retrieved.
+ * @param[out] data A pointer to the buffer where the retrieved data will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ *         - RING_BUFFER_STATUS_ERROR: The shared head and tail describe more elements than the ring holds
+ */
+ring_buffer_status_e RING_BUFFER_SHM_Retrieve(ring_buffer_shm_t *rb, void *data);
+
+/**
+ * @brief Inserts up to n elements into the ring buffer with one head update (producer process only).
+ *
+ * @param[in] rb A pointer to the handle of the ring buffer where the data will be inserted.
+ * @param[in] data A pointer to n consecutive elements to be inserted into the buffer.
+ * @param[in] n The number of elements to insert.
+ * @param[out] written A pointer to a variable where the number of inserted elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully inserted (see written for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space for any element
+ *         - RING_BUFFER_STATUS_ERROR: The shared head and tail describe more elements than the ring holds
+ */
+ring_buffer_status_e RING_BUFFER_SHM_InsertMany(ring_buffer_shm_t *rb, const void *data, size_t n, size_t *written);
+
+/**
+ * @brief Retrieves up to n elements from the ring buffer with one tail update (consumer process only).
+ *
+ * @param[in] rb A pointer to the handle of the ring buffer from which data will be retrieved.
+ * @param[out] data A pointer to the buffer with room for n elements where the retrieved data will be stored.
+ * @param[in] n The maximum number of elements to retrieve.
+ * @param[out] read A pointer to a variable where the number of retrieved elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully retrieved (see read for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ *         - RING_BUFFER_STATUS_ERROR: The shared head and tail describe more elements than the ring holds
+ */
+ring_buffer_status_e RING_BUFFER_SHM_RetrieveMany(ring_buffer_shm_t *rb, void *data, size_t n, size_t *read);
+
+/**
+ * @brief Gets the number of elements currently in the ring buffer (a snapshot).
+ *
+ * @param[in] rb A pointer to the handle of the ring buffer to check.
+ * @param[out] result A pointer to a variable where the number of elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The number of elements was successfully retrieved.
+ *         - RING_BUFFER_STATUS_ERROR: The shared head and tail describe more elements than the ring holds
+ */
+ring_buffer_status_e RING_BUFFER_SHM_GetCount(ring_buffer_shm_t *rb, size_t *result);
+
+#endif /* defined(__linux__) */
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_SHM_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
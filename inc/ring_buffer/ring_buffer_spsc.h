@@ -0,0 +1,153 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_spsc.h
+ * @brief       The component RING-BUFFER lock-free single-producer / single-consumer variant. One thread may insert and
+ *              one other thread may retrieve at the same time without a lock. Head and tail are C11 atomics published
+ *              with release and read with acquire ordering, the element count is derived from them, and each side
+ *              keeps its own index and a cached copy of the opposite index on a separate cache line.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-19
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_SPSC_H
+#define RING_BUFFER_SPSC_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ring_buffer/ring_buffer_atomic.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Index owned by one side of a single-producer / single-consumer ring buffer.
+ */
+typedef struct
+{
+    RING_BUFFER_CACHE_ALIGNED RING_BUFFER_ATOMIC(size_t) index; /// Own position, written only by the owning side.
+    size_t cached;                                              /// Last observed position of the opposite side.
+} ring_buffer_spsc_index_t;
+
+/**
+ * @brief   Structure representing a single-producer / single-consumer ring buffer object.
+ *
+ * Positions run from 0 to 2 * max_elements - 1, so a full and an empty buffer can be told apart without a count.
+ */
+typedef struct
+{
+    ring_buffer_conf_t conf;           /// Ring Buffer configurations (overwrite is not supported).
+    size_t max_elements;               /// Maximum number of elements that fit in the buffer.
+    size_t limit;                      /// Position wrap limit (2 * max_elements).
+    ring_buffer_spsc_index_t producer; /// Head (next write position) and the producer's copy of the tail.
+    ring_buffer_spsc_index_t consumer; /// Tail (next read position) and the consumer's copy of the head.
+} ring_buffer_spsc_t;
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes a single-producer / single-consumer ring buffer with the given configuration.
+ *
+ * Must be called before the producer and consumer threads start using the ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be initialized.
+ * @param[in] conf The configuration structure containing parameters for the buffer (overwrite must be disabled).
+ *
+ * @return ring_buffer_status_e Status of the initialization:
+ *         - RING_BUFFER_STATUS_OK: Successful initialization
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid configuration or overwrite enabled
+ */
+ring_buffer_status_e RING_BUFFER_SPSC_Init(ring_buffer_spsc_t *rb, ring_buffer_conf_t conf);
+
+/**
+ * @brief Deinitialize a single-producer / single-consumer ring buffer.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to be deinitialize.
+ *
+ * @return ring_buffer_status_e Status of the deinitialization:
+ *         - RING_BUFFER_STATUS_OK: Successful deinitialization
+ */
+ring_buffer_status_e RING_BUFFER_SPSC_DeInit(ring_buffer_spsc_t *rb);
+
+/**
+ * @brief Inserts data into the ring buffer (producer thread only).
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to the data to be inserted into the buffer.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Data successfully inserted into the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available
+ */
+ring_buffer_status_e RING_BUFFER_SPSC_Insert(ring_buffer_spsc_t *rb, const void *data);
+
+/**
+ * @brief Retrieves data from the ring buffer (consumer thread only).
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer where the retrieved data will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Data successfully retrieved from the buffer
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ */
+ring_buffer_status_e RING_BUFFER_SPSC_Retrieve(ring_buffer_spsc_t *rb, void *data);
+
+/**
+ * @brief Inserts up to n elements into the ring buffer with one index update (producer thread only).
+ *
+ * @param[in] rb A pointer to the ring buffer structure where the data will be inserted.
+ * @param[in] data A pointer to n consecutive elements to be inserted into the buffer.
+ * @param[in] n The number of elements to insert.
+ * @param[out] written A pointer to a variable where the number of inserted elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully inserted (see written for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space for any element
+ */
+ring_buffer_status_e RING_BUFFER_SPSC_InsertMany(ring_buffer_spsc_t *rb, const void *data, size_t n, size_t *written);
+
+/**
+ * @brief Retrieves up to n elements from the ring buffer with one index update (consumer thread only).
+ *
+ * @param[in] rb A pointer to the ring buffer structure from which data will be retrieved.
+ * @param[out] data A pointer to the buffer with room for n elements where the retrieved data will be stored.
+ * @param[in] n The maximum number of elements to retrieve.
+ * @param[out] read A pointer to a variable where the number of retrieved elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Elements successfully retrieved (see read for the count)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ */
+ring_buffer_status_e RING_BUFFER_SPSC_RetrieveMany(ring_buffer_spsc_t *rb, void *data, size_t n, size_t *read);
+
+/**
+ * @brief Gets the number of elements currently in the ring buffer.
+ *
+ * The value is a snapshot, the other side may change it right after the call.
+ *
+ * @param[in] rb A pointer to the ring buffer structure to check.
+ * @param[out] result A pointer to a variable where the number of elements will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The number of elements was successfully retrieved.
+ */
+ring_buffer_status_e RING_BUFFER_SPSC_GetCount(ring_buffer_spsc_t *rb, size_t *result);
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_SPSC_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
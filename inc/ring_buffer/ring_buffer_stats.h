@@ -0,0 +1,237 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_stats.h
+ * @brief       The component RING-BUFFER sliding-window statistics companion. It keeps the sum, mean and variance of
+ *              the numeric elements stored in a ring buffer up to date as elements are inserted, evicted by an
+ *              overwriting insert, or retrieved, so the statistics of the window cost O(1) per sample instead of a
+ *              pass over the window. The running values are recomputed from the stored elements periodically to bound
+ *              the drift of floating-point updates. Optional monotonic deques track the minimum and maximum of the
+ *              window with O(1) amortized updates.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-27
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_STATS_H
+#define RING_BUFFER_STATS_H
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Public Defines --------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Size of the min / max deque storage (ring_buffer_stats_conf_t.window) for a ring buffer.
+ * @param   elements Maximum number of elements of the ring buffer (max_elements).
+ */
+#define RING_BUFFER_STATS_WINDOW_SIZE(elements) (2u * (elements) * sizeof(ring_buffer_stats_entry_t))
+
+// --- Public Types Prototypes -----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Enumeration representing the numeric type of the ring buffer elements.
+ */
+typedef enum
+{
+    RING_BUFFER_STATS_TYPE_INT16 = 0u, /// int16_t elements.
+    RING_BUFFER_STATS_TYPE_INT32,      /// int32_t elements.
+    RING_BUFFER_STATS_TYPE_FLOAT,      /// float elements.
+    RING_BUFFER_STATS_TYPE_DOUBLE,     /// double elements.
+    RING_BUFFER_STATS_TYPE_MAX
+} ring_buffer_stats_type_e;
+
+/**
+ * @brief   Structure representing the statistics companion configurations.
+ */
+typedef struct
+{
+    ring_buffer_stats_type_e type; /// Numeric type of the elements (must match the element size).
+    size_t resum;                  /// Updates between re-summations from the stored elements (0 for max_elements).
+    void *window;                  /// Min / max deque storage of RING_BUFFER_STATS_WINDOW_SIZE bytes (NULL disables).
+    size_t window_size;            /// Size of the deque storage in bytes.
+} ring_buffer_stats_conf_t;
+
+/**
+ * @brief   Structure representing one min / max candidate of the window.
+ */
+typedef struct
+{
+    double value; /// Element value.
+    uint64_t seq; /// Insert sequence number of the element (leaves the window when the tail passes it).
+} ring_buffer_stats_entry_t;
+
+/**
+ * @brief   Structure representing a monotonic deque of min / max candidates (circular, max_elements entries).
+ *
+ * Values are increasing (min) or decreasing (max) from the front, the front is the extreme of the window. An insert
+ * drops the candidates it dominates from the back, an eviction drops the front when it is the evicted element.
+ */
+typedef struct
+{
+    ring_buffer_stats_entry_t *entries; /// Candidate storage.
+    size_t first;                       /// Index of the front candidate.
+    size_t size;                        /// Number of candidates.
+} ring_buffer_stats_deque_t;
+
+/**
+ * @brief   Structure representing a statistics companion object.
+ *
+ * Every insert and retrieve of the ring buffer goes through the companion, from one thread at a time, so an evicted
+ * element is known when it leaves the window. After changing the ring buffer with other functions call
+ * RING_BUFFER_STATS_Resync.
+ */
+typedef struct
+{
+    ring_buffer_stats_conf_t conf; /// Statistics companion configurations.
+    ring_buffer_t *rb;             /// Ring buffer holding the window.
+    size_t count;                  /// Number of elements in the window.
+    double sum;                    /// Sum of the elements.
+    double mean;                   /// Mean of the elements (Welford).
+    double m2;                     /// Sum of squared differences from the mean (Welford).
+    size_t updates;                /// Updates since the last re-summation.
+    uint64_t seq_head;             /// Sequence number of the next inserted element.
+    uint64_t seq_tail;             /// Sequence number of the oldest element.
+    ring_buffer_stats_deque_t min; /// Minimum candidates (when conf.window is set).
+    ring_buffer_stats_deque_t max; /// Maximum candidates (when conf.window is set).
+} ring_buffer_stats_t;
+
+// --- Public Functions Prototypes -------------------------------------------------------------------------------------
+
+/**
+ * @brief Initializes a statistics companion for an initialized ring buffer from the elements it already holds.
+ *
+ * The ring buffer must store whole elements of the configured type (not record mode, and a buffer size that is a whole
+ * number of elements unless mirrored), since the re-summation walks them in place with RING_BUFFER_ForEachSegment.
+ *
+ * @param[in] stats A pointer to the statistics companion structure to be initialized.
+ * @param[in] rb A pointer to the ring buffer holding the window.
+ * @param[in] conf The configuration structure (element type, re-summation period and min / max deque storage).
+ *
+ * @return ring_buffer_status_e Status of the initialization:
+ *         - RING_BUFFER_STATUS_OK: Successful initialization
+ *         - RING_BUFFER_STATUS_ERROR_INPUT_ARGS: Invalid configuration, a ring buffer that does not fit the type, or
+ *                                                deque storage smaller than RING_BUFFER_STATS_WINDOW_SIZE
+ *         - RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED: The ring buffer is not initialized
+ */
+ring_buffer_status_e RING_BUFFER_STATS_Init(ring_buffer_stats_t *stats, ring_buffer_t *rb,
+                                            ring_buffer_stats_conf_t conf);
+
+/**
+ * @brief Inserts an element into the ring buffer and adds it to the statistics.
+ *
+ * In overwrite mode a full ring buffer evicts its oldest element, which is removed from the statistics in the same
+ * O(1) update.
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ * @param[in] data A pointer to the element to be inserted.
+ *
+ * @return ring_buffer_status_e Status of the insertion:
+ *         - RING_BUFFER_STATUS_OK: Element successfully inserted
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_FULL: No space available and overwrite is disabled
+ */
+ring_buffer_status_e RING_BUFFER_STATS_Insert(ring_buffer_stats_t *stats, const void *data);
+
+/**
+ * @brief Retrieves the oldest element from the ring buffer and removes it from the statistics.
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ * @param[out] data A pointer to the buffer where the retrieved element will be stored.
+ *
+ * @return ring_buffer_status_e Status of the retrieval:
+ *         - RING_BUFFER_STATUS_OK: Element successfully retrieved
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: No data available for retrieval
+ */
+ring_buffer_status_e RING_BUFFER_STATS_Retrieve(ring_buffer_stats_t *stats, void *data);
+
+/**
+ * @brief Recomputes the statistics from the stored elements (two passes over the window, min / max deques rebuilt).
+ *
+ * Called automatically every conf.resum updates, and needed after the ring buffer was changed without the companion.
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: Statistics recomputed
+ */
+ring_buffer_status_e RING_BUFFER_STATS_Resync(ring_buffer_stats_t *stats);
+
+/**
+ * @brief Gets the sum of the elements in the window.
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ * @param[out] result A pointer to a variable where the sum will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The sum was successfully retrieved (0 for an empty window)
+ */
+ring_buffer_status_e RING_BUFFER_STATS_GetSum(ring_buffer_stats_t *stats, double *result);
+
+/**
+ * @brief Gets the mean of the elements in the window.
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ * @param[out] result A pointer to a variable where the mean will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The mean was successfully retrieved
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The window is empty
+ */
+ring_buffer_status_e RING_BUFFER_STATS_GetMean(ring_buffer_stats_t *stats, double *result);
+
+/**
+ * @brief Gets the population variance of the elements in the window.
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ * @param[out] result A pointer to a variable where the variance will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The variance was successfully retrieved
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The window is empty
+ */
+ring_buffer_status_e RING_BUFFER_STATS_GetVariance(ring_buffer_stats_t *stats, double *result);
+
+/**
+ * @brief Gets the minimum of the elements in the window in O(1) (front of the min deque).
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ * @param[out] result A pointer to a variable where the minimum will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The minimum was successfully retrieved
+ *         - RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED: Min / max tracking is not configured (conf.window)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The window is empty
+ */
+ring_buffer_status_e RING_BUFFER_STATS_WindowMin(ring_buffer_stats_t *stats, double *result);
+
+/**
+ * @brief Gets the maximum of the elements in the window in O(1) (front of the max deque).
+ *
+ * @param[in] stats A pointer to the statistics companion structure.
+ * @param[out] result A pointer to a variable where the maximum will be stored.
+ *
+ * @return ring_buffer_status_e Status of the operation:
+ *         - RING_BUFFER_STATUS_OK: The maximum was successfully retrieved
+ *         - RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED: Min / max tracking is not configured (conf.window)
+ *         - RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY: The window is empty
+ */
+ring_buffer_status_e RING_BUFFER_STATS_WindowMax(ring_buffer_stats_t *stats, double *result);
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_STATS_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,191 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_typed.h
+ * @brief       The component RING-BUFFER typed generator. RING_BUFFER_DEFINE(name, type, capacity) emits a ring buffer
+ *              for one element type and a constant capacity as static inline functions, so element copies become plain
+ *              assignments and the capacity arithmetic folds to constants. Functions follow the semantics and status
+ *              codes of RING_BUFFER_Insert, RING_BUFFER_Retrieve, RING_BUFFER_Peek and RING_BUFFER_Replace.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-17
+ *
+ **********************************************************************************************************************/
+
+#ifndef RING_BUFFER_TYPED_H
+#define RING_BUFFER_TYPED_H
+
+// C++ wrapper - Start
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_gtypes.h"
+
+// --- Public Macros ---------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Generates a typed ring buffer.
+ *
+ * Emits the type name##_t and the functions:
+ *  - name##_init(rb, overwrite)       Initializes an empty buffer (RING_BUFFER_Init).
+ *  - name##_push(rb, value)           Inserts an element (RING_BUFFER_Insert).
+ *  - name##_pop(rb, &value)           Retrieves the oldest element (RING_BUFFER_Retrieve).
+ *  - name##_peek(rb, index, &value)   Reads an element without removing it (RING_BUFFER_Peek).
+ *  - name##_replace(rb, index, value) Replaces an element (RING_BUFFER_Replace).
+ *  - name##_is_empty(rb)              RING_BUFFER_STATUS_OK when empty (RING_BUFFER_IsEmpty).
+ *  - name##_is_full(rb)               RING_BUFFER_STATUS_OK when full (RING_BUFFER_IsFull).
+ *  - name##_get_free_elements(rb, &n) Number of free elements (RING_BUFFER_GetFreeElements).
+ *
+ * @param   name Prefix of the generated type and functions.
+ * @param   type Element type (copied by assignment).
+ * @param   capacity Number of elements, a power of two turns index wrapping into a mask.
+ */
+#define RING_BUFFER_DEFINE(name, type, capacity)                                                                       \
+    typedef char name##_capacity_check[((capacity) > 0) ? 1 : -1];                                                     \
+                                                                                                                       \
+    typedef struct                                                                                                     \
+    {                                                                                                                  \
+        type items[capacity]; /* Element storage. */                                                                   \
+        size_t head;          /* Slot for the next write operation. */                                                 \
+        size_t tail;          /* Slot for the next read operation. */                                                  \
+        size_t count;         /* Number of elements currently in the buffer. */                                        \
+        bool overwrite;       /* Enable inserting new elements even if full. */                                        \
+    } name##_t;                                                                                                        \
+                                                                                                                       \
+    static inline size_t name##_wrap(size_t slot)                                                                      \
+    {                                                                                                                  \
+        if (0 == ((capacity) & ((capacity) - 1)))                                                                      \
+        {                                                                                                              \
+            return slot & ((size_t)(capacity) - 1);                                                                    \
+        }                                                                                                              \
+        return (slot >= (size_t)(capacity)) ? (slot - (size_t)(capacity)) : slot;                                     \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_init(name##_t *rb, bool overwrite)                                       \
+    {                                                                                                                  \
+        if (NULL == rb)                                                                                                \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        rb->head = 0;                                                                                                  \
+        rb->tail = 0;                                                                                                  \
+        rb->count = 0;                                                                                                 \
+        rb->overwrite = overwrite;                                                                                     \
+        return RING_BUFFER_STATUS_OK;                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_push(name##_t *rb, type value)                                           \
+    {                                                                                                                  \
+        if (NULL == rb)                                                                                                \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        if (rb->count >= (size_t)(capacity))                                                                           \
+        {                                                                                                              \
+            if (false == rb->overwrite)                                                                                \
+            {                                                                                                          \
+                return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;                                                           \
+            }                                                                                                          \
+            rb->tail = name##_wrap(rb->tail + 1);                                                                      \
+            rb->count--;                                                                                               \
+        }                                                                                                              \
+        rb->items[rb->head] = value;                                                                                   \
+        rb->head = name##_wrap(rb->head + 1);                                                                          \
+        rb->count++;                                                                                                   \
+        return RING_BUFFER_STATUS_OK;                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_pop(name##_t *rb, type *value)                                           \
+    {                                                                                                                  \
+        if ((NULL == rb) || (NULL == value))                                                                           \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        if (0 == rb->count)                                                                                            \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;                                                              \
+        }                                                                                                              \
+        *value = rb->items[rb->tail];                                                                                  \
+        rb->tail = name##_wrap(rb->tail + 1);                                                                          \
+        rb->count--;                                                                                                   \
+        return RING_BUFFER_STATUS_OK;                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_peek(const name##_t *rb, size_t index, type *value)                      \
+    {                                                                                                                  \
+        if ((NULL == rb) || (NULL == value))                                                                           \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        if (0 == rb->count)                                                                                            \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;                                                              \
+        }                                                                                                              \
+        if (index >= rb->count)                                                                                        \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;                                                             \
+        }                                                                                                              \
+        *value = rb->items[name##_wrap(rb->tail + index)];                                                             \
+        return RING_BUFFER_STATUS_OK;                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_replace(name##_t *rb, size_t index, type value)                          \
+    {                                                                                                                  \
+        if (NULL == rb)                                                                                                \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        if (0 == rb->count)                                                                                            \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;                                                              \
+        }                                                                                                              \
+        if (index >= rb->count)                                                                                        \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;                                                             \
+        }                                                                                                              \
+        rb->items[name##_wrap(rb->tail + index)] = value;                                                              \
+        return RING_BUFFER_STATUS_OK;                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_is_empty(const name##_t *rb)                                             \
+    {                                                                                                                  \
+        if (NULL == rb)                                                                                                \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        return (0 == rb->count) ? RING_BUFFER_STATUS_OK : RING_BUFFER_STATUS_ERROR;                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_is_full(const name##_t *rb)                                              \
+    {                                                                                                                  \
+        if (NULL == rb)                                                                                                \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        return ((size_t)(capacity) == rb->count) ? RING_BUFFER_STATUS_OK : RING_BUFFER_STATUS_ERROR;                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline ring_buffer_status_e name##_get_free_elements(const name##_t *rb, size_t *result)                    \
+    {                                                                                                                  \
+        if ((NULL == rb) || (NULL == result))                                                                          \
+        {                                                                                                              \
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                \
+        }                                                                                                              \
+        *result = (size_t)(capacity) - rb->count;                                                                      \
+        return RING_BUFFER_STATUS_OK;                                                                                  \
+    }
+
+// C++ wrapper - End
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUFFER_TYPED_H */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -1,255 +1,2249 @@
-/***********************************************************************************************************************
- *
- * @file        ring_buffer.h
- * @brief       The Component RING BUFFER provides an efficient circular buffer for handling data in a fixed-size memory
- *              structure. It ensures seamless storage and retrieval with minimal memory overhead, ideal for
- *              applications requiring high-performance, low-latency data management.
- *              - Using dynamic memory
- * @author      Blaz Baskovc
- * @copyright   Copyright 2025 Blaz Baskovc
- * @date        2025-02-24
- * @version     1.0.0
- *
- *  Author          Date        Version     Comments on that revision
- * ---------------------------------------------------------------------------------------------------------------------
- *  Blaz Baskovc    2025-03-12  1.0.0       First release.
- *
- **********************************************************************************************************************/
-
-// --- Includes --------------------------------------------------------------------------------------------------------
-
-#include <stdbool.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-
-#if __has_include("ring_buffer_conf.h")
-#include "ring_buffer_conf.h"
-#endif /* __has_include("ring_buffer_conf.h") */
-
-#ifdef RING_BUFFER_CONF_FREERTOS_USE
-#if (true == RING_BUFFER_CONF_FREERTOS_USE)
-
-#include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
-#include <freertos/semphr.h>
-
-#endif /* (true == RING_BUFFER_CONF_FREERTOS_USE) */
-#endif /* RING_BUFFER_CONF_FREERTOS_USE */
-
-#include "ring_buffer/ring_buffer_ptypes.h"
-#include "ring_buffer/ring_buffer_gtypes.h"
-#include "ring_buffer/ring_buffer.h"
-
-// --- Public Functions Definitions ------------------------------------------------------------------------------------
-
-ring_buffer_status_e RING_BUFFER_Init(ring_buffer_t *rb, ring_buffer_conf_t conf)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(conf.buffer, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_SIZE(conf.buffer_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_SIZE(conf.element_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-
-    if (conf.buffer_size < conf.element_size)
-    {
-        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
-    }
-
-    MEMSET(rb, 0, sizeof(ring_buffer_t));
-
-    rb->conf = conf;
-    rb->max_elements = rb->conf.buffer_size / rb->conf.element_size;
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-ring_buffer_status_e RING_BUFFER_DeInit(ring_buffer_t *rb)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-
-    MEMSET(rb, 0, sizeof(ring_buffer_t));
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-ring_buffer_status_e RING_BUFFER_Insert(ring_buffer_t *rb, const void *data)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-
-    if (false == rb->conf.overwrite && rb->count >= rb->max_elements)
-    {
-        return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
-    }
-
-    uint8_t *dest = rb->conf.buffer + rb->head;
-    size_t end_space = rb->conf.buffer_size - rb->head;
-    if (end_space >= rb->conf.element_size)
-    {
-        MEMCPY(dest, data, rb->conf.element_size);
-        rb->head += rb->conf.element_size;
-    }
-    else
-    {
-        MEMCPY(dest, data, end_space);
-        MEMCPY(rb->conf.buffer, (uint8_t *)data + end_space, rb->conf.element_size - end_space);
-        rb->head = rb->conf.element_size - end_space;
-    }
-
-    if (rb->head >= rb->conf.buffer_size)
-    {
-        rb->head = 0;
-    }
-
-    if (rb->conf.overwrite)
-    {
-        if (rb->count >= rb->max_elements)
-        {
-            rb->tail = (rb->tail + rb->conf.element_size) % rb->conf.buffer_size;
-        }
-    }
-
-    if (rb->count < rb->max_elements)
-    {
-        rb->count++;
-    }
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-ring_buffer_status_e RING_BUFFER_Retrieve(ring_buffer_t *rb, void *data)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-    CHECK_ARGS_SIZE(rb->count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
-
-    uint8_t *src = rb->conf.buffer + rb->tail;
-    size_t end_space = rb->conf.buffer_size - rb->tail;
-
-    if (end_space >= rb->conf.element_size)
-    {
-        MEMCPY(data, src, rb->conf.element_size);
-        rb->tail += rb->conf.element_size;
-    }
-    else
-    {
-        MEMCPY(data, src, end_space);
-        MEMCPY((uint8_t *)data + end_space, rb->conf.buffer, rb->conf.element_size - end_space);
-        rb->tail = rb->conf.element_size - end_space;
-    }
-
-    rb->count--;
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-ring_buffer_status_e RING_BUFFER_Peek(ring_buffer_t *rb, size_t index, void *data)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-    CHECK_ARGS_SIZE(rb->count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
-
-    if (index >= rb->count)
-    {
-        return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;
-    }
-
-    size_t element_pos = (rb->tail + index * rb->conf.element_size) % rb->conf.buffer_size;
-    uint8_t *src = rb->conf.buffer + element_pos;
-    size_t end_space = rb->conf.buffer_size - element_pos;
-
-    if (end_space >= rb->conf.element_size)
-    {
-        MEMCPY(data, src, rb->conf.element_size);
-    }
-    else
-    {
-        MEMCPY(data, src, end_space);
-        MEMCPY((uint8_t *)data + end_space, rb->conf.buffer, rb->conf.element_size - end_space);
-    }
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-ring_buffer_status_e RING_BUFFER_Replace(ring_buffer_t *rb, size_t index, const void *data)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-    CHECK_ARGS_SIZE(rb->count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
-
-    if (index >= rb->count)
-    {
-        return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;
-    }
-
-    size_t element_pos = (rb->tail + index * rb->conf.element_size) % rb->conf.buffer_size;
-    uint8_t *dest = rb->conf.buffer + element_pos;
-    size_t end_space = rb->conf.buffer_size - element_pos;
-
-    if (end_space >= rb->conf.element_size)
-    {
-        MEMCPY(dest, data, rb->conf.element_size);
-    }
-    else
-    {
-        MEMCPY(dest, data, end_space);
-        MEMCPY(rb->conf.buffer, (uint8_t *)data + end_space, rb->conf.element_size - end_space);
-    }
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-ring_buffer_status_e RING_BUFFER_IsEmpty(ring_buffer_t *rb)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-
-    if (0 == rb->count)
-    {
-        return RING_BUFFER_STATUS_OK;
-    }
-
-    return RING_BUFFER_STATUS_ERROR;
-}
-
-ring_buffer_status_e RING_BUFFER_IsFull(ring_buffer_t *rb)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-
-    if (rb->max_elements == rb->count)
-    {
-        return RING_BUFFER_STATUS_OK;
-    }
-
-    return RING_BUFFER_STATUS_ERROR;
-}
-
-ring_buffer_status_e RING_BUFFER_GetFreeElements(ring_buffer_t *rb, size_t *result)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-
-    *result = (size_t)(rb->max_elements - rb->count);
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-ring_buffer_status_e RING_BUFFER_GetElementSize(ring_buffer_t *rb, size_t *result)
-{
-    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
-    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
-
-    *result = (size_t)rb->conf.element_size;
-
-    return RING_BUFFER_STATUS_OK;
-}
-
-// --- EOF -------------------------------------------------------------------------------------------------------------
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer.h
+ * @brief       The Component RING BUFFER provides an efficient circular buffer for handling data in a fixed-size memory
+ *              structure. It ensures seamless storage and retrieval with minimal memory overhead, ideal for
+ *              applications requiring high-performance, low-latency data management.
+ *              - Using dynamic memory
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-02-24
+ * @version     1.0.0
+ *
+ *  Author          Date        Version     Comments on that revision
+ * ---------------------------------------------------------------------------------------------------------------------
+ *  Blaz Baskovc    2025-03-12  1.0.0       First release.
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+// GNU / POSIX interfaces used below (syscall, memfd_create, MAP_ANONYMOUS, clock_gettime) are hidden in strict C99
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#if __has_include("ring_buffer_conf.h")
+#include "ring_buffer_conf.h"
+#endif /* __has_include("ring_buffer_conf.h") */
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <linux/memfd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#endif /* defined(__linux__) */
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define _RECORD_SKIP (UINT32_MAX) //< Record header marking the unused end of the buffer before the wrap point.
+
+/**
+ * @brief   Rejects element functions in record mode: counts and positions are in bytes there, so one element would be a
+ *          single byte of a record, its length header or a _RECORD_SKIP marker, and moving it would tear the stream.
+ * @param   rb Ring buffer to check.
+ */
+#define _CHECK_NOT_RECORDS(rb)                                                                                         \
+    if ((rb)->conf.records)                                                                                            \
+    {                                                                                                                  \
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;                                                                    \
+    }
+
+#if defined(__linux__)
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Mapping created by RING_BUFFER_MirrorAlloc (an unused entry has a NULL buffer).
+ */
+typedef struct
+{
+    uint8_t *buffer; /// Start of the first view.
+    size_t size;     /// Size of one view in bytes.
+} _mirror_t;
+
+// --- Private Variables Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Mappings of RING_BUFFER_MirrorAlloc that were not freed yet: only these continue past buffer_size, so Init
+ *          and RING_BUFFER_MirrorFree accept a mirrored configuration only when its buffer and size are listed here.
+ */
+static _mirror_t _mirrors[RING_BUFFER_CONF_MIRROR_MAX];
+static pthread_mutex_t _mirrors_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+#endif /* defined(__linux__) */
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+static size_t _advance(const ring_buffer_t *rb, size_t pos, size_t elements);
+static size_t _retreat(const ring_buffer_t *rb, size_t pos, size_t elements);
+static size_t _offset(const ring_buffer_t *rb, size_t pos);
+static void _write_bytes(ring_buffer_t *rb, size_t offset, const uint8_t *src, size_t len);
+static void _read_bytes(const ring_buffer_t *rb, size_t offset, uint8_t *dst, size_t len);
+static void _spans(const ring_buffer_t *rb, size_t offset, size_t len, uint8_t **seg1, size_t *len1, uint8_t **seg2,
+                   size_t *len2);
+static void _lock(const ring_buffer_lock_t *lock);
+static void _unlock(const ring_buffer_lock_t *lock);
+static size_t _count(const ring_buffer_t *rb);
+static void _count_add(ring_buffer_t *rb, size_t n);
+static void _count_sub(ring_buffer_t *rb, size_t n);
+static ring_buffer_status_e _insert(ring_buffer_t *rb, const void *data);
+static ring_buffer_status_e _retrieve(ring_buffer_t *rb, void *data);
+static ring_buffer_status_e _insert_many(ring_buffer_t *rb, const void *data, size_t n, size_t *written);
+static ring_buffer_status_e _retrieve_many(ring_buffer_t *rb, void *data, size_t n, size_t *read);
+static ring_buffer_status_e _peek(ring_buffer_t *rb, size_t index, void *data);
+static ring_buffer_status_e _replace(ring_buffer_t *rb, size_t index, const void *data);
+static ring_buffer_status_e _range(ring_buffer_t *rb, size_t start, size_t n, size_t *offset);
+static ring_buffer_status_e _segments(ring_buffer_t *rb, uint8_t **seg1, size_t *n1, uint8_t **seg2, size_t *n2);
+static ring_buffer_status_e _walk(ring_buffer_t *rb, ring_buffer_visit_fn_t visit, ring_buffer_map_fn_t map, void *ctx);
+static size_t _record_pad(const ring_buffer_t *rb, size_t pos, size_t len);
+static size_t _record_next(const ring_buffer_t *rb, size_t *pad);
+static ring_buffer_status_e _insert_record(ring_buffer_t *rb, const void *data, size_t len);
+static void _wake(uint32_t *seq, uint32_t *waiters);
+static void _notify(int fd, uint32_t *armed);
+
+#if defined(__linux__)
+
+static _mirror_t *_mirror_find(const uint8_t *buffer, size_t size);
+static bool _mirror_tracked(const uint8_t *buffer, size_t size);
+static void _deadline(struct timespec *deadline, uint32_t timeout_ms);
+static bool _remaining(const struct timespec *deadline, uint32_t timeout_ms, struct timespec *remaining);
+static bool _ready(ring_buffer_t *rb, bool for_data);
+static bool _spin(ring_buffer_t *rb, bool for_data, uint32_t pauses);
+static void _park(ring_buffer_t *rb, bool for_data, const struct timespec *timeout);
+static bool _wait(ring_buffer_t *rb, bool for_data, const struct timespec *deadline, uint32_t timeout_ms,
+                  uint32_t *round);
+static ring_buffer_status_e _fd_transfer(ring_buffer_t *rb, int fd, size_t offset, size_t n, bool out,
+                                         size_t *partial, size_t *elements);
+
+#endif /* defined(__linux__) */
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_Init(ring_buffer_t *rb, ring_buffer_conf_t conf)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf.buffer, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.buffer_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    // Records are stored as a byte stream, counts and positions are in bytes
+    if (conf.records)
+    {
+        conf.element_size = 1;
+    }
+
+    CHECK_ARGS_SIZE(conf.element_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    if (conf.buffer_size < conf.element_size)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    // Only a RING_BUFFER_MirrorAlloc mapping continues past buffer_size
+#if defined(__linux__)
+    if (conf.mirrored && (false == _mirror_tracked(conf.buffer, conf.buffer_size)))
+#else
+    if (conf.mirrored)
+#endif /* defined(__linux__) */
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    // A lock hook needs both functions
+    if (((NULL == conf.producer_lock.lock) != (NULL == conf.producer_lock.unlock)) ||
+        ((NULL == conf.consumer_lock.lock) != (NULL == conf.consumer_lock.unlock)))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    size_t max_elements = conf.buffer_size / conf.element_size;
+
+    if (conf.power_of_two)
+    {
+        // Buffer must hold exactly a power-of-two number of elements
+        if ((0 != (conf.buffer_size % conf.element_size)) || (0 != (max_elements & (max_elements - 1))))
+        {
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+        }
+    }
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+    RING_BUFFER_CopySelect();
+#endif /* (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO) */
+
+    MEMSET(rb, 0, sizeof(ring_buffer_t));
+
+    rb->conf = conf;
+    rb->max_elements = max_elements;
+    rb->shared = (NULL != conf.producer_lock.lock) || (NULL != conf.consumer_lock.lock);
+
+    if (rb->conf.power_of_two)
+    {
+        rb->mask = max_elements - 1;
+        rb->element_shift_use = (0 == (conf.element_size & (conf.element_size - 1)));
+
+        while (rb->element_shift_use && ((size_t)1 << rb->element_shift) < conf.element_size)
+        {
+            rb->element_shift++;
+        }
+    }
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_DeInit(ring_buffer_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+#if defined(__linux__)
+    if (rb->notify)
+    {
+        RING_BUFFER_NotifyDeInit(rb);
+    }
+#endif /* defined(__linux__) */
+
+    MEMSET(rb, 0, sizeof(ring_buffer_t));
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_Insert(ring_buffer_t *rb, const void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.producer_lock);
+    ring_buffer_status_e status = _insert(rb, data);
+    _unlock(&rb->conf.producer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_Retrieve(ring_buffer_t *rb, void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.consumer_lock);
+    ring_buffer_status_e status = _retrieve(rb, data);
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_InsertMany(ring_buffer_t *rb, const void *data, size_t n, size_t *written)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(written, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *written = 0;
+
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.producer_lock);
+    ring_buffer_status_e status = _insert_many(rb, data, n, written);
+    _unlock(&rb->conf.producer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_RetrieveMany(ring_buffer_t *rb, void *data, size_t n, size_t *read)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *read = 0;
+
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.consumer_lock);
+    ring_buffer_status_e status = _retrieve_many(rb, data, n, read);
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+#if defined(__linux__)
+
+ring_buffer_status_e RING_BUFFER_InsertWait(ring_buffer_t *rb, const void *data, uint32_t timeout_ms)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    // Without lock hooks no other thread may change the buffer, so nothing would ever end the wait
+    if ((false == rb->shared) && (RING_BUFFER_WAIT_FOREVER == timeout_ms))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    struct timespec deadline;
+    uint32_t round = 0;
+
+    _deadline(&deadline, timeout_ms);
+
+    while (true)
+    {
+        ring_buffer_status_e status = RING_BUFFER_Insert(rb, data);
+
+        if ((RING_BUFFER_STATUS_ERROR_BUFFER_FULL != status) ||
+            (false == _wait(rb, false, &deadline, timeout_ms, &round)))
+        {
+            return status;
+        }
+    }
+}
+
+ring_buffer_status_e RING_BUFFER_RetrieveWait(ring_buffer_t *rb, void *data, uint32_t timeout_ms)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    // Without lock hooks no other thread may change the buffer, so nothing would ever end the wait
+    if ((false == rb->shared) && (RING_BUFFER_WAIT_FOREVER == timeout_ms))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    struct timespec deadline;
+    uint32_t round = 0;
+
+    _deadline(&deadline, timeout_ms);
+
+    while (true)
+    {
+        ring_buffer_status_e status = RING_BUFFER_Retrieve(rb, data);
+
+        if ((RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY != status) ||
+            (false == _wait(rb, true, &deadline, timeout_ms, &round)))
+        {
+            return status;
+        }
+    }
+}
+
+ring_buffer_status_e RING_BUFFER_RetrieveManyWait(ring_buffer_t *rb, void *data, size_t n, size_t *read,
+                                                  uint32_t timeout_ms)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *read = 0;
+
+    _CHECK_NOT_RECORDS(rb);
+
+    if ((false == rb->shared) && (RING_BUFFER_WAIT_FOREVER == timeout_ms))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    struct timespec deadline;
+    uint32_t round = 0;
+    size_t total = 0;
+
+    _deadline(&deadline, timeout_ms);
+
+    while (total < n)
+    {
+        size_t chunk = 0;
+
+        RING_BUFFER_RetrieveMany(rb, (uint8_t *)data + total * rb->conf.element_size, n - total, &chunk);
+        total += chunk;
+
+        if ((total < n) && (false == _wait(rb, true, &deadline, timeout_ms, &round)))
+        {
+            break;
+        }
+    }
+
+    *read = total;
+
+    return ((0 == total) && (0 != n)) ? RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY : RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MirrorAlloc(ring_buffer_conf_t *conf, size_t size)
+{
+    CHECK_ARGS_NULL_PTR(conf, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    long page = sysconf(_SC_PAGESIZE);
+    size = ((size + (size_t)page - 1) / (size_t)page) * (size_t)page;
+
+    int fd = (int)syscall(SYS_memfd_create, "ring_buffer", MFD_CLOEXEC);
+    if (fd < 0)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    // Reserve twice the size, then map the same pages into both halves
+    uint8_t *area = MAP_FAILED;
+    if (0 == ftruncate(fd, (off_t)size))
+    {
+        area = mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    if ((MAP_FAILED != area) &&
+        ((MAP_FAILED == mmap(area, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)) ||
+         (MAP_FAILED == mmap(area + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0))))
+    {
+        munmap(area, 2 * size);
+        area = MAP_FAILED;
+    }
+
+    // Mappings keep the memory alive
+    close(fd);
+
+    if (MAP_FAILED == area)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    pthread_mutex_lock(&_mirrors_mutex);
+    _mirror_t *mirror = _mirror_find(NULL, 0);
+    if (NULL != mirror)
+    {
+        mirror->buffer = area;
+        mirror->size = size;
+    }
+    pthread_mutex_unlock(&_mirrors_mutex);
+
+    if (NULL == mirror)
+    {
+        munmap(area, 2 * size);
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    conf->buffer = area;
+    conf->buffer_size = size;
+    conf->mirrored = true;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MirrorFree(ring_buffer_conf_t *conf)
+{
+    CHECK_ARGS_NULL_PTR(conf, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf->buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (false == conf->mirrored)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    pthread_mutex_lock(&_mirrors_mutex);
+    _mirror_t *mirror = _mirror_find(conf->buffer, conf->buffer_size);
+    if (NULL != mirror)
+    {
+        *mirror = (_mirror_t){0};
+    }
+    pthread_mutex_unlock(&_mirrors_mutex);
+
+    if (NULL == mirror)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    munmap(conf->buffer, 2 * conf->buffer_size);
+
+    conf->buffer = NULL;
+    conf->buffer_size = 0;
+    conf->mirrored = false;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_NotifyInit(ring_buffer_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (rb->notify)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    rb->data_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    rb->space_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if ((rb->data_fd < 0) || (rb->space_fd < 0))
+    {
+        if (rb->data_fd >= 0)
+        {
+            close(rb->data_fd);
+        }
+
+        if (rb->space_fd >= 0)
+        {
+            close(rb->space_fd);
+        }
+
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    rb->data_armed = 1;
+    rb->space_armed = 1;
+    rb->notify = true;
+
+    // Start level triggered, as if the buffer had just become non-empty / not full
+    size_t count = _count(rb);
+
+    if (0 != count)
+    {
+        _notify(rb->data_fd, &rb->data_armed);
+    }
+
+    if (count < rb->max_elements)
+    {
+        _notify(rb->space_fd, &rb->space_armed);
+    }
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_NotifyDeInit(ring_buffer_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    if (false == rb->notify)
+    {
+        return RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED;
+    }
+
+    rb->notify = false;
+    close(rb->data_fd);
+    close(rb->space_fd);
+    rb->data_fd = -1;
+    rb->space_fd = -1;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_GetNotifyFd(ring_buffer_t *rb, ring_buffer_notify_e notify, int *fd)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(fd, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    if (notify >= RING_BUFFER_NOTIFY_MAX)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    if (false == rb->notify)
+    {
+        return RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED;
+    }
+
+    *fd = (RING_BUFFER_NOTIFY_DATA == notify) ? rb->data_fd : rb->space_fd;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_NotifyAck(ring_buffer_t *rb, ring_buffer_notify_e notify)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    if (notify >= RING_BUFFER_NOTIFY_MAX)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    if (false == rb->notify)
+    {
+        return RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED;
+    }
+
+    int fd = (RING_BUFFER_NOTIFY_DATA == notify) ? rb->data_fd : rb->space_fd;
+    uint32_t *armed = (RING_BUFFER_NOTIFY_DATA == notify) ? &rb->data_armed : &rb->space_armed;
+    uint64_t value;
+
+    // Clear the counter (non-blocking, nothing to read is fine), then re-arm before the caller drains / fills
+    ssize_t result = read(fd, &value, sizeof(value));
+    (void)result;
+
+    __atomic_store_n(armed, 1, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_DrainToFd(ring_buffer_t *rb, int fd, size_t max, size_t *drained)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(drained, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *drained = 0;
+
+    // Skip markers and record headers are not part of the byte stream
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.consumer_lock);
+
+    size_t count = _count(rb);
+
+    if (0 == count)
+    {
+        _unlock(&rb->conf.consumer_lock);
+        return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+    }
+
+    if (max > count)
+    {
+        max = count;
+    }
+
+    ring_buffer_status_e status = _fd_transfer(rb, fd, _offset(rb, rb->tail), max, true, &rb->drain_partial, drained);
+
+    rb->tail = _advance(rb, rb->tail, *drained);
+    _count_sub(rb, *drained);
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_FillFromFd(ring_buffer_t *rb, int fd, size_t max, size_t *filled)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(filled, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *filled = 0;
+
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.producer_lock);
+
+    size_t free_elements = rb->max_elements - _count(rb);
+
+    if (0 == free_elements)
+    {
+        _unlock(&rb->conf.producer_lock);
+        return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+    }
+
+    if (max > free_elements)
+    {
+        max = free_elements;
+    }
+
+    ring_buffer_status_e status = _fd_transfer(rb, fd, _offset(rb, rb->head), max, false, &rb->fill_partial, filled);
+
+    // Element data read in place must be visible before the new head and count
+    RING_BUFFER_RELEASE_FENCE();
+
+    rb->head = _advance(rb, rb->head, *filled);
+    _count_add(rb, *filled);
+
+    _unlock(&rb->conf.producer_lock);
+
+    return status;
+}
+
+#endif /* defined(__linux__) */
+
+ring_buffer_status_e RING_BUFFER_ReserveWrite(ring_buffer_t *rb, size_t n, void **seg1, size_t *len1, void **seg2,
+                                              size_t *len2)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(seg1, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(len1, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(seg2, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(len2, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *seg1 = NULL;
+    *len1 = 0;
+    *seg2 = NULL;
+    *len2 = 0;
+
+    _CHECK_NOT_RECORDS(rb);
+
+    // Held until RING_BUFFER_CommitWrite
+    _lock(&rb->conf.producer_lock);
+
+    size_t count = _count(rb);
+
+    rb->reserved = 0;
+    rb->reserve_locked = false;
+
+    if (false == rb->conf.overwrite)
+    {
+        size_t free_elements = rb->max_elements - count;
+        if (0 == free_elements && 0 != n)
+        {
+            _unlock(&rb->conf.producer_lock);
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+
+        if (n > free_elements)
+        {
+            n = free_elements;
+        }
+    }
+    else
+    {
+        if (n > rb->max_elements)
+        {
+            n = rb->max_elements;
+        }
+
+        if (count + n > rb->max_elements)
+        {
+            // Reservation overlaps the oldest elements, keep the consumer side out of them until the commit
+            _lock(&rb->conf.consumer_lock);
+            rb->reserve_locked = true;
+        }
+    }
+
+    uint8_t *start1;
+    uint8_t *start2;
+
+    _spans(rb, _offset(rb, rb->head), n * rb->conf.element_size, &start1, len1, &start2, len2);
+    *seg1 = start1;
+    *seg2 = start2;
+    rb->reserved = n;
+    rb->reserve_active = true;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_CommitWrite(ring_buffer_t *rb, size_t n)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    // Without an open reservation no lock is held, there is nothing to release
+    if (false == rb->reserve_active)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    ring_buffer_status_e status = RING_BUFFER_STATUS_OK;
+
+    // Nothing is published, but the reservation still ends so the locks taken by RING_BUFFER_ReserveWrite are released
+    if (n > rb->reserved)
+    {
+        status = RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+        n = 0;
+    }
+
+    size_t count = _count(rb);
+    size_t evicted = 0;
+
+    if (count + n > rb->max_elements)
+    {
+        if (false == rb->conf.overwrite)
+        {
+            status = RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+            n = 0;
+        }
+        else
+        {
+            evicted = count + n - rb->max_elements;
+        }
+    }
+
+    // Element data written in place must be visible before the new head and count
+    RING_BUFFER_RELEASE_FENCE();
+
+    rb->head = _advance(rb, rb->head, n);
+    rb->tail = _advance(rb, rb->tail, evicted);
+    _count_add(rb, n - evicted);
+    rb->reserved = 0;
+    rb->reserve_active = false;
+
+    // Elements written in place end a partly read one, an evicted oldest element ends a partly written one
+    if (0 != n)
+    {
+        rb->fill_partial = 0;
+    }
+
+    if (0 != evicted)
+    {
+        rb->drain_partial = 0;
+    }
+
+    if (rb->reserve_locked)
+    {
+        rb->reserve_locked = false;
+        _unlock(&rb->conf.consumer_lock);
+    }
+
+    _unlock(&rb->conf.producer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_PeekSpans(ring_buffer_t *rb, size_t max, const void **seg1, size_t *len1,
+                                           const void **seg2, size_t *len2)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(seg1, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(len1, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(seg2, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(len2, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *seg1 = NULL;
+    *len1 = 0;
+    *seg2 = NULL;
+    *len2 = 0;
+
+    _CHECK_NOT_RECORDS(rb);
+
+    // Held until RING_BUFFER_Consume
+    _lock(&rb->conf.consumer_lock);
+
+    size_t count = _count(rb);
+
+    if (0 == count)
+    {
+        _unlock(&rb->conf.consumer_lock);
+        return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+    }
+
+    if (max > count)
+    {
+        max = count;
+    }
+
+    uint8_t *start1;
+    uint8_t *start2;
+
+    _spans(rb, _offset(rb, rb->tail), max * rb->conf.element_size, &start1, len1, &start2, len2);
+    *seg1 = start1;
+    *seg2 = start2;
+    rb->peeked = max;
+    rb->peek_active = true;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_Consume(ring_buffer_t *rb, size_t n)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    // Without a successful RING_BUFFER_PeekSpans the consumer lock is not held
+    if (false == rb->peek_active)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    rb->peek_active = false;
+
+    // The lock taken by RING_BUFFER_PeekSpans is released on error too, nothing is released from the buffer
+    if (n > rb->peeked)
+    {
+        _unlock(&rb->conf.consumer_lock);
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    rb->tail = _advance(rb, rb->tail, n);
+    _count_sub(rb, n);
+
+    if (0 != n)
+    {
+        rb->drain_partial = 0;
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_Discard(ring_buffer_t *rb, size_t n)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    _CHECK_NOT_RECORDS(rb);
+
+    ring_buffer_status_e status = RING_BUFFER_STATUS_OK;
+
+    _lock(&rb->conf.consumer_lock);
+
+    size_t count = _count(rb);
+
+    if (0 == count)
+    {
+        status = RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+    }
+    else
+    {
+        if (n > count)
+        {
+            n = count;
+        }
+
+        rb->tail = _advance(rb, rb->tail, n);
+        _count_sub(rb, n);
+
+        // The oldest element goes first, also when RING_BUFFER_DrainToFd has written part of it
+        if (0 != n)
+        {
+            rb->drain_partial = 0;
+        }
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_DiscardNewest(ring_buffer_t *rb, size_t n)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    ring_buffer_status_e status = RING_BUFFER_STATUS_OK;
+
+    // The head belongs to the producer side, the consumer side must not read the dropped elements meanwhile
+    _lock(&rb->conf.producer_lock);
+    _lock(&rb->conf.consumer_lock);
+
+    size_t count = _count(rb);
+
+    if (0 == count)
+    {
+        status = RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+    }
+    else
+    {
+        if (n > count)
+        {
+            n = count;
+        }
+
+        rb->head = _retreat(rb, rb->head, n);
+
+        // Bytes RING_BUFFER_FillFromFd read behind the old head would now be the middle of a stored element
+        if (0 != n)
+        {
+            rb->fill_partial = 0;
+        }
+
+        if (n == count)
+        {
+            rb->drain_partial = 0;
+        }
+
+        _count_sub(rb, n);
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+    _unlock(&rb->conf.producer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_Clear(ring_buffer_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    _lock(&rb->conf.producer_lock);
+    _lock(&rb->conf.consumer_lock);
+
+    // Positions stay where they are, only the stored range becomes empty
+    rb->tail = rb->head;
+    rb->drain_partial = 0;
+    _count_sub(rb, _count(rb));
+
+    _unlock(&rb->conf.consumer_lock);
+    _unlock(&rb->conf.producer_lock);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_InsertRecord(ring_buffer_t *rb, const void *data, size_t len)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (false == rb->conf.records)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    // Record must fit into the empty buffer together with its header
+    if ((len >= _RECORD_SKIP) || (len > rb->conf.buffer_size - RING_BUFFER_RECORD_HEADER_SIZE) ||
+        (rb->conf.buffer_size < RING_BUFFER_RECORD_HEADER_SIZE))
+    {
+        return RING_BUFFER_STATUS_ERROR_OVERFLOW;
+    }
+
+    _lock(&rb->conf.producer_lock);
+    ring_buffer_status_e status = _insert_record(rb, data, len);
+    _unlock(&rb->conf.producer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_RetrieveRecord(ring_buffer_t *rb, void *out, size_t cap, size_t *len)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(out, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(len, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (false == rb->conf.records)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    ring_buffer_status_e status = RING_BUFFER_STATUS_OK;
+    size_t pad = 0;
+
+    *len = 0;
+
+    _lock(&rb->conf.consumer_lock);
+
+    if (0 == _count(rb))
+    {
+        status = RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+    }
+    else
+    {
+        *len = _record_next(rb, &pad);
+
+        // Too long records stay in the buffer, len tells the caller how much room they need
+        if (*len > cap)
+        {
+            status = RING_BUFFER_STATUS_ERROR_OVERFLOW;
+        }
+        else
+        {
+            size_t pos = _advance(rb, rb->tail, pad + RING_BUFFER_RECORD_HEADER_SIZE);
+
+            _read_bytes(rb, _offset(rb, pos), (uint8_t *)out, *len);
+            rb->tail = _advance(rb, pos, *len);
+            _count_sub(rb, pad + RING_BUFFER_RECORD_HEADER_SIZE + *len);
+        }
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_Peek(ring_buffer_t *rb, size_t index, void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.consumer_lock);
+    ring_buffer_status_e status = _peek(rb, index, data);
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_Replace(ring_buffer_t *rb, size_t index, const void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    _lock(&rb->conf.consumer_lock);
+    ring_buffer_status_e status = _replace(rb, index, data);
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_PeekRange(ring_buffer_t *rb, size_t start, size_t n, void *out)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(out, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    size_t offset;
+
+    _lock(&rb->conf.consumer_lock);
+
+    ring_buffer_status_e status = _range(rb, start, n, &offset);
+    if (RING_BUFFER_STATUS_OK == status)
+    {
+        _read_bytes(rb, offset, (uint8_t *)out, n * rb->conf.element_size);
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_ReplaceRange(ring_buffer_t *rb, size_t start, size_t n, const void *in)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(in, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    _CHECK_NOT_RECORDS(rb);
+
+    size_t offset;
+
+    _lock(&rb->conf.consumer_lock);
+
+    ring_buffer_status_e status = _range(rb, start, n, &offset);
+    if (RING_BUFFER_STATUS_OK == status)
+    {
+        _write_bytes(rb, offset, (const uint8_t *)in, n * rb->conf.element_size);
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_ForEach(ring_buffer_t *rb, ring_buffer_visit_fn_t fn, void *ctx)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(fn, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    return _walk(rb, fn, NULL, ctx);
+}
+
+ring_buffer_status_e RING_BUFFER_MapInPlace(ring_buffer_t *rb, ring_buffer_map_fn_t fn, void *ctx)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(fn, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    return _walk(rb, NULL, fn, ctx);
+}
+
+ring_buffer_status_e RING_BUFFER_ForEachSegment(ring_buffer_t *rb, ring_buffer_segment_fn_t fn, void *ctx)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(fn, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    uint8_t *seg1;
+    uint8_t *seg2;
+    size_t n1;
+    size_t n2;
+
+    _lock(&rb->conf.consumer_lock);
+
+    ring_buffer_status_e status = _segments(rb, &seg1, &n1, &seg2, &n2);
+    if ((RING_BUFFER_STATUS_OK == status) && fn(seg1, n1, ctx) && (0 != n2))
+    {
+        fn(seg2, n2, ctx);
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_IsEmpty(ring_buffer_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (0 == _count(rb))
+    {
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    return RING_BUFFER_STATUS_ERROR;
+}
+
+ring_buffer_status_e RING_BUFFER_IsFull(ring_buffer_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (rb->max_elements == _count(rb))
+    {
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    return RING_BUFFER_STATUS_ERROR;
+}
+
+ring_buffer_status_e RING_BUFFER_GetFreeElements(ring_buffer_t *rb, size_t *result)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *result = (size_t)(rb->max_elements - _count(rb));
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_GetElementSize(ring_buffer_t *rb, size_t *result)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *result = (size_t)rb->conf.element_size;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Moves a head / tail position forward by a number of elements.
+ *
+ * In the default mode positions are byte offsets that wrap at the end of the buffer (a single subtraction, no modulo
+ * for up to max_elements). In power-of-two mode positions are free-running element indices and wrap through the mask
+ * in _offset.
+ *
+ * @param   rb Ring buffer the position belongs to.
+ * @param   pos Head / tail position.
+ * @param   elements Number of elements to move forward.
+ * @return  New position.
+ */
+static size_t _advance(const ring_buffer_t *rb, size_t pos, size_t elements)
+{
+    if (rb->conf.power_of_two)
+    {
+        return pos + elements;
+    }
+
+    size_t offset;
+    if (elements <= rb->max_elements)
+    {
+        offset = elements * rb->conf.element_size;
+    }
+    else
+    {
+        offset = ((elements % rb->conf.buffer_size) * rb->conf.element_size) % rb->conf.buffer_size;
+    }
+
+    pos += offset;
+    if (pos >= rb->conf.buffer_size)
+    {
+        pos -= rb->conf.buffer_size;
+    }
+
+    return pos;
+}
+
+/**
+ * @brief   Moves a head / tail position back by a number of elements (the inverse of _advance).
+ * @param   rb Ring buffer the position belongs to.
+ * @param   pos Head / tail position.
+ * @param   elements Number of elements to move back (at most max_elements).
+ * @return  New position.
+ */
+static size_t _retreat(const ring_buffer_t *rb, size_t pos, size_t elements)
+{
+    if (rb->conf.power_of_two)
+    {
+        return pos - elements;
+    }
+
+    size_t offset = elements * rb->conf.element_size;
+
+    if (pos < offset)
+    {
+        pos += rb->conf.buffer_size;
+    }
+
+    return pos - offset;
+}
+
+/**
+ * @brief   Converts a head / tail position to a byte offset inside the buffer.
+ * @param   rb Ring buffer the position belongs to.
+ * @param   pos Head / tail position.
+ * @return  Byte offset inside the buffer.
+ */
+static size_t _offset(const ring_buffer_t *rb, size_t pos)
+{
+    if (false == rb->conf.power_of_two)
+    {
+        return pos;
+    }
+
+    if (rb->element_shift_use)
+    {
+        return (pos & rb->mask) << rb->element_shift;
+    }
+
+    return (pos & rb->mask) * rb->conf.element_size;
+}
+
+/**
+ * @brief   Copies bytes into the buffer starting at a byte offset, as at most two copies around the wrap point.
+ * @param   rb Ring buffer to write into.
+ * @param   offset Byte offset where writing starts.
+ * @param   src Source bytes (length must not exceed the buffer size).
+ * @param   len Number of bytes to copy.
+ */
+static void _write_bytes(ring_buffer_t *rb, size_t offset, const uint8_t *src, size_t len)
+{
+    size_t end_space = rb->conf.buffer_size - offset;
+
+    // Mirrored buffer continues past its end with its own start
+    if (rb->conf.mirrored || (end_space >= len))
+    {
+        MEMCPY(rb->conf.buffer + offset, src, len);
+    }
+    else
+    {
+        MEMCPY(rb->conf.buffer + offset, src, end_space);
+        MEMCPY(rb->conf.buffer, src + end_space, len - end_space);
+    }
+}
+
+/**
+ * @brief   Copies bytes out of the buffer starting at a byte offset, as at most two copies around the wrap point.
+ * @param   rb Ring buffer to read from.
+ * @param   offset Byte offset where reading starts.
+ * @param   dst Destination bytes (length must not exceed the buffer size).
+ * @param   len Number of bytes to copy.
+ */
+static void _read_bytes(const ring_buffer_t *rb, size_t offset, uint8_t *dst, size_t len)
+{
+    size_t end_space = rb->conf.buffer_size - offset;
+
+    if (rb->conf.mirrored || (end_space >= len))
+    {
+        MEMCPY(dst, rb->conf.buffer + offset, len);
+    }
+    else
+    {
+        MEMCPY(dst, rb->conf.buffer + offset, end_space);
+        MEMCPY(dst + end_space, rb->conf.buffer, len - end_space);
+    }
+}
+
+/**
+ * @brief   Splits a byte range of the buffer into at most two contiguous regions around the wrap point.
+ * @param   rb Ring buffer the range belongs to.
+ * @param   offset Byte offset where the range starts.
+ * @param   len Number of bytes in the range (must not exceed the buffer size).
+ * @param   seg1 Start of the first region.
+ * @param   len1 Length of the first region.
+ * @param   seg2 Start of the second region (NULL when the range does not wrap).
+ * @param   len2 Length of the second region.
+ */
+static void _spans(const ring_buffer_t *rb, size_t offset, size_t len, uint8_t **seg1, size_t *len1, uint8_t **seg2,
+                   size_t *len2)
+{
+    size_t end_space = rb->conf.buffer_size - offset;
+
+    *seg1 = (0 == len) ? NULL : rb->conf.buffer + offset;
+
+    if (rb->conf.mirrored || (end_space >= len))
+    {
+        *len1 = len;
+        *seg2 = NULL;
+        *len2 = 0;
+    }
+    else
+    {
+        *len1 = end_space;
+        *seg2 = rb->conf.buffer;
+        *len2 = len - end_space;
+    }
+}
+
+/**
+ * @brief   Takes a lock hook (nothing when the hook is not configured).
+ * @param   lock Lock hook.
+ */
+static void _lock(const ring_buffer_lock_t *lock)
+{
+    if (NULL != lock->lock)
+    {
+        lock->lock(lock->ctx);
+    }
+}
+
+/**
+ * @brief   Releases a lock hook (nothing when the hook is not configured).
+ * @param   lock Lock hook.
+ */
+static void _unlock(const ring_buffer_lock_t *lock)
+{
+    if (NULL != lock->unlock)
+    {
+        lock->unlock(lock->ctx);
+    }
+}
+
+/**
+ * @brief   Gets the number of stored elements.
+ *
+ * With lock hooks the producer and the consumer side run concurrently under different locks, so the count is the only
+ * field both sides write. It is accessed atomically, and the owner of a side can rely on it only moving one way (the
+ * producer sees it drop, the consumer sees it grow).
+ *
+ * @param   rb Ring buffer to check.
+ * @return  Number of stored elements.
+ */
+static size_t _count(const ring_buffer_t *rb)
+{
+    return rb->shared ? RING_BUFFER_ATOMIC_LOAD(&rb->count) : rb->count;
+}
+
+/**
+ * @brief   Publishes elements written at the head (element data is written before the count is increased).
+ * @param   rb Ring buffer to update.
+ * @param   n Number of elements.
+ */
+static void _count_add(ring_buffer_t *rb, size_t n)
+{
+    size_t count;
+
+    if (rb->shared)
+    {
+        count = RING_BUFFER_ATOMIC_ADD(&rb->count, n);
+        _wake(&rb->data_seq, &rb->data_waiters);
+    }
+    else
+    {
+        count = rb->count;
+        rb->count += n;
+    }
+
+    // Empty to non-empty edge
+    if (rb->notify && (0 == count) && (0 != n))
+    {
+        _notify(rb->data_fd, &rb->data_armed);
+    }
+}
+
+/**
+ * @brief   Releases elements read at the tail (element data is read before the count is decreased).
+ * @param   rb Ring buffer to update.
+ * @param   n Number of elements.
+ */
+static void _count_sub(ring_buffer_t *rb, size_t n)
+{
+    size_t count;
+
+    if (rb->shared)
+    {
+        count = RING_BUFFER_ATOMIC_SUB(&rb->count, n);
+        _wake(&rb->space_seq, &rb->space_waiters);
+    }
+    else
+    {
+        count = rb->count;
+        rb->count -= n;
+    }
+
+    // Full to not full edge
+    if (rb->notify && (rb->max_elements == count) && (0 != n))
+    {
+        _notify(rb->space_fd, &rb->space_armed);
+    }
+}
+
+/**
+ * @brief   Inserts one element (producer lock held).
+ * @param   rb Ring buffer to insert into.
+ * @param   data Element to insert.
+ * @return  RING_BUFFER_STATUS_OK or RING_BUFFER_STATUS_ERROR_BUFFER_FULL.
+ */
+static ring_buffer_status_e _insert(ring_buffer_t *rb, const void *data)
+{
+    bool evict = false;
+
+    if (_count(rb) >= rb->max_elements)
+    {
+        if (false == rb->conf.overwrite)
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+
+        // Evicting moves the tail owned by the consumer side, which may have freed an element in the meantime
+        _lock(&rb->conf.consumer_lock);
+        evict = (_count(rb) >= rb->max_elements);
+
+        if (false == evict)
+        {
+            _unlock(&rb->conf.consumer_lock);
+        }
+    }
+
+    // The slot of a partly read element is taken by this one
+    _write_bytes(rb, _offset(rb, rb->head), (const uint8_t *)data, rb->conf.element_size);
+    rb->head = _advance(rb, rb->head, 1);
+    rb->fill_partial = 0;
+
+    if (evict)
+    {
+        // The evicted element may be the one RING_BUFFER_DrainToFd has partly written
+        rb->tail = _advance(rb, rb->tail, 1);
+        rb->drain_partial = 0;
+        _unlock(&rb->conf.consumer_lock);
+    }
+    else
+    {
+        _count_add(rb, 1);
+    }
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Retrieves the oldest element (consumer lock held).
+ * @param   rb Ring buffer to retrieve from.
+ * @param   data Destination of the element.
+ * @return  RING_BUFFER_STATUS_OK or RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY.
+ */
+static ring_buffer_status_e _retrieve(ring_buffer_t *rb, void *data)
+{
+    CHECK_ARGS_SIZE(_count(rb), 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    _read_bytes(rb, _offset(rb, rb->tail), (uint8_t *)data, rb->conf.element_size);
+    rb->tail = _advance(rb, rb->tail, 1);
+    rb->drain_partial = 0;
+
+    _count_sub(rb, 1);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Inserts a run of elements (producer lock held).
+ * @param   rb Ring buffer to insert into.
+ * @param   data Elements to insert.
+ * @param   n Number of elements.
+ * @param   written Number of accepted elements.
+ * @return  RING_BUFFER_STATUS_OK or RING_BUFFER_STATUS_ERROR_BUFFER_FULL.
+ */
+static ring_buffer_status_e _insert_many(ring_buffer_t *rb, const void *data, size_t n, size_t *written)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    size_t count = _count(rb);
+    size_t accepted = n;
+    size_t evicted = 0;
+    bool evict = false;
+
+    if (false == rb->conf.overwrite)
+    {
+        size_t free_elements = rb->max_elements - count;
+        if (0 == free_elements && 0 != n)
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+
+        if (n > free_elements)
+        {
+            n = free_elements;
+            accepted = free_elements;
+        }
+    }
+    else
+    {
+        if (n > rb->max_elements)
+        {
+            // Elements that would be overwritten within the same batch are skipped, the head still moves past them.
+            size_t skipped = n - rb->max_elements;
+            src += skipped * rb->conf.element_size;
+            rb->head = _advance(rb, rb->head, skipped);
+            n = rb->max_elements;
+        }
+
+        if (count + accepted > rb->max_elements)
+        {
+            // Evicting moves the tail owned by the consumer side, take the count again once it is stopped
+            _lock(&rb->conf.consumer_lock);
+            evict = true;
+            count = _count(rb);
+
+            if (count + accepted > rb->max_elements)
+            {
+                evicted = count + accepted - rb->max_elements;
+            }
+        }
+    }
+
+    _write_bytes(rb, _offset(rb, rb->head), src, n * rb->conf.element_size);
+    rb->head = _advance(rb, rb->head, n);
+    rb->tail = _advance(rb, rb->tail, evicted);
+    _count_add(rb, accepted - evicted);
+
+    // Partly transferred elements at either end are gone once the head or the tail moved past them
+    if (0 != accepted)
+    {
+        rb->fill_partial = 0;
+    }
+
+    if (0 != evicted)
+    {
+        rb->drain_partial = 0;
+    }
+
+    if (evict)
+    {
+        _unlock(&rb->conf.consumer_lock);
+    }
+
+    *written = accepted;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Retrieves a run of the oldest elements (consumer lock held).
+ * @param   rb Ring buffer to retrieve from.
+ * @param   data Destination with room for n elements.
+ * @param   n Maximum number of elements.
+ * @param   read Number of retrieved elements.
+ * @return  RING_BUFFER_STATUS_OK or RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY.
+ */
+static ring_buffer_status_e _retrieve_many(ring_buffer_t *rb, void *data, size_t n, size_t *read)
+{
+    size_t count = _count(rb);
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    if (n > count)
+    {
+        n = count;
+    }
+
+    _read_bytes(rb, _offset(rb, rb->tail), (uint8_t *)data, n * rb->conf.element_size);
+    rb->tail = _advance(rb, rb->tail, n);
+    _count_sub(rb, n);
+
+    if (0 != n)
+    {
+        rb->drain_partial = 0;
+    }
+
+    *read = n;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Copies out the element at an index from the oldest one (consumer lock held).
+ * @param   rb Ring buffer to peek into.
+ * @param   index Index of the element.
+ * @param   data Destination of the element.
+ * @return  RING_BUFFER_STATUS_OK, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY or RING_BUFFER_STATUS_ERROR_INVALID_INDEX.
+ */
+static ring_buffer_status_e _peek(ring_buffer_t *rb, size_t index, void *data)
+{
+    size_t count = _count(rb);
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    if (index >= count)
+    {
+        return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;
+    }
+
+    _read_bytes(rb, _offset(rb, _advance(rb, rb->tail, index)), (uint8_t *)data, rb->conf.element_size);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Overwrites the element at an index from the oldest one (consumer lock held).
+ * @param   rb Ring buffer to write into.
+ * @param   index Index of the element.
+ * @param   data New element data.
+ * @return  RING_BUFFER_STATUS_OK, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY or RING_BUFFER_STATUS_ERROR_INVALID_INDEX.
+ */
+static ring_buffer_status_e _replace(ring_buffer_t *rb, size_t index, const void *data)
+{
+    size_t count = _count(rb);
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    if (index >= count)
+    {
+        return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;
+    }
+
+    _write_bytes(rb, _offset(rb, _advance(rb, rb->tail, index)), (const uint8_t *)data, rb->conf.element_size);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Checks a window of stored elements and resolves its first byte (consumer lock held).
+ * @param   rb Ring buffer the window belongs to.
+ * @param   start Index of the first element from the oldest one.
+ * @param   n Number of elements.
+ * @param   offset Byte offset of the first element inside the buffer.
+ * @return  RING_BUFFER_STATUS_OK, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY or RING_BUFFER_STATUS_ERROR_INVALID_INDEX.
+ */
+static ring_buffer_status_e _range(ring_buffer_t *rb, size_t start, size_t n, size_t *offset)
+{
+    size_t count = _count(rb);
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    if ((start >= count) || (n > count - start))
+    {
+        return RING_BUFFER_STATUS_ERROR_INVALID_INDEX;
+    }
+
+    *offset = _offset(rb, _advance(rb, rb->tail, start));
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Splits the stored elements into the contiguous runs before and after the wrap point (consumer lock held).
+ * @param   rb Ring buffer to split.
+ * @param   seg1 Start of the first run (oldest element).
+ * @param   n1 Number of elements in the first run.
+ * @param   seg2 Start of the second run (NULL when not used).
+ * @param   n2 Number of elements in the second run.
+ * @return  RING_BUFFER_STATUS_OK, RING_BUFFER_STATUS_ERROR_INPUT_ARGS or RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY.
+ */
+static ring_buffer_status_e _segments(ring_buffer_t *rb, uint8_t **seg1, size_t *n1, uint8_t **seg2, size_t *n2)
+{
+    // An element split at the wrap point has no pointer into the buffer that covers it
+    if (rb->conf.records || ((false == rb->conf.mirrored) && (0 != (rb->conf.buffer_size % rb->conf.element_size))))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    size_t count = _count(rb);
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    size_t len1;
+    size_t len2;
+
+    _spans(rb, _offset(rb, rb->tail), count * rb->conf.element_size, seg1, &len1, seg2, &len2);
+    *n1 = len1 / rb->conf.element_size;
+    *n2 = len2 / rb->conf.element_size;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Calls a callback for each stored element in place, oldest first, until it returns false.
+ * @param   rb Ring buffer to walk.
+ * @param   visit Read-only callback (NULL when map is used).
+ * @param   map Modifying callback (NULL when visit is used).
+ * @param   ctx Context passed to the callback.
+ * @return  RING_BUFFER_STATUS_OK or the error of _segments.
+ */
+static ring_buffer_status_e _walk(ring_buffer_t *rb, ring_buffer_visit_fn_t visit, ring_buffer_map_fn_t map, void *ctx)
+{
+    uint8_t *seg[2];
+    size_t n[2];
+
+    _lock(&rb->conf.consumer_lock);
+
+    ring_buffer_status_e status = _segments(rb, &seg[0], &n[0], &seg[1], &n[1]);
+    bool next = (RING_BUFFER_STATUS_OK == status);
+
+    for (size_t s = 0; next && (s < 2); s++)
+    {
+        for (size_t i = 0; next && (i < n[s]); i++)
+        {
+            uint8_t *element = seg[s] + i * rb->conf.element_size;
+
+            next = (NULL != map) ? map(element, ctx) : visit(element, ctx);
+        }
+    }
+
+    _unlock(&rb->conf.consumer_lock);
+
+    return status;
+}
+
+/**
+ * @brief   Gets the number of bytes skipped before a record written at a position, so it does not wrap.
+ *
+ * When the end of the buffer has room for a header but not for the whole record, a _RECORD_SKIP header is written
+ * there. A shorter end is skipped by both sides without a marker. A mirrored buffer never skips.
+ *
+ * @param   rb Ring buffer in record mode.
+ * @param   pos Head position where the record would start.
+ * @param   len Record payload length.
+ * @return  Number of skipped bytes (0 when the record fits before the wrap point).
+ */
+static size_t _record_pad(const ring_buffer_t *rb, size_t pos, size_t len)
+{
+    size_t end_space = rb->conf.buffer_size - _offset(rb, pos);
+
+    if (rb->conf.mirrored || (end_space >= RING_BUFFER_RECORD_HEADER_SIZE + len))
+    {
+        return 0;
+    }
+
+    return end_space;
+}
+
+/**
+ * @brief   Reads the header of the oldest record (buffer not empty, consumer side held).
+ * @param   rb Ring buffer in record mode.
+ * @param   pad Number of bytes skipped at the tail before the header.
+ * @return  Record payload length.
+ */
+static size_t _record_next(const ring_buffer_t *rb, size_t *pad)
+{
+    size_t end_space = rb->conf.buffer_size - _offset(rb, rb->tail);
+    uint32_t header = _RECORD_SKIP;
+
+    *pad = 0;
+
+    if (rb->conf.mirrored || (end_space >= RING_BUFFER_RECORD_HEADER_SIZE))
+    {
+        _read_bytes(rb, _offset(rb, rb->tail), (uint8_t *)&header, sizeof(header));
+    }
+
+    if (_RECORD_SKIP == header)
+    {
+        *pad = end_space;
+        _read_bytes(rb, _offset(rb, _advance(rb, rb->tail, end_space)), (uint8_t *)&header, sizeof(header));
+    }
+
+    return header;
+}
+
+/**
+ * @brief   Inserts one record with its header, evicting whole oldest records in overwrite mode (producer lock held).
+ * @param   rb Ring buffer in record mode.
+ * @param   data Record payload.
+ * @param   len Record payload length (fits into the empty buffer with its header).
+ * @return  RING_BUFFER_STATUS_OK or RING_BUFFER_STATUS_ERROR_BUFFER_FULL.
+ */
+static ring_buffer_status_e _insert_record(ring_buffer_t *rb, const void *data, size_t len)
+{
+    size_t pad = _record_pad(rb, rb->head, len);
+    size_t need = pad + RING_BUFFER_RECORD_HEADER_SIZE + len;
+    bool consumer_locked = false;
+
+    // Slow path when the record does not fit, or when an empty buffer can start over instead of skipping its end
+    if ((rb->conf.buffer_size - _count(rb) < need) || ((0 != pad) && (0 == _count(rb))))
+    {
+        if ((false == rb->conf.overwrite) && (0 != _count(rb)))
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+
+        // Evicting and rewinding move the tail owned by the consumer side
+        _lock(&rb->conf.consumer_lock);
+        consumer_locked = true;
+
+        while (rb->conf.overwrite && (0 != _count(rb)) && (rb->conf.buffer_size - _count(rb) < need))
+        {
+            size_t skip;
+            size_t evict = _record_next(rb, &skip);
+
+            rb->tail = _advance(rb, rb->tail, skip + RING_BUFFER_RECORD_HEADER_SIZE + evict);
+            _count_sub(rb, skip + RING_BUFFER_RECORD_HEADER_SIZE + evict);
+        }
+
+        // Empty buffer starts over at its beginning, so skipping its end never keeps a record out
+        if (0 == _count(rb))
+        {
+            rb->head = 0;
+            rb->tail = 0;
+            pad = 0;
+            need = RING_BUFFER_RECORD_HEADER_SIZE + len;
+        }
+
+        if (rb->conf.buffer_size - _count(rb) < need)
+        {
+            _unlock(&rb->conf.consumer_lock);
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+    }
+
+    uint32_t header = _RECORD_SKIP;
+
+    if (pad >= RING_BUFFER_RECORD_HEADER_SIZE)
+    {
+        _write_bytes(rb, _offset(rb, rb->head), (const uint8_t *)&header, sizeof(header));
+    }
+
+    size_t pos = _advance(rb, rb->head, pad);
+    header = (uint32_t)len;
+
+    _write_bytes(rb, _offset(rb, pos), (const uint8_t *)&header, sizeof(header));
+    pos = _advance(rb, pos, RING_BUFFER_RECORD_HEADER_SIZE);
+    _write_bytes(rb, _offset(rb, pos), (const uint8_t *)data, len);
+    rb->head = _advance(rb, pos, len);
+
+    _count_add(rb, need);
+
+    if (consumer_locked)
+    {
+        _unlock(&rb->conf.consumer_lock);
+    }
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Wakes the threads parked on a futex word, only when there are any.
+ *
+ * The count update before it and the waiter registration in _park are both sequentially consistent, so either this
+ * load sees the waiter or the waiter sees the new count and does not sleep.
+ *
+ * @param   seq Futex word the waiters sleep on.
+ * @param   waiters Number of parked threads.
+ */
+static void _wake(uint32_t *seq, uint32_t *waiters)
+{
+#if defined(__linux__)
+    if (0 != __atomic_load_n(waiters, __ATOMIC_SEQ_CST))
+    {
+        __atomic_fetch_add(seq, 1, __ATOMIC_SEQ_CST);
+        syscall(SYS_futex, seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    }
+#else
+    (void)seq;
+    (void)waiters;
+#endif /* defined(__linux__) */
+}
+
+/**
+ * @brief   Signals a notifier on an edge, only when it is armed.
+ *
+ * The armed flag is taken with one exchange, so of all edges until the next RING_BUFFER_NotifyAck only the first one
+ * writes to the eventfd.
+ *
+ * @param   fd Eventfd of the notifier.
+ * @param   armed Armed flag of the notifier.
+ */
+static void _notify(int fd, uint32_t *armed)
+{
+#if defined(__linux__)
+    if (0 != __atomic_exchange_n(armed, 0, __ATOMIC_SEQ_CST))
+    {
+        uint64_t one = 1;
+        ssize_t result = write(fd, &one, sizeof(one));
+        (void)result;
+    }
+#else
+    (void)fd;
+    (void)armed;
+#endif /* defined(__linux__) */
+}
+
+#if defined(__linux__)
+
+/**
+ * @brief   Looks up a mapping of RING_BUFFER_MirrorAlloc (_mirrors_mutex held).
+ * @param   buffer Start of the mapping (NULL looks up an unused entry).
+ * @param   size Size of one view of the mapping (0 with a NULL buffer).
+ * @return  Matching entry, or NULL when there is none.
+ */
+static _mirror_t *_mirror_find(const uint8_t *buffer, size_t size)
+{
+    for (size_t i = 0; i < RING_BUFFER_CONF_MIRROR_MAX; i++)
+    {
+        if ((buffer == _mirrors[i].buffer) && (size == _mirrors[i].size))
+        {
+            return &_mirrors[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief   Checks that a buffer is a live mapping of RING_BUFFER_MirrorAlloc with exactly this size.
+ * @param   buffer Start of the buffer.
+ * @param   size Size of the buffer in bytes.
+ * @return  True when the buffer continues past size with its own start.
+ */
+static bool _mirror_tracked(const uint8_t *buffer, size_t size)
+{
+    if (NULL == buffer)
+    {
+        return false;
+    }
+
+    pthread_mutex_lock(&_mirrors_mutex);
+    bool tracked = (NULL != _mirror_find(buffer, size));
+    pthread_mutex_unlock(&_mirrors_mutex);
+
+    return tracked;
+}
+
+/**
+ * @brief   Converts a timeout to an absolute deadline on the monotonic clock.
+ * @param   deadline Deadline to fill.
+ * @param   timeout_ms Timeout in milliseconds.
+ */
+static void _deadline(struct timespec *deadline, uint32_t timeout_ms)
+{
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+
+    deadline->tv_sec += (time_t)(timeout_ms / 1000u);
+    deadline->tv_nsec += (long)(timeout_ms % 1000u) * 1000000L;
+
+    if (deadline->tv_nsec >= 1000000000L)
+    {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+/**
+ * @brief   Gets the time left until a deadline.
+ * @param   deadline Absolute deadline on the monotonic clock.
+ * @param   timeout_ms Original timeout (RING_BUFFER_WAIT_FOREVER never expires, remaining is then not filled).
+ * @param   remaining Time left.
+ * @return  false when the deadline has passed, otherwise true.
+ */
+static bool _remaining(const struct timespec *deadline, uint32_t timeout_ms, struct timespec *remaining)
+{
+    if (RING_BUFFER_WAIT_FOREVER == timeout_ms)
+    {
+        return true;
+    }
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    remaining->tv_sec = deadline->tv_sec - now.tv_sec;
+    remaining->tv_nsec = deadline->tv_nsec - now.tv_nsec;
+
+    if (remaining->tv_nsec < 0)
+    {
+        remaining->tv_sec--;
+        remaining->tv_nsec += 1000000000L;
+    }
+
+    return (remaining->tv_sec > 0) || ((0 == remaining->tv_sec) && (0 != remaining->tv_nsec));
+}
+
+/**
+ * @brief   Checks whether a waiting operation can be retried.
+ * @param   rb Ring buffer to check.
+ * @param   for_data Check for elements (consumer) instead of free space (producer).
+ * @return  true when elements (free space) are available.
+ */
+static bool _ready(ring_buffer_t *rb, bool for_data)
+{
+    size_t count = __atomic_load_n(&rb->count, __ATOMIC_SEQ_CST);
+
+    return for_data ? (0 != count) : (count < rb->max_elements);
+}
+
+/**
+ * @brief   Busy-waits with the CPU pause hint until the operation can be retried or the pauses run out.
+ * @param   rb Ring buffer to wait on.
+ * @param   for_data Wait for elements (consumer) instead of free space (producer).
+ * @param   pauses Maximum number of pause instructions.
+ * @return  true when the operation can be retried.
+ */
+static bool _spin(ring_buffer_t *rb, bool for_data, uint32_t pauses)
+{
+    for (uint32_t i = 0; i < pauses; i++)
+    {
+        if (_ready(rb, for_data))
+        {
+            return true;
+        }
+
+        RING_BUFFER_CPU_PAUSE();
+    }
+
+    return _ready(rb, for_data);
+}
+
+/**
+ * @brief   Sleeps on the futex word of one direction until the opposite side moves the count.
+ *
+ * Wake-ups may be spurious, the caller retries its operation after every return.
+ *
+ * @param   rb Ring buffer to wait on.
+ * @param   for_data Wait for elements (consumer) instead of free space (producer).
+ * @param   timeout Maximum time to sleep (NULL sleeps until woken).
+ */
+static void _park(ring_buffer_t *rb, bool for_data, const struct timespec *timeout)
+{
+    uint32_t *seq = for_data ? &rb->data_seq : &rb->space_seq;
+    uint32_t *waiters = for_data ? &rb->data_waiters : &rb->space_waiters;
+
+    // Register first and check the count again, a thread updating it before the registration did not wake anybody
+    uint32_t value = __atomic_load_n(seq, __ATOMIC_SEQ_CST);
+    __atomic_fetch_add(waiters, 1, __ATOMIC_SEQ_CST);
+
+    if (false == _ready(rb, for_data))
+    {
+        syscall(SYS_futex, seq, FUTEX_WAIT_PRIVATE, value, timeout, NULL, 0);
+    }
+
+    __atomic_fetch_sub(waiters, 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief   Waits once with the strategy configured for the ring buffer (see ring_buffer_wait_e).
+ *
+ * The caller retries its operation after every return.
+ *
+ * @param   rb Ring buffer to wait on.
+ * @param   for_data Wait for elements (consumer) instead of free space (producer).
+ * @param   deadline Absolute deadline on the monotonic clock.
+ * @param   timeout_ms Original timeout (RING_BUFFER_WAIT_FOREVER ignores the deadline).
+ * @param   round Number of earlier waits of the same call (starts at 0, updated for the backoff).
+ * @return  false when the deadline has passed, otherwise true.
+ */
+static bool _wait(ring_buffer_t *rb, bool for_data, const struct timespec *deadline, uint32_t timeout_ms,
+                  uint32_t *round)
+{
+    struct timespec remaining = {0};
+    uint32_t spin = (0 != rb->conf.wait.spin) ? rb->conf.wait.spin : RING_BUFFER_CONF_WAIT_SPIN;
+
+    if (false == _remaining(deadline, timeout_ms, &remaining))
+    {
+        return false;
+    }
+
+    switch (rb->conf.wait.strategy)
+    {
+        case RING_BUFFER_WAIT_SPIN:
+            _spin(rb, for_data, spin);
+            break;
+
+        case RING_BUFFER_WAIT_SPIN_YIELD:
+            if ((0 == *round) && _spin(rb, for_data, spin))
+            {
+                break;
+            }
+
+            (void)sched_yield();
+            break;
+
+        case RING_BUFFER_WAIT_SPIN_PARK:
+            // Spin 1, 2, 4, ... pauses per round until a round would exceed the spin budget, then sleep
+            if ((*round < 32) && (((uint32_t)1 << *round) <= spin))
+            {
+                _spin(rb, for_data, (uint32_t)1 << *round);
+                break;
+            }
+
+            _park(rb, for_data, (RING_BUFFER_WAIT_FOREVER == timeout_ms) ? NULL : &remaining);
+            break;
+
+        default:
+            _park(rb, for_data, (RING_BUFFER_WAIT_FOREVER == timeout_ms) ? NULL : &remaining);
+            break;
+    }
+
+    (*round)++;
+
+    return true;
+}
+
+/**
+ * @brief   Moves a run of elements between the buffer and a file descriptor with one writev / readv system call.
+ *
+ * The call never waits for the rest of an element. The bytes of an element transferred so far are kept in partial,
+ * and the next call continues the element where this one stopped, so only whole elements are ever counted.
+ *
+ * @param   rb Ring buffer to transfer from or into.
+ * @param   fd File descriptor.
+ * @param   offset Byte offset of the first element (tail for out, head for in).
+ * @param   n Number of elements to transfer at most, including the one partial continues.
+ * @param   out True to write the buffer to the descriptor, false to read the descriptor into the buffer.
+ * @param   partial Bytes of the first element transferred by earlier calls, updated for the next call.
+ * @param   elements Number of whole elements transferred.
+ * @return  RING_BUFFER_STATUS_OK (also when the descriptor would block), RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY at end
+ *          of file, or RING_BUFFER_STATUS_ERROR when a system call failed or the file ended inside an element.
+ */
+static ring_buffer_status_e _fd_transfer(ring_buffer_t *rb, int fd, size_t offset, size_t n, bool out,
+                                         size_t *partial, size_t *elements)
+{
+    uint8_t *seg1;
+    uint8_t *seg2;
+    size_t len1;
+    size_t len2;
+    ssize_t result;
+
+    *elements = 0;
+
+    if (0 == n)
+    {
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    // An element may straddle the buffer end in byte positioned mode
+    size_t start = offset + *partial;
+
+    if (start >= rb->conf.buffer_size)
+    {
+        start -= rb->conf.buffer_size;
+    }
+
+    _spans(rb, start, n * rb->conf.element_size - *partial, &seg1, &len1, &seg2, &len2);
+
+    struct iovec iov[2] = {{.iov_base = seg1, .iov_len = len1}, {.iov_base = seg2, .iov_len = len2}};
+    int iovcnt = (NULL == seg2) ? 1 : 2;
+
+    do
+    {
+        result = out ? writev(fd, iov, iovcnt) : readv(fd, iov, iovcnt);
+    } while ((result < 0) && (EINTR == errno));
+
+    if (result < 0)
+    {
+        return ((EAGAIN == errno) || (EWOULDBLOCK == errno)) ? RING_BUFFER_STATUS_OK : RING_BUFFER_STATUS_ERROR;
+    }
+
+    if ((0 == result) && (false == out))
+    {
+        return (0 == *partial) ? RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY : RING_BUFFER_STATUS_ERROR;
+    }
+
+    size_t done = *partial + (size_t)result;
+
+    *elements = done / rb->conf.element_size;
+    *partial = done % rb->conf.element_size;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+#endif /* defined(__linux__) */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,742 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_aio.c
+ * @brief       The component RING-BUFFER asynchronous drain engine (io_uring with a pwrite thread pool fallback).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-26
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+// GNU / POSIX interfaces used below (syscall, MAP_POPULATE, pwrite) are not declared in strict C99 mode
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_aio.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif /* __has_include(<linux/io_uring.h>) */
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define _REQUEST_FREE    (0) //< Not in flight.
+#define _REQUEST_QUEUED  (1) //< Handed to the backend (submitted to io_uring or waiting for a thread).
+#define _REQUEST_RUNNING (2) //< A pwrite thread is writing it.
+#define _REQUEST_DONE    (3) //< Completely written.
+#define _REQUEST_FAILED  (4) //< Write failed, see error.
+
+#define _CHUNK_MAX (1U << 30) //< Largest single write, fits the 32 bit length of an io_uring entry.
+
+#if defined(IORING_OFF_SQES) && defined(__NR_io_uring_setup)
+#define _URING_USE (true) //< Kernel headers provide io_uring.
+#else
+#define _URING_USE (false) //< Built without io_uring, the pwrite threads are the only backend.
+#endif /* defined(IORING_OFF_SQES) && defined(__NR_io_uring_setup) */
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+static ring_buffer_status_e _uring_init(ring_buffer_aio_t *aio);
+static void _uring_deinit(ring_buffer_aio_t *aio);
+static void _uring_push(ring_buffer_aio_t *aio, size_t index);
+static ring_buffer_status_e _uring_enter(ring_buffer_aio_t *aio, size_t submit, bool wait);
+static void _uring_reap(ring_buffer_aio_t *aio);
+static ring_buffer_status_e _threads_init(ring_buffer_aio_t *aio);
+static void _threads_deinit(ring_buffer_aio_t *aio);
+static void *_worker(void *arg);
+static bool _busy(const ring_buffer_aio_t *aio);
+static void _guard(ring_buffer_aio_t *aio);
+static void _unguard(ring_buffer_aio_t *aio);
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_AIO_Init(ring_buffer_aio_t *aio, ring_buffer_t *rb, ring_buffer_aio_conf_t conf)
+{
+    CHECK_ARGS_NULL_PTR(aio, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    conf.depth = (0 == conf.depth) ? RING_BUFFER_CONF_AIO_DEPTH : conf.depth;
+    conf.threads = (0 == conf.threads) ? RING_BUFFER_CONF_AIO_THREADS : conf.threads;
+    conf.chunk = ((0 == conf.chunk) || (conf.chunk > _CHUNK_MAX)) ? _CHUNK_MAX : conf.chunk;
+
+    // Elements in flight must not be evicted, and skip markers of records are no file content
+    if ((conf.fd < 0) || (RING_BUFFER_AIO_BACKEND_MAX <= conf.backend) || (conf.depth > RING_BUFFER_CONF_AIO_DEPTH) ||
+        (conf.threads > RING_BUFFER_CONF_AIO_THREADS) || rb->conf.overwrite || rb->conf.records)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    MEMSET(aio, 0, sizeof(ring_buffer_aio_t));
+
+    aio->conf = conf;
+    aio->rb = rb;
+    aio->offset = conf.offset;
+    aio->uring.fd = -1;
+
+    ring_buffer_status_e status = RING_BUFFER_STATUS_ERROR;
+
+    if (RING_BUFFER_AIO_BACKEND_THREADS != conf.backend)
+    {
+        status = _uring_init(aio);
+        aio->backend = RING_BUFFER_AIO_BACKEND_IO_URING;
+    }
+
+    if ((RING_BUFFER_STATUS_OK != status) && (RING_BUFFER_AIO_BACKEND_IO_URING != conf.backend))
+    {
+        status = _threads_init(aio);
+        aio->backend = RING_BUFFER_AIO_BACKEND_THREADS;
+    }
+
+    if (RING_BUFFER_STATUS_OK != status)
+    {
+        aio->rb = NULL;
+    }
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_AIO_DeInit(ring_buffer_aio_t *aio)
+{
+    CHECK_ARGS_NULL_PTR(aio, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(aio->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t released;
+
+    if (RING_BUFFER_AIO_BACKEND_IO_URING == aio->backend)
+    {
+        // The kernel still reads the ring buffer memory of submitted writes
+        while (_busy(aio) && (RING_BUFFER_STATUS_OK == _uring_enter(aio, 0, true)))
+        {
+            _uring_reap(aio);
+        }
+
+        RING_BUFFER_AIO_Reap(aio, false, &released);
+        _uring_deinit(aio);
+    }
+    else
+    {
+        pthread_mutex_lock(&aio->mutex);
+        while (_busy(aio))
+        {
+            pthread_cond_wait(&aio->finished, &aio->mutex);
+        }
+        pthread_mutex_unlock(&aio->mutex);
+
+        RING_BUFFER_AIO_Reap(aio, false, &released);
+        _threads_deinit(aio);
+    }
+
+    MEMSET(aio, 0, sizeof(ring_buffer_aio_t));
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_AIO_Submit(ring_buffer_aio_t *aio, size_t *submitted)
+{
+    CHECK_ARGS_NULL_PTR(aio, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(submitted, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(aio->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *submitted = 0;
+
+    if (aio->used >= aio->conf.depth)
+    {
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    const void *seg[2];
+    size_t len[2];
+
+    ring_buffer_status_e status = RING_BUFFER_PeekSpans(aio->rb, SIZE_MAX, &seg[0], &len[0], &seg[1], &len[1]);
+    if (RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY == status)
+    {
+        return RING_BUFFER_STATUS_OK;
+    }
+
+    // The stored regions do not move while only this engine consumes, give the consumer lock back at once
+    RING_BUFFER_Consume(aio->rb, 0);
+
+    size_t skip = aio->submitted;
+    size_t count = 0;
+
+    _guard(aio);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        if (skip >= len[i])
+        {
+            skip -= len[i];
+            continue;
+        }
+
+        const uint8_t *data = (const uint8_t *)seg[i] + skip;
+        size_t rest = len[i] - skip;
+
+        skip = 0;
+
+        // Cut the region into requests, up to the free request slots
+        while ((0 != rest) && (aio->used < aio->conf.depth))
+        {
+            size_t index = (aio->first + aio->used) % aio->conf.depth;
+            ring_buffer_aio_request_t *request = &aio->requests[index];
+            size_t piece = (rest > aio->conf.chunk) ? aio->conf.chunk : rest;
+
+            request->data = data;
+            request->len = piece;
+            request->done = 0;
+            request->offset = aio->offset;
+            request->state = _REQUEST_QUEUED;
+            request->error = 0;
+
+            if (RING_BUFFER_AIO_BACKEND_IO_URING == aio->backend)
+            {
+                _uring_push(aio, index);
+            }
+
+            aio->offset += piece;
+            aio->submitted += piece;
+            aio->used++;
+            *submitted += piece;
+            data += piece;
+            rest -= piece;
+            count++;
+        }
+    }
+
+    if (RING_BUFFER_AIO_BACKEND_THREADS == aio->backend)
+    {
+        pthread_cond_broadcast(&aio->work);
+    }
+
+    _unguard(aio);
+
+    if ((RING_BUFFER_AIO_BACKEND_IO_URING == aio->backend) && (0 != count))
+    {
+        return _uring_enter(aio, count, false);
+    }
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_AIO_Reap(ring_buffer_aio_t *aio, bool wait, size_t *released)
+{
+    CHECK_ARGS_NULL_PTR(aio, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(released, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(aio->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    ring_buffer_status_e status = RING_BUFFER_STATUS_OK;
+
+    *released = 0;
+
+    if (RING_BUFFER_AIO_BACKEND_IO_URING == aio->backend)
+    {
+        _uring_reap(aio);
+
+        while (wait && (0 != aio->used) && (_REQUEST_QUEUED == aio->requests[aio->first].state) &&
+               (RING_BUFFER_STATUS_OK == status))
+        {
+            status = _uring_enter(aio, 0, true);
+            _uring_reap(aio);
+        }
+    }
+    else
+    {
+        pthread_mutex_lock(&aio->mutex);
+
+        while (wait && (0 != aio->used) && ((_REQUEST_QUEUED == aio->requests[aio->first].state) ||
+                                            (_REQUEST_RUNNING == aio->requests[aio->first].state)))
+        {
+            pthread_cond_wait(&aio->finished, &aio->mutex);
+        }
+    }
+
+    // Completed prefix in ring buffer order
+    while ((0 != aio->used) && (_REQUEST_DONE == aio->requests[aio->first].state))
+    {
+        aio->completed += aio->requests[aio->first].len;
+        aio->requests[aio->first].state = _REQUEST_FREE;
+        aio->first = (aio->first + 1) % aio->conf.depth;
+        aio->used--;
+    }
+
+    if ((0 != aio->used) && (_REQUEST_FAILED == aio->requests[aio->first].state))
+    {
+        status = RING_BUFFER_STATUS_ERROR;
+    }
+
+    if (RING_BUFFER_AIO_BACKEND_THREADS == aio->backend)
+    {
+        pthread_mutex_unlock(&aio->mutex);
+    }
+
+    // Only whole elements leave the ring buffer, a write may end inside one
+    size_t elements = aio->completed / aio->rb->conf.element_size;
+
+    if (0 != elements)
+    {
+        const void *seg1;
+        const void *seg2;
+        size_t len1;
+        size_t len2;
+
+        RING_BUFFER_PeekSpans(aio->rb, elements, &seg1, &len1, &seg2, &len2);
+        RING_BUFFER_Consume(aio->rb, elements);
+
+        aio->completed -= elements * aio->rb->conf.element_size;
+        aio->submitted -= elements * aio->rb->conf.element_size;
+        *released = elements;
+    }
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_AIO_Flush(ring_buffer_aio_t *aio)
+{
+    CHECK_ARGS_NULL_PTR(aio, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(aio->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    ring_buffer_status_e status;
+    size_t submitted;
+    size_t released;
+
+    while (true)
+    {
+        status = RING_BUFFER_AIO_Submit(aio, &submitted);
+
+        // Nothing in flight after a submit means nothing is stored either
+        if ((RING_BUFFER_STATUS_OK != status) || (0 == aio->used))
+        {
+            return status;
+        }
+
+        status = RING_BUFFER_AIO_Reap(aio, true, &released);
+        if (RING_BUFFER_STATUS_OK != status)
+        {
+            return status;
+        }
+    }
+}
+
+ring_buffer_status_e RING_BUFFER_AIO_GetInFlight(ring_buffer_aio_t *aio, size_t *result)
+{
+    CHECK_ARGS_NULL_PTR(aio, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(aio->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *result = aio->used;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Sets up an io_uring instance with raw system calls and maps its rings.
+ *
+ * The ring buffer memory (both views of a mirrored buffer) is registered as fixed buffer 0 so the kernel does not pin
+ * the pages on every write. Registration fails above RLIMIT_MEMLOCK, plain writes are used then.
+ *
+ * @param   aio Drain engine to set up.
+ * @return  RING_BUFFER_STATUS_OK, or RING_BUFFER_STATUS_ERROR when io_uring is not available.
+ */
+static ring_buffer_status_e _uring_init(ring_buffer_aio_t *aio)
+{
+#if (true == _URING_USE)
+    ring_buffer_aio_uring_t *uring = &aio->uring;
+    struct io_uring_params params;
+
+    MEMSET(&params, 0, sizeof(params));
+
+    int fd = (int)syscall(__NR_io_uring_setup, (unsigned)aio->conf.depth, &params);
+    if (fd < 0)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    uring->fd = fd;
+    uring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    uring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    uring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    bool single = (0 != (params.features & IORING_FEAT_SINGLE_MMAP));
+
+    if (single)
+    {
+        // One mapping holds both rings
+        uring->sq_ring_size = (uring->cq_ring_size > uring->sq_ring_size) ? uring->cq_ring_size : uring->sq_ring_size;
+        uring->cq_ring_size = uring->sq_ring_size;
+    }
+
+    void *sq_ring = mmap(NULL, uring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                         (off_t)IORING_OFF_SQ_RING);
+    void *cq_ring = single ? sq_ring
+                           : mmap(NULL, uring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                                  (off_t)IORING_OFF_CQ_RING);
+    void *sqes = mmap(NULL, uring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                      (off_t)IORING_OFF_SQES);
+
+    uring->sq_ring = (MAP_FAILED == sq_ring) ? NULL : sq_ring;
+    uring->cq_ring = (MAP_FAILED == cq_ring) ? NULL : cq_ring;
+    uring->sqes = (MAP_FAILED == sqes) ? NULL : sqes;
+
+    if ((NULL == uring->sq_ring) || (NULL == uring->cq_ring) || (NULL == uring->sqes))
+    {
+        _uring_deinit(aio);
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    uring->sq_head = (uint32_t *)(void *)((uint8_t *)sq_ring + params.sq_off.head);
+    uring->sq_tail = (uint32_t *)(void *)((uint8_t *)sq_ring + params.sq_off.tail);
+    uring->sq_mask = (uint32_t *)(void *)((uint8_t *)sq_ring + params.sq_off.ring_mask);
+    uring->sq_array = (uint32_t *)(void *)((uint8_t *)sq_ring + params.sq_off.array);
+    uring->cq_head = (uint32_t *)(void *)((uint8_t *)cq_ring + params.cq_off.head);
+    uring->cq_tail = (uint32_t *)(void *)((uint8_t *)cq_ring + params.cq_off.tail);
+    uring->cq_mask = (uint32_t *)(void *)((uint8_t *)cq_ring + params.cq_off.ring_mask);
+    uring->cqes = (uint8_t *)cq_ring + params.cq_off.cqes;
+
+    struct iovec iov = {
+        .iov_base = aio->rb->conf.buffer,
+        .iov_len = aio->rb->conf.mirrored ? 2 * aio->rb->conf.buffer_size : aio->rb->conf.buffer_size,
+    };
+
+    uring->registered = (0 == syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, &iov, 1));
+
+    return RING_BUFFER_STATUS_OK;
+#else
+    (void)aio;
+
+    return RING_BUFFER_STATUS_ERROR;
+#endif /* (true == _URING_USE) */
+}
+
+/**
+ * @brief   Unmaps the rings and closes the io_uring instance (also after a partial setup).
+ * @param   aio Drain engine to tear down.
+ */
+static void _uring_deinit(ring_buffer_aio_t *aio)
+{
+    ring_buffer_aio_uring_t *uring = &aio->uring;
+
+    if (NULL != uring->sqes)
+    {
+        munmap(uring->sqes, uring->sqes_size);
+    }
+
+    if ((NULL != uring->cq_ring) && (uring->cq_ring != uring->sq_ring))
+    {
+        munmap(uring->cq_ring, uring->cq_ring_size);
+    }
+
+    if (NULL != uring->sq_ring)
+    {
+        munmap(uring->sq_ring, uring->sq_ring_size);
+    }
+
+    if (0 <= uring->fd)
+    {
+        close(uring->fd);
+    }
+
+    MEMSET(uring, 0, sizeof(ring_buffer_aio_uring_t));
+    uring->fd = -1;
+}
+
+/**
+ * @brief   Queues a submission entry writing the rest of a request (submitted by the next _uring_enter).
+ *
+ * At most depth requests are in flight and each has at most one entry queued, so the submission ring never overflows.
+ *
+ * @param   aio Drain engine.
+ * @param   index Index of the request, returned as user data of its completion.
+ */
+static void _uring_push(ring_buffer_aio_t *aio, size_t index)
+{
+#if (true == _URING_USE)
+    ring_buffer_aio_uring_t *uring = &aio->uring;
+    ring_buffer_aio_request_t *request = &aio->requests[index];
+    uint32_t tail = *uring->sq_tail;
+    uint32_t slot = tail & *uring->sq_mask;
+    struct io_uring_sqe *sqe = (struct io_uring_sqe *)uring->sqes + slot;
+
+    MEMSET(sqe, 0, sizeof(struct io_uring_sqe));
+
+    sqe->opcode = uring->registered ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    sqe->fd = aio->conf.fd;
+    sqe->addr = (uint64_t)(uintptr_t)(request->data + request->done);
+    sqe->len = (uint32_t)(request->len - request->done);
+    sqe->off = request->offset + request->done;
+    sqe->buf_index = 0;
+    sqe->user_data = index;
+
+    uring->sq_array[slot] = slot;
+
+    // Entry must be complete before the kernel sees the new tail
+    __atomic_store_n(uring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+#else
+    (void)aio;
+    (void)index;
+#endif /* (true == _URING_USE) */
+}
+
+/**
+ * @brief   Submits the queued entries and optionally waits for one completion.
+ * @param   aio Drain engine.
+ * @param   submit Number of queued entries.
+ * @param   wait True to wait for at least one completion.
+ * @return  RING_BUFFER_STATUS_OK, or RING_BUFFER_STATUS_ERROR when io_uring_enter failed.
+ */
+static ring_buffer_status_e _uring_enter(ring_buffer_aio_t *aio, size_t submit, bool wait)
+{
+#if (true == _URING_USE)
+    long result;
+
+    do
+    {
+        result = syscall(__NR_io_uring_enter, aio->uring.fd, (unsigned)submit, wait ? 1U : 0U,
+                         wait ? IORING_ENTER_GETEVENTS : 0U, NULL, 0);
+    } while ((result < 0) && (EINTR == errno));
+
+    return (result < 0) ? RING_BUFFER_STATUS_ERROR : RING_BUFFER_STATUS_OK;
+#else
+    (void)aio;
+    (void)submit;
+    (void)wait;
+
+    return RING_BUFFER_STATUS_ERROR;
+#endif /* (true == _URING_USE) */
+}
+
+/**
+ * @brief   Applies the available completions to their requests, short writes are queued again for their rest.
+ * @param   aio Drain engine.
+ */
+static void _uring_reap(ring_buffer_aio_t *aio)
+{
+#if (true == _URING_USE)
+    ring_buffer_aio_uring_t *uring = &aio->uring;
+    uint32_t head = *uring->cq_head;
+    uint32_t tail = __atomic_load_n(uring->cq_tail, __ATOMIC_ACQUIRE);
+    size_t again = 0;
+
+    while (head != tail)
+    {
+        const struct io_uring_cqe *cqe = (const struct io_uring_cqe *)uring->cqes + (head & *uring->cq_mask);
+        ring_buffer_aio_request_t *request = &aio->requests[cqe->user_data];
+
+        if (0 < cqe->res)
+        {
+            request->done += (size_t)cqe->res;
+        }
+
+        if ((0 < cqe->res) && (request->done >= request->len))
+        {
+            request->state = _REQUEST_DONE;
+        }
+        else if ((0 < cqe->res) || (-EINTR == cqe->res) || (-EAGAIN == cqe->res))
+        {
+            _uring_push(aio, (size_t)cqe->user_data);
+            again++;
+        }
+        else
+        {
+            request->state = _REQUEST_FAILED;
+            request->error = (0 == cqe->res) ? EIO : -cqe->res;
+        }
+
+        head++;
+    }
+
+    __atomic_store_n(uring->cq_head, head, __ATOMIC_RELEASE);
+
+    if (0 != again)
+    {
+        _uring_enter(aio, again, false);
+    }
+#else
+    (void)aio;
+#endif /* (true == _URING_USE) */
+}
+
+/**
+ * @brief   Starts the pwrite threads.
+ * @param   aio Drain engine.
+ * @return  RING_BUFFER_STATUS_OK, or RING_BUFFER_STATUS_ERROR when no thread could be created.
+ */
+static ring_buffer_status_e _threads_init(ring_buffer_aio_t *aio)
+{
+    pthread_mutex_init(&aio->mutex, NULL);
+    pthread_cond_init(&aio->work, NULL);
+    pthread_cond_init(&aio->finished, NULL);
+    aio->stop = false;
+
+    for (size_t i = 0; i < aio->conf.threads; i++)
+    {
+        if (0 != pthread_create(&aio->workers[i], NULL, _worker, aio))
+        {
+            // Run with the threads that started
+            aio->conf.threads = i;
+            break;
+        }
+    }
+
+    if (0 == aio->conf.threads)
+    {
+        _threads_deinit(aio);
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Stops and joins the pwrite threads (no request may be queued or running).
+ * @param   aio Drain engine.
+ */
+static void _threads_deinit(ring_buffer_aio_t *aio)
+{
+    pthread_mutex_lock(&aio->mutex);
+    aio->stop = true;
+    pthread_cond_broadcast(&aio->work);
+    pthread_mutex_unlock(&aio->mutex);
+
+    for (size_t i = 0; i < aio->conf.threads; i++)
+    {
+        pthread_join(aio->workers[i], NULL);
+    }
+
+    pthread_cond_destroy(&aio->finished);
+    pthread_cond_destroy(&aio->work);
+    pthread_mutex_destroy(&aio->mutex);
+}
+
+/**
+ * @brief   pwrite thread, takes queued requests until the engine stops.
+ * @param   arg Drain engine.
+ * @return  NULL.
+ */
+static void *_worker(void *arg)
+{
+    ring_buffer_aio_t *aio = (ring_buffer_aio_t *)arg;
+
+    pthread_mutex_lock(&aio->mutex);
+
+    while (false == aio->stop)
+    {
+        ring_buffer_aio_request_t *request = NULL;
+
+        for (size_t i = 0; (i < aio->conf.depth) && (NULL == request); i++)
+        {
+            if (_REQUEST_QUEUED == aio->requests[i].state)
+            {
+                request = &aio->requests[i];
+            }
+        }
+
+        if (NULL == request)
+        {
+            pthread_cond_wait(&aio->work, &aio->mutex);
+            continue;
+        }
+
+        request->state = _REQUEST_RUNNING;
+        pthread_mutex_unlock(&aio->mutex);
+
+        size_t done = request->done;
+        int error = 0;
+
+        while (done < request->len)
+        {
+            ssize_t result = pwrite(aio->conf.fd, request->data + done, request->len - done,
+                                    (off_t)(request->offset + done));
+
+            if (0 < result)
+            {
+                done += (size_t)result;
+            }
+            else if ((result < 0) && (EINTR == errno))
+            {
+                continue;
+            }
+            else
+            {
+                error = (result < 0) ? errno : EIO;
+                break;
+            }
+        }
+
+        pthread_mutex_lock(&aio->mutex);
+        request->done = done;
+        request->error = error;
+        request->state = (0 == error) ? _REQUEST_DONE : _REQUEST_FAILED;
+        pthread_cond_broadcast(&aio->finished);
+    }
+
+    pthread_mutex_unlock(&aio->mutex);
+
+    return NULL;
+}
+
+/**
+ * @brief   Checks whether the backend still works on a request.
+ * @param   aio Drain engine.
+ * @return  True when a request is queued or running.
+ */
+static bool _busy(const ring_buffer_aio_t *aio)
+{
+    for (size_t i = 0; i < aio->conf.depth; i++)
+    {
+        if ((_REQUEST_QUEUED == aio->requests[i].state) || (_REQUEST_RUNNING == aio->requests[i].state))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief   Guards the request states against the pwrite threads (nothing to guard with io_uring).
+ * @param   aio Drain engine.
+ */
+static void _guard(ring_buffer_aio_t *aio)
+{
+    if (RING_BUFFER_AIO_BACKEND_THREADS == aio->backend)
+    {
+        pthread_mutex_lock(&aio->mutex);
+    }
+}
+
+/**
+ * @brief   Releases the guard taken by _guard.
+ * @param   aio Drain engine.
+ */
+static void _unguard(ring_buffer_aio_t *aio)
+{
+    if (RING_BUFFER_AIO_BACKEND_THREADS == aio->backend)
+    {
+        pthread_mutex_unlock(&aio->mutex);
+    }
+}
+
+#endif /* defined(__linux__) */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
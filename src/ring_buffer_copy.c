@@ -0,0 +1,275 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_copy.c
+ * @brief       The component RING-BUFFER copy kernels (portable byte loop, machine words, libc and x86-64 vectors).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-14
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if __STDC_HOSTED__
+#include <string.h>
+#endif /* __STDC_HOSTED__ */
+
+#include "ring_buffer/ring_buffer_copy.h"
+
+#ifdef RING_BUFFER_COPY_X86_64
+#include <immintrin.h>
+#endif /* RING_BUFFER_COPY_X86_64 */
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Access to _copy_auto, which RING_BUFFER_CopySelect may store while other threads already copy through it.
+ *          Every kernel is valid at any time, so no ordering is needed beyond the access itself being atomic.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define _COPY_AUTO_LOAD()    __atomic_load_n(&_copy_auto, __ATOMIC_RELAXED)
+#define _COPY_AUTO_STORE(fn) __atomic_store_n(&_copy_auto, (fn), __ATOMIC_RELAXED)
+#else
+#define _COPY_AUTO_LOAD()    (_copy_auto)
+#define _COPY_AUTO_STORE(fn) (_copy_auto = (fn))
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Machine word used by the word kernels (allowed to alias any other type).
+ */
+#if defined(__GNUC__) || defined(__clang__)
+typedef size_t __attribute__((__may_alias__)) _word_t;
+#else
+typedef size_t _word_t;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+// --- Private Variables Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Kernel used by RING_BUFFER_CopyAuto (safe default until RING_BUFFER_CopySelect is called).
+ */
+#if __STDC_HOSTED__
+static ring_buffer_copy_fn _copy_auto = RING_BUFFER_CopyLibc;
+#else
+static ring_buffer_copy_fn _copy_auto = RING_BUFFER_CopyWord;
+#endif /* __STDC_HOSTED__ */
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+void RING_BUFFER_CopyLoop(void *dst, const void *src, size_t len)
+{
+    uint8_t *dstp = (uint8_t *)dst;
+    const uint8_t *srcp = (const uint8_t *)src;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        dstp[i] = srcp[i];
+    }
+}
+
+void RING_BUFFER_CopyWord(void *dst, const void *src, size_t len)
+{
+    uint8_t *dstp = (uint8_t *)dst;
+    const uint8_t *srcp = (const uint8_t *)src;
+
+    if (0 == (((uintptr_t)dstp ^ (uintptr_t)srcp) % sizeof(_word_t)))
+    {
+        while ((len > 0) && (0 != ((uintptr_t)dstp % sizeof(_word_t))))
+        {
+            *dstp++ = *srcp++;
+            len--;
+        }
+
+        _word_t *dstw = (_word_t *)(void *)dstp;
+        const _word_t *srcw = (const _word_t *)(const void *)srcp;
+
+        while (len >= 4 * sizeof(_word_t))
+        {
+            dstw[0] = srcw[0];
+            dstw[1] = srcw[1];
+            dstw[2] = srcw[2];
+            dstw[3] = srcw[3];
+            dstw += 4;
+            srcw += 4;
+            len -= 4 * sizeof(_word_t);
+        }
+
+        while (len >= sizeof(_word_t))
+        {
+            *dstw++ = *srcw++;
+            len -= sizeof(_word_t);
+        }
+
+        dstp = (uint8_t *)dstw;
+        srcp = (const uint8_t *)srcw;
+    }
+
+    while (len > 0)
+    {
+        *dstp++ = *srcp++;
+        len--;
+    }
+}
+
+#if __STDC_HOSTED__
+void RING_BUFFER_CopyLibc(void *dst, const void *src, size_t len)
+{
+    memcpy(dst, src, len);
+}
+#endif /* __STDC_HOSTED__ */
+
+#ifdef RING_BUFFER_COPY_X86_64
+void RING_BUFFER_CopySse2(void *dst, const void *src, size_t len)
+{
+    uint8_t *dstp = (uint8_t *)dst;
+    const uint8_t *srcp = (const uint8_t *)src;
+
+    if (len < 16)
+    {
+        RING_BUFFER_CopyWord(dstp, srcp, len);
+        return;
+    }
+
+    // The last (possibly overlapping) vector is loaded up front, so the tail needs no scalar loop
+    __m128i last = _mm_loadu_si128((const __m128i *)(const void *)(srcp + len - 16));
+    uint8_t *dst_last = dstp + len - 16;
+
+    while (len > 64)
+    {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(const void *)(srcp + 0));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(const void *)(srcp + 16));
+        __m128i v2 = _mm_loadu_si128((const __m128i *)(const void *)(srcp + 32));
+        __m128i v3 = _mm_loadu_si128((const __m128i *)(const void *)(srcp + 48));
+        _mm_storeu_si128((__m128i *)(void *)(dstp + 0), v0);
+        _mm_storeu_si128((__m128i *)(void *)(dstp + 16), v1);
+        _mm_storeu_si128((__m128i *)(void *)(dstp + 32), v2);
+        _mm_storeu_si128((__m128i *)(void *)(dstp + 48), v3);
+        dstp += 64;
+        srcp += 64;
+        len -= 64;
+    }
+
+    while (len > 16)
+    {
+        _mm_storeu_si128((__m128i *)(void *)dstp, _mm_loadu_si128((const __m128i *)(const void *)srcp));
+        dstp += 16;
+        srcp += 16;
+        len -= 16;
+    }
+
+    _mm_storeu_si128((__m128i *)(void *)dst_last, last);
+}
+
+__attribute__((target("avx2"))) void RING_BUFFER_CopyAvx2(void *dst, const void *src, size_t len)
+{
+    uint8_t *dstp = (uint8_t *)dst;
+    const uint8_t *srcp = (const uint8_t *)src;
+
+    if (len < 32)
+    {
+        RING_BUFFER_CopySse2(dstp, srcp, len);
+        return;
+    }
+
+    // The last (possibly overlapping) vector is loaded up front, so the tail needs no scalar loop
+    __m256i last = _mm256_loadu_si256((const __m256i *)(const void *)(srcp + len - 32));
+    uint8_t *dst_last = dstp + len - 32;
+
+    while (len > 128)
+    {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(const void *)(srcp + 0));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(const void *)(srcp + 32));
+        __m256i v2 = _mm256_loadu_si256((const __m256i *)(const void *)(srcp + 64));
+        __m256i v3 = _mm256_loadu_si256((const __m256i *)(const void *)(srcp + 96));
+        _mm256_storeu_si256((__m256i *)(void *)(dstp + 0), v0);
+        _mm256_storeu_si256((__m256i *)(void *)(dstp + 32), v1);
+        _mm256_storeu_si256((__m256i *)(void *)(dstp + 64), v2);
+        _mm256_storeu_si256((__m256i *)(void *)(dstp + 96), v3);
+        dstp += 128;
+        srcp += 128;
+        len -= 128;
+    }
+
+    while (len > 32)
+    {
+        _mm256_storeu_si256((__m256i *)(void *)dstp, _mm256_loadu_si256((const __m256i *)(const void *)srcp));
+        dstp += 32;
+        srcp += 32;
+        len -= 32;
+    }
+
+    _mm256_storeu_si256((__m256i *)(void *)dst_last, last);
+}
+
+bool RING_BUFFER_CopyAvx2Supported(void)
+{
+    __builtin_cpu_init();
+
+    return (0 != __builtin_cpu_supports("avx2"));
+}
+#endif /* RING_BUFFER_COPY_X86_64 */
+
+void RING_BUFFER_CopyAuto(void *dst, const void *src, size_t len)
+{
+    ring_buffer_copy_fn copy = _COPY_AUTO_LOAD();
+
+    copy(dst, src, len);
+}
+
+ring_buffer_copy_fn RING_BUFFER_CopySelect(void)
+{
+#ifdef RING_BUFFER_COPY_X86_64
+    ring_buffer_copy_fn copy = RING_BUFFER_CopyAvx2Supported() ? RING_BUFFER_CopyAvx2 : RING_BUFFER_CopySse2;
+
+    // Concurrent RING_BUFFER_Init calls all store the same kernel
+    _COPY_AUTO_STORE(copy);
+#endif /* RING_BUFFER_COPY_X86_64 */
+
+    return _COPY_AUTO_LOAD();
+}
+
+void RING_BUFFER_SetLoop(void *dst, uint8_t val, size_t len)
+{
+    uint8_t *dstp = (uint8_t *)dst;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        dstp[i] = val;
+    }
+}
+
+void RING_BUFFER_SetWord(void *dst, uint8_t val, size_t len)
+{
+    uint8_t *dstp = (uint8_t *)dst;
+
+    while ((len > 0) && (0 != ((uintptr_t)dstp % sizeof(_word_t))))
+    {
+        *dstp++ = val;
+        len--;
+    }
+
+    _word_t word = ((_word_t)-1 / 0xFFu) * val;
+    _word_t *dstw = (_word_t *)(void *)dstp;
+
+    while (len >= sizeof(_word_t))
+    {
+        *dstw++ = word;
+        len -= sizeof(_word_t);
+    }
+
+    dstp = (uint8_t *)dstw;
+
+    while (len > 0)
+    {
+        *dstp++ = val;
+        len--;
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,577 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_file.c
+ * @brief       The component RING-BUFFER persistent variant backed by a memory-mapped file (crash recoverable).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-25
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+// GNU / POSIX interfaces used below (O_CLOEXEC, ftruncate, clock_gettime) are not declared in strict C99 mode
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer_atomic.h"
+#include "ring_buffer/ring_buffer_file.h"
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Header at the start of every slot, the element follows it.
+ *
+ * A slot holds the element with sequence number seq when its CRC over seq and the element matches, so a slot written
+ * in another lap or torn by a crash is never taken for the element a header or a scan is looking for.
+ */
+typedef struct
+{
+    uint64_t seq;      /// Sequence number of the stored element.
+    uint32_t crc;      /// CRC-32 of seq and the element.
+    uint32_t reserved; /// Zero.
+} _slot_t;
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+static uint32_t _crc32(uint32_t crc, const void *data, size_t len);
+static size_t _data_offset(void);
+static _slot_t *_slot(const ring_buffer_file_t *rb, uint64_t seq);
+static uint32_t _slot_crc(const ring_buffer_file_t *rb, const _slot_t *slot);
+static bool _slot_valid(const ring_buffer_file_t *rb, uint64_t seq);
+static bool _header_valid(const ring_buffer_file_header_t *header);
+static void _commit(ring_buffer_file_t *rb);
+static void _scan(ring_buffer_file_t *rb);
+static uint64_t _now_ms(void);
+static int _msync(const ring_buffer_file_t *rb, size_t offset, size_t len);
+static ring_buffer_status_e _publish(ring_buffer_file_t *rb, uint64_t first, size_t n);
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_FILE_Open(ring_buffer_file_t *rb, ring_buffer_file_conf_t conf)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf.path, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.element_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.elements, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    if (RING_BUFFER_FILE_SYNC_MAX <= conf.sync)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+    RING_BUFFER_CopySelect();
+#endif /* (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO) */
+
+    // Slot and file size must not wrap around
+    if (conf.element_size > SIZE_MAX - sizeof(_slot_t) - (sizeof(uint64_t) - 1))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    // Slots keep the 8 byte alignment of their header
+    size_t slot_size = (sizeof(_slot_t) + conf.element_size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+
+    if (slot_size > (SIZE_MAX - _data_offset()) / conf.elements)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    size_t map_size = _data_offset() + slot_size * conf.elements;
+
+    int fd = open(conf.path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    struct stat st;
+    bool fresh = false;
+
+    if (0 != fstat(fd, &st))
+    {
+        close(fd);
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    if (0 == st.st_size)
+    {
+        // New file, the zero fill leaves both header copies and every slot invalid
+        if (0 != ftruncate(fd, (off_t)map_size))
+        {
+            close(fd);
+            return RING_BUFFER_STATUS_ERROR;
+        }
+
+        fresh = true;
+    }
+    else if ((size_t)st.st_size != map_size)
+    {
+        close(fd);
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    void *map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == map)
+    {
+        close(fd);
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    rb->conf = conf;
+    rb->fd = fd;
+    rb->map = (uint8_t *)map;
+    rb->map_size = map_size;
+    rb->slot_size = slot_size;
+    rb->head = 0;
+    rb->tail = 0;
+    rb->generation = 0;
+    rb->recovery = RING_BUFFER_FILE_RECOVERY_NEW;
+
+    if (!fresh)
+    {
+        const ring_buffer_file_header_t *headers = (const ring_buffer_file_header_t *)map;
+        const ring_buffer_file_header_t *header = NULL;
+
+        // Newest copy that survived, a crash can only tear the one being written
+        for (size_t i = 0; i < 2; i++)
+        {
+            if (_header_valid(&headers[i]) && ((NULL == header) || (headers[i].generation > header->generation)))
+            {
+                header = &headers[i];
+            }
+        }
+
+        if (NULL == header)
+        {
+            _scan(rb);
+            rb->recovery = RING_BUFFER_FILE_RECOVERY_SCAN;
+        }
+        else if ((header->element_size != conf.element_size) || (header->elements != conf.elements))
+        {
+            munmap(map, map_size);
+            close(fd);
+            rb->map = NULL;
+
+            return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+        }
+        else
+        {
+            rb->head = header->head;
+            rb->tail = header->tail;
+            rb->generation = header->generation;
+            rb->recovery = RING_BUFFER_FILE_RECOVERY_HEADER;
+
+            // Pick up the elements written after this header (normally none or the batch of one interrupted call)
+            while ((rb->head - rb->tail < conf.elements) && _slot_valid(rb, rb->head))
+            {
+                rb->head++;
+            }
+        }
+    }
+
+    _commit(rb);
+    rb->synced_ms = _now_ms();
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_FILE_Close(ring_buffer_file_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->map, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (RING_BUFFER_FILE_SYNC_NONE != rb->conf.sync)
+    {
+        msync(rb->map, rb->map_size, MS_SYNC);
+    }
+
+    munmap(rb->map, rb->map_size);
+    close(rb->fd);
+
+    rb->fd = -1;
+    rb->map = NULL;
+    rb->map_size = 0;
+    rb->head = 0;
+    rb->tail = 0;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_FILE_Insert(ring_buffer_file_t *rb, const void *data)
+{
+    size_t written;
+
+    return RING_BUFFER_FILE_InsertMany(rb, data, 1, &written);
+}
+
+ring_buffer_status_e RING_BUFFER_FILE_Retrieve(ring_buffer_file_t *rb, void *data)
+{
+    size_t read;
+
+    return RING_BUFFER_FILE_RetrieveMany(rb, data, 1, &read);
+}
+
+ring_buffer_status_e RING_BUFFER_FILE_InsertMany(ring_buffer_file_t *rb, const void *data, size_t n, size_t *written)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(written, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->map, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t free_elements = rb->conf.elements - (size_t)(rb->head - rb->tail);
+
+    *written = 0;
+
+    if ((0 == free_elements) && (0 != n))
+    {
+        return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+    }
+
+    if (n > free_elements)
+    {
+        n = free_elements;
+    }
+
+    uint64_t first = rb->head;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        _slot_t *slot = _slot(rb, first + i);
+
+        slot->seq = first + i;
+        MEMCPY(slot + 1, (const uint8_t *)data + i * rb->conf.element_size, rb->conf.element_size);
+        slot->crc = _slot_crc(rb, slot);
+    }
+
+    rb->head = first + n;
+    *written = n;
+
+    return _publish(rb, first, n);
+}
+
+ring_buffer_status_e RING_BUFFER_FILE_RetrieveMany(ring_buffer_file_t *rb, void *data, size_t n, size_t *read)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->map, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t count = (size_t)(rb->head - rb->tail);
+
+    *read = 0;
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    if (n > count)
+    {
+        n = count;
+    }
+
+    size_t i = 0;
+
+    // Same rule as the recovery in Open, the ring ends at the first slot that does not hold its element intact
+    while ((i < n) && _slot_valid(rb, rb->tail + i))
+    {
+        MEMCPY((uint8_t *)data + i * rb->conf.element_size, _slot(rb, rb->tail + i) + 1, rb->conf.element_size);
+        i++;
+    }
+
+    bool torn = (i < n);
+    size_t dropped = 0;
+
+    rb->tail += i;
+    *read = i;
+
+    if (torn)
+    {
+        // Break the CRC of every dropped slot, a scan after a crash must not bring the slots behind the torn one back
+        dropped = (size_t)(rb->head - rb->tail);
+
+        for (size_t j = 0; j < dropped; j++)
+        {
+            _slot_t *slot = _slot(rb, rb->tail + j);
+
+            slot->crc = ~_slot_crc(rb, slot);
+        }
+
+        rb->head = rb->tail;
+    }
+
+    ring_buffer_status_e status = _publish(rb, rb->tail, dropped);
+
+    return torn ? RING_BUFFER_STATUS_ERROR : status;
+}
+
+ring_buffer_status_e RING_BUFFER_FILE_GetCount(ring_buffer_file_t *rb, size_t *result)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->map, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *result = (size_t)(rb->head - rb->tail);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_FILE_Sync(ring_buffer_file_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->map, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (0 != msync(rb->map, rb->map_size, MS_SYNC))
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    rb->synced_ms = _now_ms();
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Continues a CRC-32 (IEEE 802.3, reflected) over a block of bytes, half a byte per table lookup.
+ * @param   crc CRC of the preceding bytes (0 to start).
+ * @param   data Bytes to add.
+ * @param   len Number of bytes.
+ * @return  CRC including the added bytes.
+ */
+static uint32_t _crc32(uint32_t crc, const void *data, size_t len)
+{
+    static const uint32_t table[16] = {0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U,
+                                       0x4DB26158U, 0x5005713CU, 0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+                                       0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU};
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    crc = ~crc;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        crc = table[(crc ^ bytes[i]) & 0x0FU] ^ (crc >> 4);
+        crc = table[(crc ^ (uint32_t)(bytes[i] >> 4)) & 0x0FU] ^ (crc >> 4);
+    }
+
+    return ~crc;
+}
+
+/**
+ * @brief   Offset of the first slot, the two header copies fill the cache lines before it.
+ * @return  Offset in bytes.
+ */
+static size_t _data_offset(void)
+{
+    return ((2 * sizeof(ring_buffer_file_header_t) + RING_BUFFER_CONF_CACHE_LINE_SIZE - 1) /
+            RING_BUFFER_CONF_CACHE_LINE_SIZE) *
+           RING_BUFFER_CONF_CACHE_LINE_SIZE;
+}
+
+/**
+ * @brief   Gets the slot a sequence number maps to.
+ * @param   rb Ring buffer the sequence number belongs to.
+ * @param   seq Sequence number.
+ * @return  Slot header (the element follows it).
+ */
+static _slot_t *_slot(const ring_buffer_file_t *rb, uint64_t seq)
+{
+    return (_slot_t *)(void *)(rb->map + _data_offset() + (size_t)(seq % rb->conf.elements) * rb->slot_size);
+}
+
+/**
+ * @brief   Computes the CRC of a slot over its sequence number and element.
+ * @param   rb Ring buffer the slot belongs to.
+ * @param   slot Slot header.
+ * @return  CRC to store in or compare with slot->crc.
+ */
+static uint32_t _slot_crc(const ring_buffer_file_t *rb, const _slot_t *slot)
+{
+    return _crc32(_crc32(0, &slot->seq, sizeof(slot->seq)), slot + 1, rb->conf.element_size);
+}
+
+/**
+ * @brief   Checks whether the slot of a sequence number holds that element intact.
+ * @param   rb Ring buffer to check.
+ * @param   seq Sequence number.
+ * @return  True when the slot carries seq and a matching CRC.
+ */
+static bool _slot_valid(const ring_buffer_file_t *rb, uint64_t seq)
+{
+    const _slot_t *slot = _slot(rb, seq);
+
+    return (seq == slot->seq) && (_slot_crc(rb, slot) == slot->crc);
+}
+
+/**
+ * @brief   Checks a header copy for a torn or foreign write.
+ * @param   header Header copy to check.
+ * @return  True when magic, version, CRC and the head / tail / count relation hold.
+ */
+static bool _header_valid(const ring_buffer_file_header_t *header)
+{
+    return (RING_BUFFER_FILE_MAGIC == header->magic) && (RING_BUFFER_FILE_VERSION == header->version) &&
+           (_crc32(0, header, offsetof(ring_buffer_file_header_t, crc)) == header->crc) &&
+           (header->tail <= header->head) && (header->head - header->tail == header->count) &&
+           (header->count <= header->elements);
+}
+
+/**
+ * @brief   Writes head and tail to the older header copy, which then becomes the newest one.
+ * @param   rb Ring buffer to commit.
+ */
+static void _commit(ring_buffer_file_t *rb)
+{
+    uint64_t generation = rb->generation + 1;
+    ring_buffer_file_header_t *header = (ring_buffer_file_header_t *)(void *)rb->map + (generation & 1U);
+
+    header->magic = RING_BUFFER_FILE_MAGIC;
+    header->version = RING_BUFFER_FILE_VERSION;
+    header->element_size = rb->conf.element_size;
+    header->elements = rb->conf.elements;
+    header->head = rb->head;
+    header->tail = rb->tail;
+    header->count = rb->head - rb->tail;
+    header->generation = generation;
+    header->crc = _crc32(0, header, offsetof(ring_buffer_file_header_t, crc));
+    header->reserved = 0;
+
+    rb->generation = generation;
+}
+
+/**
+ * @brief   Rebuilds head and tail from the slots when no header copy is valid.
+ *
+ * The head follows the newest intact slot and the tail goes back over the run of intact slots before it, so nothing
+ * that was inserted is lost while elements retrieved but not yet overwritten come back.
+ *
+ * @param   rb Ring buffer to rebuild.
+ */
+static void _scan(ring_buffer_file_t *rb)
+{
+    bool found = false;
+    uint64_t head = 0;
+
+    for (size_t i = 0; i < rb->conf.elements; i++)
+    {
+        const _slot_t *slot = (const _slot_t *)(const void *)(rb->map + _data_offset() + i * rb->slot_size);
+
+        if ((i == slot->seq % rb->conf.elements) && (_slot_crc(rb, slot) == slot->crc) &&
+            (!found || (slot->seq >= head)))
+        {
+            head = slot->seq + 1;
+            found = true;
+        }
+    }
+
+    uint64_t tail = head;
+
+    while ((0 < tail) && (head - tail < rb->conf.elements) && _slot_valid(rb, tail - 1))
+    {
+        tail--;
+    }
+
+    rb->head = head;
+    rb->tail = tail;
+}
+
+/**
+ * @brief   Reads the monotonic clock.
+ * @return  Milliseconds since an arbitrary point.
+ */
+static uint64_t _now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U;
+}
+
+/**
+ * @brief   Flushes a byte range of the mapping, widened to whole pages.
+ * @param   rb Ring buffer to flush.
+ * @param   offset Offset of the range in the mapping.
+ * @param   len Length of the range.
+ * @return  Result of msync.
+ */
+static int _msync(const ring_buffer_file_t *rb, size_t offset, size_t len)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t start = offset - offset % page;
+
+    return msync(rb->map + start, offset + len - start, MS_SYNC);
+}
+
+/**
+ * @brief   Commits head and tail after an insert or retrieve and applies the msync policy.
+ *
+ * With RING_BUFFER_FILE_SYNC_BATCH the written slots reach the file before the header that covers them, so a header
+ * on disk never points past the elements that are on disk, and slots invalidated by a retrieve are never valid on
+ * disk next to a header that dropped them.
+ *
+ * @param   rb Ring buffer to publish.
+ * @param   first Sequence number of the first written slot.
+ * @param   n Number of written slots (inserted, or invalidated by a retrieve that hit a torn slot).
+ * @return  RING_BUFFER_STATUS_OK, or RING_BUFFER_STATUS_ERROR when a flush failed.
+ */
+static ring_buffer_status_e _publish(ring_buffer_file_t *rb, uint64_t first, size_t n)
+{
+    int result = 0;
+
+    if ((RING_BUFFER_FILE_SYNC_BATCH == rb->conf.sync) && (0 != n))
+    {
+        size_t index = (size_t)(first % rb->conf.elements);
+        size_t run = rb->conf.elements - index;
+
+        if (run > n)
+        {
+            run = n;
+        }
+
+        result |= _msync(rb, _data_offset() + index * rb->slot_size, run * rb->slot_size);
+
+        if (run < n)
+        {
+            result |= _msync(rb, _data_offset(), (n - run) * rb->slot_size);
+        }
+    }
+
+    _commit(rb);
+
+    if (RING_BUFFER_FILE_SYNC_BATCH == rb->conf.sync)
+    {
+        result |= _msync(rb, 0, 2 * sizeof(ring_buffer_file_header_t));
+    }
+    else if (RING_BUFFER_FILE_SYNC_PERIODIC == rb->conf.sync)
+    {
+        uint64_t now = _now_ms();
+
+        if (now - rb->synced_ms >= rb->conf.period_ms)
+        {
+            result |= msync(rb->map, rb->map_size, MS_SYNC);
+            rb->synced_ms = now;
+        }
+    }
+
+    return (0 == result) ? RING_BUFFER_STATUS_OK : RING_BUFFER_STATUS_ERROR;
+}
+
+#endif /* defined(__linux__) */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_lock.c
+ * @brief       The component RING-BUFFER lock hook backends (POSIX threads and FreeRTOS mutexes).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-22
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer_lock.h"
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+#ifdef RING_BUFFER_CONF_PTHREAD_USE
+#if (true == RING_BUFFER_CONF_PTHREAD_USE)
+
+static void _pthread_lock(void *ctx);
+static void _pthread_unlock(void *ctx);
+
+#endif /* (true == RING_BUFFER_CONF_PTHREAD_USE) */
+#endif /* RING_BUFFER_CONF_PTHREAD_USE */
+
+#ifdef RING_BUFFER_CONF_FREERTOS_USE
+#if (true == RING_BUFFER_CONF_FREERTOS_USE)
+
+static void _freertos_lock(void *ctx);
+static void _freertos_unlock(void *ctx);
+
+#endif /* (true == RING_BUFFER_CONF_FREERTOS_USE) */
+#endif /* RING_BUFFER_CONF_FREERTOS_USE */
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+#ifdef RING_BUFFER_CONF_PTHREAD_USE
+#if (true == RING_BUFFER_CONF_PTHREAD_USE)
+
+ring_buffer_status_e RING_BUFFER_LOCK_Pthread(ring_buffer_lock_t *lock, pthread_mutex_t *mutex)
+{
+    CHECK_ARGS_NULL_PTR(lock, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(mutex, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    lock->lock = _pthread_lock;
+    lock->unlock = _pthread_unlock;
+    lock->ctx = mutex;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+#endif /* (true == RING_BUFFER_CONF_PTHREAD_USE) */
+#endif /* RING_BUFFER_CONF_PTHREAD_USE */
+
+#ifdef RING_BUFFER_CONF_FREERTOS_USE
+#if (true == RING_BUFFER_CONF_FREERTOS_USE)
+
+ring_buffer_status_e RING_BUFFER_LOCK_FreeRtos(ring_buffer_lock_t *lock, SemaphoreHandle_t mutex)
+{
+    CHECK_ARGS_NULL_PTR(lock, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(mutex, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    lock->lock = _freertos_lock;
+    lock->unlock = _freertos_unlock;
+    lock->ctx = (void *)mutex;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+#endif /* (true == RING_BUFFER_CONF_FREERTOS_USE) */
+#endif /* RING_BUFFER_CONF_FREERTOS_USE */
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+#ifdef RING_BUFFER_CONF_PTHREAD_USE
+#if (true == RING_BUFFER_CONF_PTHREAD_USE)
+
+/**
+ * @brief   Locks a POSIX threads mutex.
+ * @param   ctx Mutex (pthread_mutex_t).
+ */
+static void _pthread_lock(void *ctx)
+{
+    (void)pthread_mutex_lock((pthread_mutex_t *)ctx);
+}
+
+/**
+ * @brief   Unlocks a POSIX threads mutex.
+ * @param   ctx Mutex (pthread_mutex_t).
+ */
+static void _pthread_unlock(void *ctx)
+{
+    (void)pthread_mutex_unlock((pthread_mutex_t *)ctx);
+}
+
+#endif /* (true == RING_BUFFER_CONF_PTHREAD_USE) */
+#endif /* RING_BUFFER_CONF_PTHREAD_USE */
+
+#ifdef RING_BUFFER_CONF_FREERTOS_USE
+#if (true == RING_BUFFER_CONF_FREERTOS_USE)
+
+/**
+ * @brief   Takes a FreeRTOS mutex semaphore (waits forever).
+ * @param   ctx Mutex handle (SemaphoreHandle_t).
+ */
+static void _freertos_lock(void *ctx)
+{
+    (void)xSemaphoreTake((SemaphoreHandle_t)ctx, portMAX_DELAY);
+}
+
+/**
+ * @brief   Gives a FreeRTOS mutex semaphore back.
+ * @param   ctx Mutex handle (SemaphoreHandle_t).
+ */
+static void _freertos_unlock(void *ctx)
+{
+    (void)xSemaphoreGive((SemaphoreHandle_t)ctx);
+}
+
+#endif /* (true == RING_BUFFER_CONF_FREERTOS_USE) */
+#endif /* RING_BUFFER_CONF_FREERTOS_USE */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,202 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_mpmc.c
+ * @brief       The component RING-BUFFER lock-free multi-producer / multi-consumer variant (per-slot sequence numbers).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-20
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer_mpmc.h"
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Sequence number stored at the start of every slot.
+ *
+ * A slot at position pos is free for the producer of that lap when its sequence equals pos, and holds an element for
+ * the consumer when it equals pos + 1. After retrieval it is set to pos + max_elements for the next lap.
+ */
+typedef RING_BUFFER_ATOMIC(size_t) _seq_t;
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+static _seq_t *_slot_seq(const ring_buffer_mpmc_t *rb, size_t pos);
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_MPMC_Init(ring_buffer_mpmc_t *rb, ring_buffer_conf_t conf)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf.buffer, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.buffer_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.element_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    size_t slot_size = RING_BUFFER_MPMC_SLOT_SIZE(conf.element_size);
+
+    if ((conf.buffer_size < slot_size) || conf.overwrite || (0 != ((uintptr_t)conf.buffer % sizeof(_seq_t))))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+    RING_BUFFER_CopySelect();
+#endif /* (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO) */
+
+    // Largest power-of-two number of slots that fits into the buffer
+    size_t max_elements = 1;
+    while (max_elements * 2 <= conf.buffer_size / slot_size)
+    {
+        max_elements *= 2;
+    }
+
+    rb->conf = conf;
+    rb->max_elements = max_elements;
+    rb->mask = max_elements - 1;
+    rb->slot_size = slot_size;
+
+    for (size_t i = 0; i < max_elements; i++)
+    {
+        atomic_init(_slot_seq(rb, i), i);
+    }
+
+    atomic_init(&rb->head, 0);
+    atomic_init(&rb->tail, 0);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MPMC_DeInit(ring_buffer_mpmc_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    MEMSET(&rb->conf, 0, sizeof(ring_buffer_conf_t));
+    rb->max_elements = 0;
+    rb->mask = 0;
+    rb->slot_size = 0;
+    atomic_store_explicit(&rb->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&rb->tail, 0, memory_order_relaxed);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MPMC_Insert(ring_buffer_mpmc_t *rb, const void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t pos = atomic_load_explicit(&rb->head, memory_order_relaxed);
+    _seq_t *seq;
+
+    while (true)
+    {
+        seq = _slot_seq(rb, pos);
+        ptrdiff_t diff = (ptrdiff_t)(atomic_load_explicit(seq, memory_order_acquire) - pos);
+
+        if (0 == diff)
+        {
+            // Slot is free for this lap, claim it (a failed CAS reloads pos)
+            if (atomic_compare_exchange_weak_explicit(&rb->head, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Slot still holds the element of the previous lap
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&rb->head, memory_order_relaxed);
+        }
+    }
+
+    MEMCPY((uint8_t *)seq + sizeof(_seq_t), data, rb->conf.element_size);
+    atomic_store_explicit(seq, pos + 1, memory_order_release);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MPMC_Retrieve(ring_buffer_mpmc_t *rb, void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t pos = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+    _seq_t *seq;
+
+    while (true)
+    {
+        seq = _slot_seq(rb, pos);
+        ptrdiff_t diff = (ptrdiff_t)(atomic_load_explicit(seq, memory_order_acquire) - (pos + 1));
+
+        if (0 == diff)
+        {
+            // Slot holds the element of this lap, claim it (a failed CAS reloads pos)
+            if (atomic_compare_exchange_weak_explicit(&rb->tail, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Slot was not written yet in this lap
+            return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+        }
+    }
+
+    MEMCPY(data, (const uint8_t *)seq + sizeof(_seq_t), rb->conf.element_size);
+    atomic_store_explicit(seq, pos + rb->max_elements, memory_order_release);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MPMC_GetCount(ring_buffer_mpmc_t *rb, size_t *result)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&rb->head, memory_order_acquire);
+    size_t count = head - tail;
+
+    // Head may move on after the tail was loaded, clamp the snapshot to the capacity
+    *result = (count > rb->max_elements) ? rb->max_elements : count;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Gets the sequence number of the slot a position maps to.
+ * @param   rb Ring buffer the position belongs to.
+ * @param   pos Free-running head / tail position.
+ * @return  Sequence number at the start of the slot (the element follows it).
+ */
+static _seq_t *_slot_seq(const ring_buffer_mpmc_t *rb, size_t pos)
+{
+    return (_seq_t *)(void *)(rb->conf.buffer + (pos & rb->mask) * rb->slot_size);
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,190 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_mpsc.c
+ * @brief       The component RING-BUFFER wait-free multi-producer / single-consumer variant (per-slot ready flags).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-21
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer_mpsc.h"
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ready flag of one slot.
+ *
+ * A slot at position pos holds a published element when its flag equals pos + 1. The flag of the next lap is a
+ * different value, so the consumer never has to clear it.
+ */
+typedef RING_BUFFER_ATOMIC(size_t) _flag_t;
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+static void _copy_out(const ring_buffer_mpsc_t *rb, uint8_t *data, size_t pos, size_t n);
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_MPSC_Init(ring_buffer_mpsc_t *rb, ring_buffer_conf_t conf)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf.buffer, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.buffer_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.element_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    size_t slot_size = sizeof(_flag_t) + conf.element_size;
+
+    if ((conf.buffer_size < slot_size) || conf.overwrite || (0 != ((uintptr_t)conf.buffer % sizeof(_flag_t))))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+    RING_BUFFER_CopySelect();
+#endif /* (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO) */
+
+    // Largest power-of-two number of slots that fits into the buffer
+    size_t max_elements = 1;
+    while (max_elements * 2 <= conf.buffer_size / slot_size)
+    {
+        max_elements *= 2;
+    }
+
+    rb->conf = conf;
+    rb->max_elements = max_elements;
+    rb->mask = max_elements - 1;
+    rb->flags = (_flag_t *)(void *)conf.buffer;
+    rb->data = conf.buffer + max_elements * sizeof(_flag_t);
+    rb->tail = 0;
+
+    for (size_t i = 0; i < max_elements; i++)
+    {
+        atomic_init(&rb->flags[i], 0);
+    }
+
+    atomic_init(&rb->head, 0);
+    atomic_init(&rb->credits, (ptrdiff_t)max_elements);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MPSC_DeInit(ring_buffer_mpsc_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    MEMSET(&rb->conf, 0, sizeof(ring_buffer_conf_t));
+    rb->max_elements = 0;
+    rb->mask = 0;
+    rb->flags = NULL;
+    rb->data = NULL;
+    rb->tail = 0;
+    atomic_store_explicit(&rb->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&rb->credits, 0, memory_order_relaxed);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MPSC_Insert(ring_buffer_mpsc_t *rb, const void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    // Take a free slot first, a claimed position can not be given back and the consumer would wait on it forever
+    if (atomic_fetch_sub_explicit(&rb->credits, 1, memory_order_acquire) <= 0)
+    {
+        atomic_fetch_add_explicit(&rb->credits, 1, memory_order_relaxed);
+        return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+    }
+
+    size_t pos = atomic_fetch_add_explicit(&rb->head, 1, memory_order_relaxed);
+
+    MEMCPY(rb->data + (pos & rb->mask) * rb->conf.element_size, data, rb->conf.element_size);
+    atomic_store_explicit(&rb->flags[pos & rb->mask], pos + 1, memory_order_release);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_MPSC_Retrieve(ring_buffer_mpsc_t *rb, void *data)
+{
+    size_t read;
+
+    return RING_BUFFER_MPSC_RetrieveMany(rb, data, 1, &read);
+}
+
+ring_buffer_status_e RING_BUFFER_MPSC_RetrieveMany(ring_buffer_mpsc_t *rb, void *data, size_t n, size_t *read)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t tail = rb->tail;
+    size_t count = 0;
+
+    if (n > rb->max_elements)
+    {
+        n = rb->max_elements;
+    }
+
+    // Contiguous run of published slots starting at the tail
+    while ((count < n) &&
+           ((tail + count + 1) == atomic_load_explicit(&rb->flags[(tail + count) & rb->mask], memory_order_acquire)))
+    {
+        count++;
+    }
+
+    *read = count;
+
+    if (0 == count)
+    {
+        return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+    }
+
+    _copy_out(rb, (uint8_t *)data, tail, count);
+    rb->tail = tail + count;
+
+    // Hand the whole run back to the producers at once
+    atomic_fetch_add_explicit(&rb->credits, (ptrdiff_t)count, memory_order_release);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Copies a run of elements out of the data area (split in two at the wrap).
+ * @param   rb Ring buffer to copy from.
+ * @param   data Destination with room for n elements.
+ * @param   pos Position of the first element.
+ * @param   n Number of elements.
+ */
+static void _copy_out(const ring_buffer_mpsc_t *rb, uint8_t *data, size_t pos, size_t n)
+{
+    size_t index = pos & rb->mask;
+    size_t first = rb->max_elements - index;
+
+    if (first > n)
+    {
+        first = n;
+    }
+
+    MEMCPY(data, rb->data + index * rb->conf.element_size, first * rb->conf.element_size);
+
+    if (first < n)
+    {
+        MEMCPY(data + first * rb->conf.element_size, rb->data, (n - first) * rb->conf.element_size);
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,427 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_shm.c
+ * @brief       The component RING-BUFFER shared-memory single-producer / single-consumer variant (offset based layout).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-24
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+// GNU / POSIX interfaces used below (syscall, memfd_create, F_DUPFD_CLOEXEC) are not declared in strict C99 mode
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer_shm.h"
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/memfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+static ring_buffer_status_e _map(ring_buffer_shm_t *rb, int fd);
+static bool _layout_valid(const ring_buffer_shm_ctrl_t *ctrl, size_t mapped);
+static bool _positions_valid(const ring_buffer_shm_t *rb, size_t head, size_t tail);
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_SHM_Create(ring_buffer_shm_t *rb, const char *name, size_t element_size,
+                                            size_t elements)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(element_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(elements, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+    RING_BUFFER_CopySelect();
+#endif /* (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO) */
+
+    // Element storage starts on the cache line after the control block
+    size_t data_offset = ((sizeof(ring_buffer_shm_ctrl_t) + RING_BUFFER_CONF_CACHE_LINE_SIZE - 1) /
+                          RING_BUFFER_CONF_CACHE_LINE_SIZE) *
+                         RING_BUFFER_CONF_CACHE_LINE_SIZE;
+
+    // Positions run up to 2 * elements and the region size must not wrap around
+    if ((elements > SIZE_MAX / 2) || (element_size > (SIZE_MAX - data_offset) / elements))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    size_t region_size = data_offset + element_size * elements;
+
+    int fd = (NULL != name) ? shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600)
+                            : (int)syscall(SYS_memfd_create, "ring_buffer_shm", MFD_CLOEXEC);
+    if (fd < 0)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    void *region = MAP_FAILED;
+    if (0 == ftruncate(fd, (off_t)region_size))
+    {
+        region = mmap(NULL, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+
+    if (MAP_FAILED == region)
+    {
+        close(fd);
+        if (NULL != name)
+        {
+            shm_unlink(name);
+        }
+
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    ring_buffer_shm_ctrl_t *ctrl = (ring_buffer_shm_ctrl_t *)region;
+
+    ctrl->version = RING_BUFFER_SHM_VERSION;
+    ctrl->element_size = element_size;
+    ctrl->max_elements = elements;
+    ctrl->limit = 2 * elements;
+    ctrl->data_offset = data_offset;
+    ctrl->region_size = region_size;
+    atomic_init(&ctrl->head, 0);
+    atomic_init(&ctrl->tail, 0);
+
+    // Publish the block to attaching processes
+    atomic_store_explicit(&ctrl->magic, RING_BUFFER_SHM_MAGIC, memory_order_release);
+
+    rb->ctrl = ctrl;
+    rb->data = (uint8_t *)region + data_offset;
+    rb->fd = fd;
+    rb->element_size = element_size;
+    rb->max_elements = elements;
+    rb->limit = 2 * elements;
+    rb->region_size = region_size;
+    rb->head_cached = 0;
+    rb->tail_cached = 0;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_Attach(ring_buffer_shm_t *rb, const char *name)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(name, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    ring_buffer_status_e status = _map(rb, fd);
+    if (RING_BUFFER_STATUS_OK != status)
+    {
+        close(fd);
+    }
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_AttachFd(ring_buffer_shm_t *rb, int fd)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    int own = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (own < 0)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    ring_buffer_status_e status = _map(rb, own);
+    if (RING_BUFFER_STATUS_OK != status)
+    {
+        close(own);
+    }
+
+    return status;
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_Detach(ring_buffer_shm_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->ctrl, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    munmap(rb->ctrl, rb->region_size);
+    close(rb->fd);
+
+    rb->ctrl = NULL;
+    rb->data = NULL;
+    rb->fd = -1;
+    rb->element_size = 0;
+    rb->max_elements = 0;
+    rb->limit = 0;
+    rb->region_size = 0;
+    rb->head_cached = 0;
+    rb->tail_cached = 0;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_Unlink(const char *name)
+{
+    CHECK_ARGS_NULL_PTR(name, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    return (0 == shm_unlink(name)) ? RING_BUFFER_STATUS_OK : RING_BUFFER_STATUS_ERROR;
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_Insert(ring_buffer_shm_t *rb, const void *data)
+{
+    size_t written;
+
+    return RING_BUFFER_SHM_InsertMany(rb, data, 1, &written);
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_Retrieve(ring_buffer_shm_t *rb, void *data)
+{
+    size_t read;
+
+    return RING_BUFFER_SHM_RetrieveMany(rb, data, 1, &read);
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_InsertMany(ring_buffer_shm_t *rb, const void *data, size_t n, size_t *written)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(written, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->ctrl, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    ring_buffer_shm_ctrl_t *ctrl = rb->ctrl;
+
+    *written = 0;
+
+    size_t head = atomic_load_explicit(&ctrl->head, memory_order_relaxed);
+
+    // Positions live in memory the peer can write, only the geometry cached at attach time is trusted
+    if (false == _positions_valid(rb, head, rb->tail_cached))
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    size_t free_elements = rb->max_elements - RING_BUFFER_PosUsed(rb->limit, head, rb->tail_cached);
+
+    // The shared tail is only read when the cached copy does not leave enough room
+    if (free_elements < n)
+    {
+        size_t tail = atomic_load_explicit(&ctrl->tail, memory_order_acquire);
+        if (false == _positions_valid(rb, head, tail))
+        {
+            return RING_BUFFER_STATUS_ERROR;
+        }
+
+        rb->tail_cached = tail;
+        free_elements = rb->max_elements - RING_BUFFER_PosUsed(rb->limit, head, rb->tail_cached);
+    }
+
+    if ((0 == free_elements) && (0 != n))
+    {
+        return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+    }
+
+    if (n > free_elements)
+    {
+        n = free_elements;
+    }
+
+    RING_BUFFER_PosCopyIn(rb->data, rb->max_elements, rb->element_size, head, (const uint8_t *)data, n);
+    atomic_store_explicit(&ctrl->head, RING_BUFFER_PosNext(rb->limit, head, n), memory_order_release);
+
+    *written = n;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_RetrieveMany(ring_buffer_shm_t *rb, void *data, size_t n, size_t *read)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->ctrl, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    ring_buffer_shm_ctrl_t *ctrl = rb->ctrl;
+
+    *read = 0;
+
+    size_t tail = atomic_load_explicit(&ctrl->tail, memory_order_relaxed);
+
+    if (false == _positions_valid(rb, rb->head_cached, tail))
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    size_t count = RING_BUFFER_PosUsed(rb->limit, rb->head_cached, tail);
+
+    // The shared head is only read when the cached copy does not hold enough elements
+    if (count < n)
+    {
+        size_t head = atomic_load_explicit(&ctrl->head, memory_order_acquire);
+        if (false == _positions_valid(rb, head, tail))
+        {
+            return RING_BUFFER_STATUS_ERROR;
+        }
+
+        rb->head_cached = head;
+        count = RING_BUFFER_PosUsed(rb->limit, rb->head_cached, tail);
+    }
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    if (n > count)
+    {
+        n = count;
+    }
+
+    RING_BUFFER_PosCopyOut(rb->data, rb->max_elements, rb->element_size, tail, (uint8_t *)data, n);
+    atomic_store_explicit(&ctrl->tail, RING_BUFFER_PosNext(rb->limit, tail, n), memory_order_release);
+
+    *read = n;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SHM_GetCount(ring_buffer_shm_t *rb, size_t *result)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->ctrl, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t tail = atomic_load_explicit(&rb->ctrl->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&rb->ctrl->head, memory_order_acquire);
+
+    if (false == _positions_valid(rb, head, tail))
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    *result = RING_BUFFER_PosUsed(rb->limit, head, tail);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Maps an existing shared region and checks its control block.
+ * @param   rb Handle to fill.
+ * @param   fd Descriptor of the region (owned by the handle on success).
+ * @return  RING_BUFFER_STATUS_OK, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED or RING_BUFFER_STATUS_ERROR.
+ */
+static ring_buffer_status_e _map(ring_buffer_shm_t *rb, int fd)
+{
+    struct stat st;
+
+    if ((0 != fstat(fd, &st)) || ((size_t)st.st_size < sizeof(ring_buffer_shm_ctrl_t)))
+    {
+        // Creator may not have sized the region yet
+        return RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED;
+    }
+
+    void *region = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == region)
+    {
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    ring_buffer_shm_ctrl_t *ctrl = (ring_buffer_shm_ctrl_t *)region;
+
+    if (RING_BUFFER_SHM_MAGIC != atomic_load_explicit(&ctrl->magic, memory_order_acquire))
+    {
+        munmap(region, (size_t)st.st_size);
+        return RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED;
+    }
+
+    // Never trust a layout that does not fit into what was mapped
+    if (false == _layout_valid(ctrl, (size_t)st.st_size))
+    {
+        munmap(region, (size_t)st.st_size);
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+    RING_BUFFER_CopySelect();
+#endif /* (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO) */
+
+    // The checked values are kept in the handle, the block is not read for them again
+    ring_buffer_shm_t handle = {
+        .ctrl = ctrl,
+        .data = (uint8_t *)region + ctrl->data_offset,
+        .fd = fd,
+        .element_size = ctrl->element_size,
+        .max_elements = ctrl->max_elements,
+        .limit = ctrl->limit,
+        .region_size = (size_t)st.st_size,
+        .head_cached = atomic_load_explicit(&ctrl->head, memory_order_acquire),
+        .tail_cached = atomic_load_explicit(&ctrl->tail, memory_order_acquire),
+    };
+
+    if (false == _positions_valid(&handle, handle.head_cached, handle.tail_cached))
+    {
+        munmap(region, (size_t)st.st_size);
+        return RING_BUFFER_STATUS_ERROR;
+    }
+
+    *rb = handle;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   Checks that a control block written by another process describes a layout inside the mapped region.
+ * @param   ctrl Control block at the start of the mapping.
+ * @param   mapped Size of the mapping in bytes.
+ * @return  True when the positions and the element storage stay inside the mapping.
+ */
+static bool _layout_valid(const ring_buffer_shm_ctrl_t *ctrl, size_t mapped)
+{
+    if ((RING_BUFFER_SHM_VERSION != ctrl->version) || (ctrl->region_size != mapped))
+    {
+        return false;
+    }
+
+    if ((0 == ctrl->element_size) || (0 == ctrl->max_elements) || (ctrl->max_elements > SIZE_MAX / 2) ||
+        (ctrl->limit != 2 * ctrl->max_elements))
+    {
+        return false;
+    }
+
+    if ((ctrl->data_offset < sizeof(ring_buffer_shm_ctrl_t)) || (ctrl->data_offset > mapped))
+    {
+        return false;
+    }
+
+    // Division keeps element_size * max_elements from wrapping around
+    return ctrl->element_size <= (mapped - ctrl->data_offset) / ctrl->max_elements;
+}
+
+/**
+ * @brief   Checks a pair of positions read from the shared control block against the cached geometry.
+ * @param   rb Handle holding the geometry validated at attach time.
+ * @param   head Head position.
+ * @param   tail Tail position.
+ * @return  True when both positions are below the wrap limit and hold at most max_elements elements.
+ */
+static bool _positions_valid(const ring_buffer_shm_t *rb, size_t head, size_t tail)
+{
+    return (head < rb->limit) && (tail < rb->limit) && (RING_BUFFER_PosUsed(rb->limit, head, tail) <= rb->max_elements);
+}
+
+#endif /* defined(__linux__) */
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
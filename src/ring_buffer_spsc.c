@@ -0,0 +1,196 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_spsc.c
+ * @brief       The component RING-BUFFER lock-free single-producer / single-consumer variant.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-19
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer_spsc.h"
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_SPSC_Init(ring_buffer_spsc_t *rb, ring_buffer_conf_t conf)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(conf.buffer, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.buffer_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_SIZE(conf.element_size, 0, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+
+    // Evicting the oldest element would make the producer move the tail, which only the consumer owns
+    if ((conf.buffer_size < conf.element_size) || conf.overwrite)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+#if (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO)
+    RING_BUFFER_CopySelect();
+#endif /* (RING_BUFFER_CONF_COPY_KERNEL == RING_BUFFER_COPY_KERNEL_AUTO) */
+
+    rb->conf = conf;
+    rb->max_elements = conf.buffer_size / conf.element_size;
+    rb->limit = 2 * rb->max_elements;
+    rb->producer.cached = 0;
+    rb->consumer.cached = 0;
+    atomic_init(&rb->producer.index, 0);
+    atomic_init(&rb->consumer.index, 0);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SPSC_DeInit(ring_buffer_spsc_t *rb)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    MEMSET(&rb->conf, 0, sizeof(ring_buffer_conf_t));
+    rb->max_elements = 0;
+    rb->limit = 0;
+    atomic_store_explicit(&rb->producer.index, 0, memory_order_relaxed);
+    atomic_store_explicit(&rb->consumer.index, 0, memory_order_relaxed);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SPSC_Insert(ring_buffer_spsc_t *rb, const void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t head = atomic_load_explicit(&rb->producer.index, memory_order_relaxed);
+
+    // The shared tail is only read when the cached copy says the buffer is full
+    if (RING_BUFFER_PosUsed(rb->limit, head, rb->producer.cached) >= rb->max_elements)
+    {
+        rb->producer.cached = atomic_load_explicit(&rb->consumer.index, memory_order_acquire);
+        if (RING_BUFFER_PosUsed(rb->limit, head, rb->producer.cached) >= rb->max_elements)
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+        }
+    }
+
+    RING_BUFFER_PosCopyIn(rb->conf.buffer, rb->max_elements, rb->conf.element_size, head, (const uint8_t *)data, 1);
+    atomic_store_explicit(&rb->producer.index, RING_BUFFER_PosNext(rb->limit, head, 1), memory_order_release);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SPSC_Retrieve(ring_buffer_spsc_t *rb, void *data)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t tail = atomic_load_explicit(&rb->consumer.index, memory_order_relaxed);
+
+    // The shared head is only read when the cached copy says the buffer is empty
+    if (tail == rb->consumer.cached)
+    {
+        rb->consumer.cached = atomic_load_explicit(&rb->producer.index, memory_order_acquire);
+        if (tail == rb->consumer.cached)
+        {
+            return RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY;
+        }
+    }
+
+    RING_BUFFER_PosCopyOut(rb->conf.buffer, rb->max_elements, rb->conf.element_size, tail, (uint8_t *)data, 1);
+    atomic_store_explicit(&rb->consumer.index, RING_BUFFER_PosNext(rb->limit, tail, 1), memory_order_release);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SPSC_InsertMany(ring_buffer_spsc_t *rb, const void *data, size_t n, size_t *written)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(written, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *written = 0;
+
+    size_t head = atomic_load_explicit(&rb->producer.index, memory_order_relaxed);
+    size_t free_elements = rb->max_elements - RING_BUFFER_PosUsed(rb->limit, head, rb->producer.cached);
+
+    if (free_elements < n)
+    {
+        rb->producer.cached = atomic_load_explicit(&rb->consumer.index, memory_order_acquire);
+        free_elements = rb->max_elements - RING_BUFFER_PosUsed(rb->limit, head, rb->producer.cached);
+    }
+
+    if (0 == free_elements && 0 != n)
+    {
+        return RING_BUFFER_STATUS_ERROR_BUFFER_FULL;
+    }
+
+    if (n > free_elements)
+    {
+        n = free_elements;
+    }
+
+    RING_BUFFER_PosCopyIn(rb->conf.buffer, rb->max_elements, rb->conf.element_size, head, (const uint8_t *)data, n);
+    atomic_store_explicit(&rb->producer.index, RING_BUFFER_PosNext(rb->limit, head, n), memory_order_release);
+
+    *written = n;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SPSC_RetrieveMany(ring_buffer_spsc_t *rb, void *data, size_t n, size_t *read)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *read = 0;
+
+    size_t tail = atomic_load_explicit(&rb->consumer.index, memory_order_relaxed);
+    size_t count = RING_BUFFER_PosUsed(rb->limit, rb->consumer.cached, tail);
+
+    if (count < n)
+    {
+        rb->consumer.cached = atomic_load_explicit(&rb->producer.index, memory_order_acquire);
+        count = RING_BUFFER_PosUsed(rb->limit, rb->consumer.cached, tail);
+    }
+
+    CHECK_ARGS_SIZE(count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    if (n > count)
+    {
+        n = count;
+    }
+
+    RING_BUFFER_PosCopyOut(rb->conf.buffer, rb->max_elements, rb->conf.element_size, tail, (uint8_t *)data, n);
+    atomic_store_explicit(&rb->consumer.index, RING_BUFFER_PosNext(rb->limit, tail, n), memory_order_release);
+
+    *read = n;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_SPSC_GetCount(ring_buffer_spsc_t *rb, size_t *result)
+{
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    size_t tail = atomic_load_explicit(&rb->consumer.index, memory_order_acquire);
+    size_t head = atomic_load_explicit(&rb->producer.index, memory_order_acquire);
+
+    *result = RING_BUFFER_PosUsed(rb->limit, head, tail);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
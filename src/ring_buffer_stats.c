@@ -0,0 +1,528 @@
+/***********************************************************************************************************************
+ *
+ * @file        ring_buffer_stats.c
+ * @brief       The component RING-BUFFER sliding-window statistics companion (sum, mean, variance, min and max).
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-27
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_gtypes.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_stats.h"
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Context of the re-summation passes.
+ */
+typedef struct
+{
+    ring_buffer_stats_t *stats;       /// Companion providing the element type (its deques are refilled).
+    double mean;                      /// Mean of the first pass (input of the second pass).
+    double sum;                       /// Sum of the pass.
+} _pass_t;
+
+// --- Private Functions Prototypes ------------------------------------------------------------------------------------
+
+static size_t _type_size(ring_buffer_stats_type_e type);
+static double _value(const ring_buffer_stats_t *stats, const void *data);
+static void _add(ring_buffer_stats_t *stats, double x);
+static void _remove(ring_buffer_stats_t *stats, double x);
+static void _swap(ring_buffer_stats_t *stats, double evicted, double x);
+static void _updated(ring_buffer_stats_t *stats);
+static size_t _deque_index(const ring_buffer_stats_t *stats, const ring_buffer_stats_deque_t *deque, size_t i);
+static void _deque_push(ring_buffer_stats_t *stats, ring_buffer_stats_deque_t *deque, double x, bool min);
+static void _deque_expire(ring_buffer_stats_t *stats, ring_buffer_stats_deque_t *deque);
+static void _window_insert(ring_buffer_stats_t *stats, double x);
+static void _window_remove(ring_buffer_stats_t *stats);
+static ring_buffer_status_e _window_front(const ring_buffer_stats_deque_t *deque, double *result);
+static bool _sum_pass(void *elements, size_t n, void *ctx);
+static bool _m2_pass(void *elements, size_t n, void *ctx);
+
+// --- Public Functions Definitions ------------------------------------------------------------------------------------
+
+ring_buffer_status_e RING_BUFFER_STATS_Init(ring_buffer_stats_t *stats, ring_buffer_t *rb,
+                                            ring_buffer_stats_conf_t conf)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(rb->conf.buffer, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    if (conf.type >= RING_BUFFER_STATS_TYPE_MAX)
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    // Elements are walked in place by the re-summation, so none may be split at the wrap point
+    if ((_type_size(conf.type) != rb->conf.element_size) || rb->conf.records ||
+        ((false == rb->conf.mirrored) && (0 != (rb->conf.buffer_size % rb->conf.element_size))))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    // Each deque holds at most one candidate per stored element
+    if ((NULL != conf.window) && (conf.window_size < RING_BUFFER_STATS_WINDOW_SIZE(rb->max_elements)))
+    {
+        return RING_BUFFER_STATUS_ERROR_INPUT_ARGS;
+    }
+
+    MEMSET(stats, 0, sizeof(ring_buffer_stats_t));
+
+    stats->conf = conf;
+    stats->rb = rb;
+
+    if (NULL != conf.window)
+    {
+        stats->min.entries = (ring_buffer_stats_entry_t *)conf.window;
+        stats->max.entries = stats->min.entries + rb->max_elements;
+    }
+
+    if (0 == stats->conf.resum)
+    {
+        stats->conf.resum = rb->max_elements;
+    }
+
+    return RING_BUFFER_STATS_Resync(stats);
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_Insert(ring_buffer_stats_t *stats, const void *data)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    ring_buffer_t *rb = stats->rb;
+    uint8_t evicted[sizeof(double)];
+
+    // The oldest element leaves the window when the insert overwrites it
+    bool evict = rb->conf.overwrite && (RING_BUFFER_STATUS_OK == RING_BUFFER_IsFull(rb)) &&
+                 (RING_BUFFER_STATUS_OK == RING_BUFFER_Peek(rb, 0, evicted));
+
+    ring_buffer_status_e status = RING_BUFFER_Insert(rb, data);
+    if (RING_BUFFER_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    double x = _value(stats, data);
+
+    if (evict)
+    {
+        _swap(stats, _value(stats, evicted), x);
+        _window_remove(stats);
+    }
+    else
+    {
+        _add(stats, x);
+    }
+
+    _window_insert(stats, x);
+    _updated(stats);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_Retrieve(ring_buffer_stats_t *stats, void *data)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    ring_buffer_status_e status = RING_BUFFER_Retrieve(stats->rb, data);
+    if (RING_BUFFER_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    _remove(stats, _value(stats, data));
+    _window_remove(stats);
+    _updated(stats);
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_Resync(ring_buffer_stats_t *stats)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    _pass_t pass = {.stats = stats, .mean = 0.0, .sum = 0.0};
+    size_t free_elements;
+
+    RING_BUFFER_GetFreeElements(stats->rb, &free_elements);
+
+    stats->count = stats->rb->max_elements - free_elements;
+    stats->sum = 0.0;
+    stats->mean = 0.0;
+    stats->m2 = 0.0;
+    stats->updates = 0;
+    stats->seq_head = 0;
+    stats->seq_tail = 0;
+    stats->min.first = 0;
+    stats->min.size = 0;
+    stats->max.first = 0;
+    stats->max.size = 0;
+
+    // Two passes, the squared differences are taken from the exact mean instead of being accumulated (the first pass
+    // also refills the min / max deques)
+    if (RING_BUFFER_STATUS_OK == RING_BUFFER_ForEachSegment(stats->rb, _sum_pass, &pass))
+    {
+        stats->sum = pass.sum;
+        stats->mean = pass.sum / (double)stats->count;
+
+        pass.mean = stats->mean;
+        pass.sum = 0.0;
+        RING_BUFFER_ForEachSegment(stats->rb, _m2_pass, &pass);
+        stats->m2 = pass.sum;
+    }
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_GetSum(ring_buffer_stats_t *stats, double *result)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    *result = stats->sum;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_GetMean(ring_buffer_stats_t *stats, double *result)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    CHECK_ARGS_SIZE(stats->count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    *result = stats->mean;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_GetVariance(ring_buffer_stats_t *stats, double *result)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    CHECK_ARGS_SIZE(stats->count, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    *result = stats->m2 / (double)stats->count;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_WindowMin(ring_buffer_stats_t *stats, double *result)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    return _window_front(&stats->min, result);
+}
+
+ring_buffer_status_e RING_BUFFER_STATS_WindowMax(ring_buffer_stats_t *stats, double *result)
+{
+    CHECK_ARGS_NULL_PTR(stats, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(result, RING_BUFFER_STATUS_ERROR_INPUT_ARGS);
+    CHECK_ARGS_NULL_PTR(stats->rb, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+
+    return _window_front(&stats->max, result);
+}
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Gets the size of an element type.
+ * @param   type Element type.
+ * @return  Size in bytes.
+ */
+static size_t _type_size(ring_buffer_stats_type_e type)
+{
+    switch (type)
+    {
+        case RING_BUFFER_STATS_TYPE_INT16:
+            return sizeof(int16_t);
+        case RING_BUFFER_STATS_TYPE_INT32:
+            return sizeof(int32_t);
+        case RING_BUFFER_STATS_TYPE_FLOAT:
+            return sizeof(float);
+        default:
+            return sizeof(double);
+    }
+}
+
+/**
+ * @brief   Reads an element as a double (the element may be unaligned in the buffer).
+ * @param   stats Companion providing the element type.
+ * @param   data Element.
+ * @return  Element value.
+ */
+static double _value(const ring_buffer_stats_t *stats, const void *data)
+{
+    int16_t i16;
+    int32_t i32;
+    float f;
+    double d;
+
+    switch (stats->conf.type)
+    {
+        case RING_BUFFER_STATS_TYPE_INT16:
+            MEMCPY(&i16, data, sizeof(i16));
+            return (double)i16;
+        case RING_BUFFER_STATS_TYPE_INT32:
+            MEMCPY(&i32, data, sizeof(i32));
+            return (double)i32;
+        case RING_BUFFER_STATS_TYPE_FLOAT:
+            MEMCPY(&f, data, sizeof(f));
+            return (double)f;
+        default:
+            MEMCPY(&d, data, sizeof(d));
+            return d;
+    }
+}
+
+/**
+ * @brief   Adds an element to the window (Welford update).
+ * @param   stats Companion to update.
+ * @param   x Element value.
+ */
+static void _add(ring_buffer_stats_t *stats, double x)
+{
+    stats->count++;
+    stats->sum += x;
+
+    double delta = x - stats->mean;
+    stats->mean += delta / (double)stats->count;
+    stats->m2 += delta * (x - stats->mean);
+}
+
+/**
+ * @brief   Removes the oldest element from the window (inverse Welford update).
+ * @param   stats Companion to update.
+ * @param   x Element value.
+ */
+static void _remove(ring_buffer_stats_t *stats, double x)
+{
+    if (stats->count <= 1)
+    {
+        stats->count = 0;
+        stats->sum = 0.0;
+        stats->mean = 0.0;
+        stats->m2 = 0.0;
+        return;
+    }
+
+    stats->count--;
+    stats->sum -= x;
+
+    double delta = x - stats->mean;
+    stats->mean -= delta / (double)stats->count;
+    stats->m2 -= delta * (x - stats->mean);
+
+    // Cancellation may leave a tiny negative rest
+    if (stats->m2 < 0.0)
+    {
+        stats->m2 = 0.0;
+    }
+}
+
+/**
+ * @brief   Replaces the evicted element with the inserted one in a full window (count does not change).
+ * @param   stats Companion to update.
+ * @param   evicted Value of the evicted element.
+ * @param   x Value of the inserted element.
+ */
+static void _swap(ring_buffer_stats_t *stats, double evicted, double x)
+{
+    double delta = x - evicted;
+    double mean = stats->mean;
+
+    stats->sum += delta;
+    stats->mean += delta / (double)stats->count;
+    stats->m2 += delta * ((x - stats->mean) + (evicted - mean));
+
+    if (stats->m2 < 0.0)
+    {
+        stats->m2 = 0.0;
+    }
+}
+
+/**
+ * @brief   Counts an update and re-sums the window once the period is reached.
+ * @param   stats Companion to update.
+ */
+static void _updated(ring_buffer_stats_t *stats)
+{
+    if (++stats->updates >= stats->conf.resum)
+    {
+        RING_BUFFER_STATS_Resync(stats);
+    }
+}
+
+/**
+ * @brief   Converts a deque position to an index into its circular storage.
+ * @param   stats Companion providing the capacity (max_elements).
+ * @param   deque Deque the position belongs to.
+ * @param   i Position from the front.
+ * @return  Storage index.
+ */
+static size_t _deque_index(const ring_buffer_stats_t *stats, const ring_buffer_stats_deque_t *deque, size_t i)
+{
+    size_t index = deque->first + i;
+
+    if (index >= stats->rb->max_elements)
+    {
+        index -= stats->rb->max_elements;
+    }
+
+    return index;
+}
+
+/**
+ * @brief   Appends the newest element to a deque after dropping the candidates it dominates.
+ * @param   stats Companion owning the deque.
+ * @param   deque Deque to update.
+ * @param   x Value of the newest element.
+ * @param   min True for the min deque, false for the max deque.
+ */
+static void _deque_push(ring_buffer_stats_t *stats, ring_buffer_stats_deque_t *deque, double x, bool min)
+{
+    // A candidate that is not better than a newer element can never be the extreme again
+    while (0 != deque->size)
+    {
+        double back = deque->entries[_deque_index(stats, deque, deque->size - 1)].value;
+
+        if (min ? (back < x) : (back > x))
+        {
+            break;
+        }
+
+        deque->size--;
+    }
+
+    ring_buffer_stats_entry_t *entry = &deque->entries[_deque_index(stats, deque, deque->size)];
+    entry->value = x;
+    entry->seq = stats->seq_head;
+    deque->size++;
+}
+
+/**
+ * @brief   Drops the front candidate of a deque once it left the window.
+ * @param   stats Companion owning the deque.
+ * @param   deque Deque to update.
+ */
+static void _deque_expire(ring_buffer_stats_t *stats, ring_buffer_stats_deque_t *deque)
+{
+    if ((0 != deque->size) && (deque->entries[deque->first].seq < stats->seq_tail))
+    {
+        deque->first = _deque_index(stats, deque, 1);
+        deque->size--;
+    }
+}
+
+/**
+ * @brief   Adds the newest element to the min / max deques (nothing when they are not configured).
+ * @param   stats Companion to update.
+ * @param   x Value of the newest element.
+ */
+static void _window_insert(ring_buffer_stats_t *stats, double x)
+{
+    if (NULL != stats->min.entries)
+    {
+        _deque_push(stats, &stats->min, x, true);
+        _deque_push(stats, &stats->max, x, false);
+    }
+
+    stats->seq_head++;
+}
+
+/**
+ * @brief   Removes the oldest element from the min / max deques (nothing when they are not configured).
+ * @param   stats Companion to update.
+ */
+static void _window_remove(ring_buffer_stats_t *stats)
+{
+    stats->seq_tail++;
+
+    if (NULL != stats->min.entries)
+    {
+        _deque_expire(stats, &stats->min);
+        _deque_expire(stats, &stats->max);
+    }
+}
+
+/**
+ * @brief   Reads the extreme of the window from the front of a deque.
+ * @param   deque Min or max deque.
+ * @param   result Extreme value.
+ * @return  RING_BUFFER_STATUS_OK, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED or RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY.
+ */
+static ring_buffer_status_e _window_front(const ring_buffer_stats_deque_t *deque, double *result)
+{
+    CHECK_ARGS_NULL_PTR(deque->entries, RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED);
+    CHECK_ARGS_SIZE(deque->size, 0, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY);
+
+    *result = deque->entries[deque->first].value;
+
+    return RING_BUFFER_STATUS_OK;
+}
+
+/**
+ * @brief   First re-summation pass, sums a run of elements.
+ * @param   elements Run of elements.
+ * @param   n Number of elements.
+ * @param   ctx Pass context.
+ * @return  True to continue with the next run.
+ */
+static bool _sum_pass(void *elements, size_t n, void *ctx)
+{
+    _pass_t *pass = (_pass_t *)ctx;
+    const uint8_t *element = (const uint8_t *)elements;
+    size_t element_size = pass->stats->rb->conf.element_size;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        double x = _value(pass->stats, element + i * element_size);
+
+        pass->sum += x;
+        _window_insert(pass->stats, x);
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Second re-summation pass, sums the squared differences of a run of elements from the mean.
+ * @param   elements Run of elements.
+ * @param   n Number of elements.
+ * @param   ctx Pass context.
+ * @return  True to continue with the next run.
+ */
+static bool _m2_pass(void *elements, size_t n, void *ctx)
+{
+    _pass_t *pass = (_pass_t *)ctx;
+    const uint8_t *element = (const uint8_t *)elements;
+    size_t element_size = pass->stats->rb->conf.element_size;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        double delta = _value(pass->stats, element + i * element_size) - pass->mean;
+        pass->sum += delta * delta;
+    }
+
+    return true;
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -18,10 +18,13 @@ extern "C" {
 
 // --- Data Logger Configurations --------------------------------------------------------------------------------------
 
-#define RING_BUFFER_CONF_FREERTOS_USE false           /// Set to true to enable thread-safety mechanisms.
+#define RING_BUFFER_CONF_FREERTOS_USE false           /// Set to true to enable the FreeRTOS mutex lock backend.
+#define RING_BUFFER_CONF_PTHREAD_USE  true            /// Set to true to enable the POSIX threads mutex lock backend.
 #define RING_BUFFER_CONF_TRACE_USE    true            /// Set to true to enable logging of buffer actions using TRACE.
 #define RING_BUFFER_CONF_TRACE_LEVEL  TRACE_LEVEL_VER /// Configure trace level (if tracing is used).
 
+#define RING_BUFFER_CONF_COPY_KERNEL RING_BUFFER_COPY_KERNEL_WORD /// Copy kernel used to move element data.
+
 // C++ wrapper - End
 #ifdef __cplusplus
 }
@@ -10,9 +10,21 @@
 
 // --- Includes --------------------------------------------------------------------------------------------------------
 
+// Test helpers use POSIX / GNU interfaces (clock_gettime, nanosleep, pread, O_CLOEXEC)
+#define _GNU_SOURCE
+
 #include "ring_buffer/ring_buffer.h"
 #include "ring_buffer/ring_buffer_gtypes.h"
 #include "ring_buffer/ring_buffer_ptypes.h"
+#include "ring_buffer/ring_buffer_mpmc.h"
+#include "ring_buffer/ring_buffer_mpsc.h"
+#include "ring_buffer/ring_buffer_lock.h"
+#include "ring_buffer/ring_buffer_aio.h"
+#include "ring_buffer/ring_buffer_stats.h"
+#include "ring_buffer/ring_buffer_file.h"
+#include "ring_buffer/ring_buffer_shm.h"
+#include "ring_buffer/ring_buffer_spsc.h"
+#include "ring_buffer/ring_buffer_typed.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -20,6 +32,33 @@
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/wait.h>
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Typed ring buffers checked against the same cases as the generic API.
+ */
+RING_BUFFER_DEFINE(typed_u8x1, uint8_t, 1)
+RING_BUFFER_DEFINE(typed_u8x10, uint8_t, 10)
+RING_BUFFER_DEFINE(typed_u16x3, uint16_t, 3)
+RING_BUFFER_DEFINE(typed_u16x4, uint16_t, 4)
+
+/**
+ * @brief   Lock hook context counting how the ring buffer takes and releases a lock.
+ */
+typedef struct
+{
+    int32_t held;     /// Currently held (0 or 1 when used correctly).
+    int32_t max_held; /// Highest value of held (1 unless taken twice).
+    int32_t taken;    /// Number of times the lock was taken.
+} lock_counter_t;
 
 // --- Private Defines -------------------------------------------------------------------------------------------------
 
@@ -41,6 +80,131 @@
     ADD(ring_buffer_insert_valid)                                                                                      \
     ADD(ring_buffer_retrieve_null_handle)                                                                              \
     ADD(ring_buffer_retrieve_valid)                                                                                    \
+    ADD(ring_buffer_insert_many_null_handle)                                                                           \
+    ADD(ring_buffer_insert_many_full_buffer)                                                                           \
+    ADD(ring_buffer_insert_many_wrap)                                                                                  \
+    ADD(ring_buffer_insert_many_overwrite)                                                                             \
+    ADD(ring_buffer_retrieve_many_null_handle)                                                                         \
+    ADD(ring_buffer_retrieve_many_wrap)                                                                                \
+    ADD(ring_buffer_power_of_two_init_invalid)                                                                         \
+    ADD(ring_buffer_power_of_two_init_valid)                                                                           \
+    ADD(ring_buffer_power_of_two_insert_retrieve)                                                                      \
+    ADD(ring_buffer_power_of_two_overwrite)                                                                            \
+    ADD(ring_buffer_power_of_two_many_wrap)                                                                            \
+    ADD(ring_buffer_reserve_write_null_handle)                                                                         \
+    ADD(ring_buffer_reserve_write_full_buffer)                                                                         \
+    ADD(ring_buffer_reserve_write_wrap)                                                                                \
+    ADD(ring_buffer_reserve_write_overwrite)                                                                           \
+    ADD(ring_buffer_peek_spans_null_handle)                                                                            \
+    ADD(ring_buffer_peek_spans_wrap)                                                                                   \
+    ADD(ring_buffer_spsc_init_invalid)                                                                                 \
+    ADD(ring_buffer_spsc_insert_full_buffer)                                                                           \
+    ADD(ring_buffer_spsc_insert_retrieve)                                                                              \
+    ADD(ring_buffer_spsc_many_wrap)                                                                                    \
+    ADD(ring_buffer_mpmc_init_invalid)                                                                                 \
+    ADD(ring_buffer_mpmc_insert_full_buffer)                                                                           \
+    ADD(ring_buffer_mpmc_insert_retrieve)                                                                              \
+    ADD(ring_buffer_mpsc_init_invalid)                                                                                 \
+    ADD(ring_buffer_mpsc_insert_full_buffer)                                                                           \
+    ADD(ring_buffer_mpsc_retrieve_many)                                                                                \
+    ADD(ring_buffer_mpsc_retrieve_stops_at_unpublished)                                                                \
+    ADD(ring_buffer_lock_invalid_hook)                                                                                 \
+    ADD(ring_buffer_lock_split_sides)                                                                                  \
+    ADD(ring_buffer_lock_overwrite_evicts)                                                                             \
+    ADD(ring_buffer_lock_commit_write_error_unlocks)                                                                   \
+    ADD(ring_buffer_lock_commit_write_without_reservation)                                                             \
+    ADD(ring_buffer_lock_consume_error_unlocks)                                                                        \
+    ADD(ring_buffer_lock_consume_without_peek)                                                                         \
+    ADD(ring_buffer_lock_pthread_transfer)                                                                             \
+    ADD(ring_buffer_wait_timeout)                                                                                      \
+    ADD(ring_buffer_wait_forever_without_hooks)                                                                        \
+    ADD(ring_buffer_wait_woken_by_insert)                                                                              \
+    ADD(ring_buffer_wait_strategies)                                                                                   \
+    ADD(ring_buffer_notify_edges)                                                                                      \
+    ADD(ring_buffer_notify_epoll)                                                                                      \
+    ADD(ring_buffer_mirrored_alloc)                                                                                    \
+    ADD(ring_buffer_mirrored_alloc_limit)                                                                              \
+    ADD(ring_buffer_mirrored_flag_by_hand)                                                                             \
+    ADD(ring_buffer_mirrored_wrap)                                                                                     \
+    ADD(ring_buffer_mirrored_full_empty)                                                                               \
+    ADD(ring_buffer_records_lengths)                                                                                   \
+    ADD(ring_buffer_records_retrieve_overflow)                                                                         \
+    ADD(ring_buffer_records_wrap)                                                                                      \
+    ADD(ring_buffer_records_full)                                                                                      \
+    ADD(ring_buffer_records_overwrite)                                                                                 \
+    ADD(ring_buffer_records_element_mode)                                                                              \
+    ADD(ring_buffer_records_reject_element_functions)                                                                  \
+    ADD(ring_buffer_shm_create_invalid)                                                                                \
+    ADD(ring_buffer_shm_create_existing)                                                                               \
+    ADD(ring_buffer_shm_full_empty_wrap)                                                                               \
+    ADD(ring_buffer_shm_processes)                                                                                     \
+    ADD(ring_buffer_shm_attach_fd)                                                                                     \
+    ADD(ring_buffer_shm_attach_corrupt_layout)                                                                         \
+    ADD(ring_buffer_shm_corrupt_positions)                                                                             \
+    ADD(ring_buffer_file_open_invalid)                                                                                 \
+    ADD(ring_buffer_file_full_empty_wrap)                                                                              \
+    ADD(ring_buffer_file_recovery_header)                                                                              \
+    ADD(ring_buffer_file_recovery_torn_header)                                                                         \
+    ADD(ring_buffer_file_recovery_scan)                                                                                \
+    ADD(ring_buffer_file_open_other_geometry)                                                                          \
+    ADD(ring_buffer_file_retrieve_corrupt_slot)                                                                        \
+    ADD(ring_buffer_file_corrupt_slot_scan)                                                                            \
+    ADD(ring_buffer_file_sync_periodic)                                                                                \
+    ADD(ring_buffer_fd_drain_wrap)                                                                                     \
+    ADD(ring_buffer_fd_fill_wrap)                                                                                      \
+    ADD(ring_buffer_fd_fill_partial_element)                                                                           \
+    ADD(ring_buffer_fd_drain_partial_element)                                                                          \
+    ADD(ring_buffer_fd_drain_error_keeps_element)                                                                      \
+    ADD(ring_buffer_fd_drain_partial_retrieve)                                                                         \
+    ADD(ring_buffer_fd_drain_partial_evict)                                                                            \
+    ADD(ring_buffer_fd_fill_partial_insert)                                                                            \
+    ADD(ring_buffer_aio_drain_io_uring)                                                                                \
+    ADD(ring_buffer_aio_drain_threads)                                                                                 \
+    ADD(ring_buffer_aio_drain_empty)                                                                                   \
+    ADD(ring_buffer_aio_init_invalid)                                                                                  \
+    ADD(ring_buffer_aio_write_error)                                                                                   \
+    ADD(ring_buffer_discard_empty)                                                                                     \
+    ADD(ring_buffer_discard_oldest_wrap)                                                                               \
+    ADD(ring_buffer_discard_newest_wrap)                                                                               \
+    ADD(ring_buffer_discard_more_than_stored)                                                                          \
+    ADD(ring_buffer_discard_power_of_two)                                                                              \
+    ADD(ring_buffer_discard_clear)                                                                                     \
+    ADD(ring_buffer_discard_record_mode)                                                                               \
+    ADD(ring_buffer_discard_partial_drain)                                                                             \
+    ADD(ring_buffer_discard_newest_partial_fill)                                                                       \
+    ADD(ring_buffer_peek_range_empty)                                                                                  \
+    ADD(ring_buffer_peek_range_wrap)                                                                                   \
+    ADD(ring_buffer_peek_range_invalid_index)                                                                          \
+    ADD(ring_buffer_replace_range_wrap)                                                                                \
+    ADD(ring_buffer_replace_range_invalid_index)                                                                       \
+    ADD(ring_buffer_peek_range_record_mode)                                                                            \
+    ADD(ring_buffer_foreach_empty)                                                                                     \
+    ADD(ring_buffer_foreach_wrap)                                                                                      \
+    ADD(ring_buffer_foreach_map_in_place)                                                                              \
+    ADD(ring_buffer_foreach_stop)                                                                                      \
+    ADD(ring_buffer_foreach_segment_wrap)                                                                              \
+    ADD(ring_buffer_foreach_split_elements)                                                                            \
+    ADD(ring_buffer_stats_init_invalid)                                                                                \
+    ADD(ring_buffer_stats_empty)                                                                                       \
+    ADD(ring_buffer_stats_sliding)                                                                                     \
+    ADD(ring_buffer_stats_retrieve)                                                                                    \
+    ADD(ring_buffer_stats_full)                                                                                        \
+    ADD(ring_buffer_stats_resync)                                                                                      \
+    ADD(ring_buffer_stats_init_stored)                                                                                 \
+    ADD(ring_buffer_stats_types)                                                                                       \
+    ADD(ring_buffer_stats_window_not_configured)                                                                       \
+    ADD(ring_buffer_stats_window_storage_too_small)                                                                    \
+    ADD(ring_buffer_stats_window_empty)                                                                                \
+    ADD(ring_buffer_stats_window_sliding)                                                                              \
+    ADD(ring_buffer_stats_window_retrieve)                                                                             \
+    ADD(ring_buffer_stats_window_resync)                                                                               \
+    ADD(ring_buffer_typed_null_handle)                                                                                 \
+    ADD(ring_buffer_typed_insert_full_buffer)                                                                          \
+    ADD(ring_buffer_typed_insert_overwrite)                                                                            \
+    ADD(ring_buffer_typed_retrieve_valid)                                                                              \
+    ADD(ring_buffer_typed_peek_valid)                                                                                  \
+    ADD(ring_buffer_typed_replace_valid)                                                                               \
+    ADD(ring_buffer_typed_matches_generic)                                                                             \
     ADD(ring_buffer_peek_null_handle)                                                                                  \
     ADD(ring_buffer_peek_valid)                                                                                        \
     ADD(ring_buffer_replace_null_handle)                                                                               \
@@ -1325,4 +1489,6504 @@ static int32_t test_ring_buffer_get_element_size_valid(void)
     return failed_assertions;
 }
 
+static int32_t test_ring_buffer_insert_many_null_handle(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint8_t data[4] = {1, 2, 3, 4};
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    result = RING_BUFFER_InsertMany(NULL, data, sizeof(data), &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_InsertMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", NULL, data, sizeof(data),
+                  &written, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_InsertMany(&rb, NULL, sizeof(data), &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_InsertMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", &rb, NULL, sizeof(data),
+                  &written, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_InsertMany(&rb, data, sizeof(data), NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_InsertMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", &rb, data, sizeof(data), NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_insert_many_full_buffer(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    uint8_t data[6] = {1, 2, 3, 4, 5, 6};
+    uint8_t read_data;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Only the elements that fit are inserted
+    result = RING_BUFFER_InsertMany(&rb, data, sizeof(data), &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, %p, %zu, %p) -> Expected %d, but got %d.",
+                  &rb, data, sizeof(data), &written, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, written, "Expected %d, but got %zu.", 4, written);
+    ASSERT_EQ_MSG(4, rb.count, "Expected %d, but got %zu.", 4, rb.count);
+
+    result = RING_BUFFER_InsertMany(&rb, data, sizeof(data), &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_InsertMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", &rb, data, sizeof(data),
+                  &written, RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    ASSERT_EQ_MSG(0, written, "Expected %d, but got %zu.", 0, written);
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        result = RING_BUFFER_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(data[i], read_data, "Expected %d, but got %d.", data[i], read_data);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_insert_many_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t), .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Move head and tail close to the end, so the batch is split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &written);
+    result = RING_BUFFER_Retrieve(&rb, &read_data);
+    result = RING_BUFFER_Retrieve(&rb, &read_data);
+
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, %p, %d, %p) -> Expected %d, but got %d.",
+                  &rb, data, 3, &written, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, written, "Expected %d, but got %zu.", 3, written);
+    ASSERT_EQ_MSG(3, rb.count, "Expected %d, but got %zu.", 3, rb.count);
+    ASSERT_EQ_MSG(3, rb.head, "Expected %d, but got %zu.", 3, rb.head);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        result = RING_BUFFER_Peek(&rb, i, &read_data);
+        ASSERT_EQ_MSG(data[i], read_data, "Expected %d, but got %d.", data[i], read_data);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_insert_many_overwrite(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    uint8_t data[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    uint8_t read_data;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_t rb_ref;
+    uint8_t buffer_ref[4];
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = true};
+    ring_buffer_conf_t conf_ref = {
+        .buffer = buffer_ref, .buffer_size = sizeof(buffer_ref), .element_size = 1, .overwrite = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    result = RING_BUFFER_Init(&rb_ref, conf_ref);
+
+    // Batch insert must leave the buffer as the same number of single inserts would
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    result = RING_BUFFER_InsertMany(&rb, &data[3], 7, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, %p, %d, %p) -> Expected %d, but got %d.",
+                  &rb, &data[3], 7, &written, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(7, written, "Expected %d, but got %zu.", 7, written);
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        result = RING_BUFFER_Insert(&rb_ref, &data[i]);
+    }
+
+    ASSERT_EQ_MSG(rb_ref.count, rb.count, "Expected %zu, but got %zu.", rb_ref.count, rb.count);
+    ASSERT_EQ_MSG(rb_ref.head, rb.head, "Expected %zu, but got %zu.", rb_ref.head, rb.head);
+    ASSERT_EQ_MSG(rb_ref.tail, rb.tail, "Expected %zu, but got %zu.", rb_ref.tail, rb.tail);
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        result = RING_BUFFER_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(data[6 + i], read_data, "Expected %d, but got %d.", data[6 + i], read_data);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_retrieve_many_null_handle(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint8_t data[4];
+    size_t read = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    result = RING_BUFFER_RetrieveMany(NULL, data, sizeof(data), &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_RetrieveMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", NULL, data, sizeof(data),
+                  &read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_RetrieveMany(&rb, NULL, sizeof(data), &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_RetrieveMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", &rb, NULL, sizeof(data),
+                  &read, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_RetrieveMany(&rb, data, sizeof(data), NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_RetrieveMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", &rb, data, sizeof(data),
+                  NULL, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_RetrieveMany(&rb, data, sizeof(data), &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_RetrieveMany(%p, %p, %zu, %p) -> Expected %d, but got %d.", &rb, data, sizeof(data),
+                  &read, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    ASSERT_EQ_MSG(0, read, "Expected %d, but got %zu.", 0, read);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_retrieve_many_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[4] = {0};
+    size_t written = 0;
+    size_t read = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t), .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Move head and tail close to the end, so the stored elements are split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &written);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 2, &read);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, %p, %d, %p) -> Expected %d, but got %d.",
+                  &rb, read_data, 4, &read, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, read, "Expected %d, but got %zu.", 3, read);
+    ASSERT_EQ_MSG(0, rb.count, "Expected %d, but got %zu.", 0, rb.count);
+    ASSERT_EQ_MSG(rb.head, rb.tail, "Expected %zu, but got %zu.", rb.head, rb.tail);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        ASSERT_EQ_MSG(data[i], read_data[i], "Expected %d, but got %d.", data[i], read_data[i]);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_power_of_two_init_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[12];
+    ring_buffer_t rb;
+
+    // Three elements is not a power of two
+    ring_buffer_conf_t conf1 = {
+        .buffer = buffer, .buffer_size = 12, .element_size = 4, .overwrite = false, .power_of_two = true};
+    result = RING_BUFFER_Init(&rb, conf1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Init(%p, (%p, %zu, %zu)) -> Expected %d, but got %d.", &rb, conf1.buffer,
+                  conf1.buffer_size, conf1.element_size, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Two elements, but the buffer size is not a multiple of the element size
+    ring_buffer_conf_t conf2 = {
+        .buffer = buffer, .buffer_size = 10, .element_size = 4, .overwrite = false, .power_of_two = true};
+    result = RING_BUFFER_Init(&rb, conf2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Init(%p, (%p, %zu, %zu)) -> Expected %d, but got %d.", &rb, conf2.buffer,
+                  conf2.buffer_size, conf2.element_size, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_power_of_two_init_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[24];
+    ring_buffer_t rb;
+
+    ring_buffer_conf_t conf1 = {
+        .buffer = buffer, .buffer_size = 16, .element_size = 4, .overwrite = false, .power_of_two = true};
+    result = RING_BUFFER_Init(&rb, conf1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, (%p, %zu, %zu)) -> Expected %d, but got %d.",
+                  &rb, conf1.buffer, conf1.buffer_size, conf1.element_size, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, rb.max_elements, "Expected %d, but got %zu.", 4, rb.max_elements);
+    ASSERT_EQ_MSG(3, rb.mask, "Expected %d, but got %zu.", 3, rb.mask);
+    ASSERT_EQ_MSG(true, rb.element_shift_use, "Expected %d, but got %d.", true, rb.element_shift_use);
+    ASSERT_EQ_MSG(2, rb.element_shift, "Expected %d, but got %zu.", 2, rb.element_shift);
+
+    // Element size which is not a power of two falls back to a multiply
+    ring_buffer_conf_t conf2 = {
+        .buffer = buffer, .buffer_size = 24, .element_size = 3, .overwrite = false, .power_of_two = true};
+    result = RING_BUFFER_Init(&rb, conf2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, (%p, %zu, %zu)) -> Expected %d, but got %d.",
+                  &rb, conf2.buffer, conf2.buffer_size, conf2.element_size, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(8, rb.max_elements, "Expected %d, but got %zu.", 8, rb.max_elements);
+    ASSERT_EQ_MSG(7, rb.mask, "Expected %d, but got %zu.", 7, rb.mask);
+    ASSERT_EQ_MSG(false, rb.element_shift_use, "Expected %d, but got %d.", false, rb.element_shift_use);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_power_of_two_insert_retrieve(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4 * 3];
+    uint8_t data[3];
+    uint8_t read_data[3];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3, .overwrite = false, .power_of_two = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Run several laps around the buffer, head and tail keep counting up
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        data[0] = i;
+        data[1] = (uint8_t)(i + 1);
+        data[2] = (uint8_t)(i + 2);
+        result = RING_BUFFER_Insert(&rb, data);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, %p) -> Expected %d, but got %d.", &rb,
+                      data, RING_BUFFER_STATUS_OK, result);
+
+        result = RING_BUFFER_Retrieve(&rb, read_data);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb,
+                      read_data, RING_BUFFER_STATUS_OK, result);
+        ASSERT_EQ_MSG(0, memcmp(data, read_data, sizeof(data)), "Element %d differs after retrieve.", i);
+    }
+
+    ASSERT_EQ_MSG(10, rb.head, "Expected %d, but got %zu.", 10, rb.head);
+    ASSERT_EQ_MSG(10, rb.tail, "Expected %d, but got %zu.", 10, rb.tail);
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        data[0] = i;
+        result = RING_BUFFER_Insert(&rb, data);
+    }
+
+    result = RING_BUFFER_Insert(&rb, data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_Insert(%p, %p) -> Expected %d, but got %d.", &rb, data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_power_of_two_overwrite(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[4];
+    uint32_t data;
+    uint32_t read_data;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(uint32_t),
+                               .overwrite = true,
+                               .power_of_two = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    for (data = 0; data < 7; data++)
+    {
+        result = RING_BUFFER_Insert(&rb, &data);
+    }
+
+    ASSERT_EQ_MSG(4, rb.count, "Expected %d, but got %zu.", 4, rb.count);
+    ASSERT_EQ_MSG(7, rb.head, "Expected %d, but got %zu.", 7, rb.head);
+    ASSERT_EQ_MSG(3, rb.tail, "Expected %d, but got %zu.", 3, rb.tail);
+
+    data = 99;
+    result = RING_BUFFER_Replace(&rb, 2, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Replace(%p, %d, %p) -> Expected %d, but got %d.", &rb, 2,
+                  &data, RING_BUFFER_STATUS_OK, result);
+
+    const uint32_t expected[4] = {3, 4, 99, 6};
+    for (size_t i = 0; i < 4; i++)
+    {
+        result = RING_BUFFER_Peek(&rb, i, &read_data);
+        ASSERT_EQ_MSG(expected[i], read_data, "Expected %u, but got %u.", expected[i], read_data);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_power_of_two_many_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint16_t buffer[8];
+    uint16_t data[12];
+    uint16_t read_data[8];
+    size_t written = 0;
+    size_t read = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(uint16_t),
+                               .overwrite = true,
+                               .power_of_two = true};
+
+    for (uint16_t i = 0; i < 12; i++)
+    {
+        data[i] = (uint16_t)(0x100 + i);
+    }
+
+    result = RING_BUFFER_Init(&rb, conf);
+    result = RING_BUFFER_InsertMany(&rb, data, 5, &written);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 5, &read);
+
+    // Batch larger than the buffer keeps only the newest elements
+    result = RING_BUFFER_InsertMany(&rb, data, 12, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, %p, %d, %p) -> Expected %d, but got %d.",
+                  &rb, data, 12, &written, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(8, rb.count, "Expected %d, but got %zu.", 8, rb.count);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 8, &read);
+    ASSERT_EQ_MSG(8, read, "Expected %d, but got %zu.", 8, read);
+    ASSERT_EQ_MSG(0, memcmp(&data[4], read_data, sizeof(read_data)), "Retrieved elements differ.");
+    ASSERT_EQ_MSG(rb.head, rb.tail, "Expected %zu, but got %zu.", rb.head, rb.tail);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_typed_null_handle(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t data = 0xAA;
+    typed_u8x10_t rb;
+
+    result = typed_u8x10_init(&rb, false);
+
+    result = typed_u8x10_push(NULL, data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "typed_u8x10_push(%p, %d) -> Expected %d, but got %d.",
+                  NULL, data, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = typed_u8x10_pop(&rb, NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "typed_u8x10_pop(%p, %p) -> Expected %d, but got %d.",
+                  &rb, NULL, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = typed_u8x10_peek(&rb, 0, NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "typed_u8x10_peek(%p, %d, %p) -> Expected %d, but got %d.", &rb, 0, NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = typed_u8x10_replace(NULL, 0, data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "typed_u8x10_replace(%p, %d, %d) -> Expected %d, but got %d.", NULL, 0, data,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_typed_insert_full_buffer(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    typed_u8x1_t rb;
+
+    result = typed_u8x1_init(&rb, false);
+    result = typed_u8x1_push(&rb, 0xAA);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "typed_u8x1_push(%p, %d) -> Expected %d, but got %d.", &rb, 0xAA,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, rb.count, "Expected %d, but got %zu.", 1, rb.count);
+    ASSERT_EQ_MSG(0, rb.head, "Expected %d, but got %zu.", 0, rb.head);
+    ASSERT_EQ_MSG(0, rb.tail, "Expected %d, but got %zu.", 0, rb.tail);
+
+    result = typed_u8x1_push(&rb, 0xBB);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result, "typed_u8x1_push(%p, %d) -> Expected %d, but got %d.",
+                  &rb, 0xBB, RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    ASSERT_EQ_MSG(1, rb.count, "Expected %d, but got %zu.", 1, rb.count);
+    ASSERT_EQ_MSG(0xAA, rb.items[0], "Expected %d, but got %d.", 0xAA, rb.items[0]);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_typed_insert_overwrite(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    typed_u8x1_t rb;
+
+    result = typed_u8x1_init(&rb, true);
+    result = typed_u8x1_push(&rb, 0xAA);
+    result = typed_u8x1_push(&rb, 0xBB);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "typed_u8x1_push(%p, %d) -> Expected %d, but got %d.", &rb, 0xBB,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, rb.count, "Expected %d, but got %zu.", 1, rb.count);
+    ASSERT_EQ_MSG(0, rb.head, "Expected %d, but got %zu.", 0, rb.head);
+    ASSERT_EQ_MSG(0, rb.tail, "Expected %d, but got %zu.", 0, rb.tail);
+    ASSERT_EQ_MSG(0xBB, rb.items[0], "Expected %d, but got %d.", 0xBB, rb.items[0]);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_typed_retrieve_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t read_data = 0;
+    typed_u8x10_t rb;
+
+    result = typed_u8x10_init(&rb, false);
+    result = typed_u8x10_pop(&rb, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "typed_u8x10_pop(%p, %p) -> Expected %d, but got %d.",
+                  &rb, &read_data, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    result = typed_u8x10_push(&rb, 0xAA);
+    result = typed_u8x10_pop(&rb, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "typed_u8x10_pop(%p, %p) -> Expected %d, but got %d.", &rb,
+                  &read_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0xAA, read_data, "Expected %d, but got %d.", 0xAA, read_data);
+    ASSERT_EQ_MSG(1, rb.tail, "Expected %d, but got %zu.", 1, rb.tail);
+
+    result = typed_u8x10_pop(&rb, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "typed_u8x10_pop(%p, %p) -> Expected %d, but got %d.",
+                  &rb, &read_data, RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_typed_peek_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint16_t read_data = 0;
+    typed_u16x3_t rb;
+
+    result = typed_u16x3_init(&rb, true);
+    result = typed_u16x3_push(&rb, 0x1122);
+    result = typed_u16x3_peek(&rb, 0, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "typed_u16x3_peek(%p, %d, %p) -> Expected %d, but got %d.", &rb, 0,
+                  &read_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0x1122, read_data, "Expected %d, but got %d.", 0x1122, read_data);
+
+    result = typed_u16x3_peek(&rb, 1, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "typed_u16x3_peek(%p, %d, %p) -> Expected %d, but got %d.", &rb, 1, &read_data,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+
+    // Wrap around the end of the storage
+    result = typed_u16x3_push(&rb, 0x3344);
+    result = typed_u16x3_push(&rb, 0x5566);
+    result = typed_u16x3_push(&rb, 0x7788);
+    result = typed_u16x3_peek(&rb, 2, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "typed_u16x3_peek(%p, %d, %p) -> Expected %d, but got %d.", &rb, 2,
+                  &read_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0x7788, read_data, "Expected %d, but got %d.", 0x7788, read_data);
+
+    result = typed_u16x3_peek(&rb, 0, &read_data);
+    ASSERT_EQ_MSG(0x3344, read_data, "Expected %d, but got %d.", 0x3344, read_data);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_typed_replace_valid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t read_data = 0;
+    typed_u8x10_t rb;
+
+    result = typed_u8x10_init(&rb, false);
+    result = typed_u8x10_replace(&rb, 0, 0xBB);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "typed_u8x10_replace(%p, %d, %d) -> Expected %d, but got %d.", &rb, 0, 0xBB,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    for (int i = 0; i < 5; i++)
+    {
+        result = typed_u8x10_push(&rb, 0xAA);
+    }
+
+    result = typed_u8x10_replace(&rb, 2, 0xBB);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "typed_u8x10_replace(%p, %d, %d) -> Expected %d, but got %d.", &rb, 2,
+                  0xBB, RING_BUFFER_STATUS_OK, result);
+
+    result = typed_u8x10_peek(&rb, 2, &read_data);
+    ASSERT_EQ_MSG(0xBB, read_data, "Expected %d, but got %d.", 0xBB, read_data);
+
+    result = typed_u8x10_replace(&rb, 5, 0xBB);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "typed_u8x10_replace(%p, %d, %d) -> Expected %d, but got %d.", &rb, 5, 0xBB,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_typed_matches_generic(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    ring_buffer_status_e typed_result;
+    uint16_t value;
+    uint16_t typed_value;
+    uint16_t buffer3[3];
+    uint16_t buffer4[4];
+    ring_buffer_t rb3;
+    ring_buffer_t rb4;
+    typed_u16x3_t typed3;
+    typed_u16x4_t typed4;
+    ring_buffer_conf_t conf3 = {
+        .buffer = (uint8_t *)buffer3, .buffer_size = sizeof(buffer3), .element_size = 2, .overwrite = true};
+    ring_buffer_conf_t conf4 = {
+        .buffer = (uint8_t *)buffer4, .buffer_size = sizeof(buffer4), .element_size = 2, .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb3, conf3);
+    result = RING_BUFFER_Init(&rb4, conf4);
+    typed_result = typed_u16x3_init(&typed3, true);
+    typed_result = typed_u16x4_init(&typed4, false);
+
+    // Random sequence of operations must give the same results through both APIs
+    for (uint16_t i = 0; i < 500; i++)
+    {
+        size_t index = (size_t)(rand() % 5);
+        value = (uint16_t)rand();
+
+        switch (rand() % 4)
+        {
+            case 0:
+                result = RING_BUFFER_Insert(&rb3, &value);
+                typed_result = typed_u16x3_push(&typed3, value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d insert: expected %d, but got %d.", i, result,
+                              typed_result);
+                result = RING_BUFFER_Insert(&rb4, &value);
+                typed_result = typed_u16x4_push(&typed4, value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d insert: expected %d, but got %d.", i, result,
+                              typed_result);
+                break;
+            case 1:
+                value = 0;
+                typed_value = 0;
+                result = RING_BUFFER_Retrieve(&rb3, &value);
+                typed_result = typed_u16x3_pop(&typed3, &typed_value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d retrieve: expected %d, but got %d.", i, result,
+                              typed_result);
+                ASSERT_EQ_MSG(value, typed_value, "Step %d retrieve: expected %d, but got %d.", i, value, typed_value);
+                result = RING_BUFFER_Retrieve(&rb4, &value);
+                typed_result = typed_u16x4_pop(&typed4, &typed_value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d retrieve: expected %d, but got %d.", i, result,
+                              typed_result);
+                ASSERT_EQ_MSG(value, typed_value, "Step %d retrieve: expected %d, but got %d.", i, value, typed_value);
+                break;
+            case 2:
+                value = 0;
+                typed_value = 0;
+                result = RING_BUFFER_Peek(&rb3, index, &value);
+                typed_result = typed_u16x3_peek(&typed3, index, &typed_value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d peek: expected %d, but got %d.", i, result, typed_result);
+                ASSERT_EQ_MSG(value, typed_value, "Step %d peek: expected %d, but got %d.", i, value, typed_value);
+                result = RING_BUFFER_Peek(&rb4, index, &value);
+                typed_result = typed_u16x4_peek(&typed4, index, &typed_value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d peek: expected %d, but got %d.", i, result, typed_result);
+                ASSERT_EQ_MSG(value, typed_value, "Step %d peek: expected %d, but got %d.", i, value, typed_value);
+                break;
+            default:
+                result = RING_BUFFER_Replace(&rb3, index, &value);
+                typed_result = typed_u16x3_replace(&typed3, index, value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d replace: expected %d, but got %d.", i, result,
+                              typed_result);
+                result = RING_BUFFER_Replace(&rb4, index, &value);
+                typed_result = typed_u16x4_replace(&typed4, index, value);
+                ASSERT_EQ_MSG(result, typed_result, "Step %d replace: expected %d, but got %d.", i, result,
+                              typed_result);
+                break;
+        }
+
+        ASSERT_EQ_MSG(rb3.count, typed3.count, "Step %d: expected count %zu, but got %zu.", i, rb3.count, typed3.count);
+        ASSERT_EQ_MSG(rb4.count, typed4.count, "Step %d: expected count %zu, but got %zu.", i, rb4.count, typed4.count);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_reserve_write_null_handle(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    void *seg1;
+    void *seg2;
+    size_t len1;
+    size_t len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    result = RING_BUFFER_ReserveWrite(NULL, 4, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_ReserveWrite(%p, %d, ...) -> Expected %d, but got %d.", NULL, 4,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_ReserveWrite(&rb, 4, NULL, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_ReserveWrite(%p, %d, %p, ...) -> Expected %d, but got %d.", &rb, 4, NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_ReserveWrite(&rb, 4, &seg1, &len1, &seg2, NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_ReserveWrite(%p, %d, ..., %p) -> Expected %d, but got %d.", &rb, 4, NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_CommitWrite(NULL, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_CommitWrite(%p, %d) -> Expected %d, but got %d.", NULL, 0,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_reserve_write_full_buffer(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    uint8_t data[4] = {1, 2, 3, 4};
+    size_t written = 0;
+    void *seg1;
+    void *seg2;
+    size_t len1;
+    size_t len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+
+    // Reservation is limited to the free elements
+    result = RING_BUFFER_ReserveWrite(&rb, 4, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ReserveWrite(%p, %d, ...) -> Expected %d, but got %d.",
+                  &rb, 4, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, len1, "Expected %d, but got %zu.", 1, len1);
+    ASSERT_EQ_MSG(0, len2, "Expected %d, but got %zu.", 0, len2);
+
+    result = RING_BUFFER_CommitWrite(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_CommitWrite(%p, %d) -> Expected %d, but got %d.", &rb, 2,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(3, rb.count, "Expected %d, but got %zu.", 3, rb.count);
+
+    // The failed commit ended the reservation
+    result = RING_BUFFER_ReserveWrite(&rb, 4, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ReserveWrite(%p, %d, ...) -> Expected %d, but got %d.",
+                  &rb, 4, RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_CommitWrite(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_CommitWrite(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, rb.count, "Expected %d, but got %zu.", 4, rb.count);
+
+    result = RING_BUFFER_ReserveWrite(&rb, 1, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_ReserveWrite(%p, %d, ...) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    ASSERT_EQ_MSG(0, len1, "Expected %d, but got %zu.", 0, len1);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_reserve_write_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data;
+    size_t written = 0;
+    void *seg1;
+    void *seg2;
+    size_t len1;
+    size_t len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t), .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Move head and tail close to the end, so the reservation is split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    result = RING_BUFFER_Retrieve(&rb, &read_data);
+    result = RING_BUFFER_Retrieve(&rb, &read_data);
+    result = RING_BUFFER_Retrieve(&rb, &read_data);
+
+    result = RING_BUFFER_ReserveWrite(&rb, 3, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ReserveWrite(%p, %d, ...) -> Expected %d, but got %d.",
+                  &rb, 3, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (buffer + 6 == (uint8_t *)seg1), "Expected seg1 %p, but got %p.", buffer + 6, seg1);
+    ASSERT_EQ_MSG(2, len1, "Expected %d, but got %zu.", 2, len1);
+    ASSERT_EQ_MSG(1, (buffer == (uint8_t *)seg2), "Expected seg2 %p, but got %p.", buffer, seg2);
+    ASSERT_EQ_MSG(4, len2, "Expected %d, but got %zu.", 4, len2);
+
+    // Serialize directly into the reserved space, nothing is visible before the commit
+    memcpy(seg1, &data[0], len1);
+    memcpy(seg2, &data[1], len2);
+    ASSERT_EQ_MSG(0, rb.count, "Expected %d, but got %zu.", 0, rb.count);
+
+    result = RING_BUFFER_CommitWrite(&rb, 3);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_CommitWrite(%p, %d) -> Expected %d, but got %d.", &rb, 3,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, rb.count, "Expected %d, but got %zu.", 3, rb.count);
+    ASSERT_EQ_MSG(4, rb.head, "Expected %d, but got %zu.", 4, rb.head);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        result = RING_BUFFER_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(data[i], read_data, "Expected %d, but got %d.", data[i], read_data);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_reserve_write_overwrite(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    uint8_t data[4] = {1, 2, 3, 4};
+    uint8_t read_data;
+    size_t written = 0;
+    void *seg1;
+    void *seg2;
+    size_t len1;
+    size_t len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    result = RING_BUFFER_InsertMany(&rb, data, 4, &written);
+
+    // Reservation covers the two oldest elements, they are evicted on commit
+    result = RING_BUFFER_ReserveWrite(&rb, 2, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ReserveWrite(%p, %d, ...) -> Expected %d, but got %d.",
+                  &rb, 2, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, len1 + len2, "Expected %d, but got %zu.", 2, len1 + len2);
+
+    ((uint8_t *)seg1)[0] = 5;
+    ((uint8_t *)seg1)[1] = 6;
+
+    result = RING_BUFFER_CommitWrite(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_CommitWrite(%p, %d) -> Expected %d, but got %d.", &rb, 2,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, rb.count, "Expected %d, but got %zu.", 4, rb.count);
+
+    for (uint8_t i = 3; i <= 6; i++)
+    {
+        result = RING_BUFFER_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(i, read_data, "Expected %d, but got %d.", i, read_data);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_peek_spans_null_handle(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    const void *seg1;
+    const void *seg2;
+    size_t len1;
+    size_t len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    result = RING_BUFFER_PeekSpans(NULL, 4, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_PeekSpans(%p, %d, ...) -> Expected %d, but got %d.", NULL, 4,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_PeekSpans(&rb, 4, &seg1, NULL, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_PeekSpans(%p, %d, %p, %p, ...) -> Expected %d, but got %d.", &rb, 4, &seg1, NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_PeekSpans(&rb, 4, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_PeekSpans(%p, %d, ...) -> Expected %d, but got %d.", &rb, 4,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    result = RING_BUFFER_Consume(NULL, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Consume(%p, %d) -> Expected %d, but got %d.", NULL, 0,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_Consume(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Consume(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_peek_spans_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[3] = {0};
+    size_t written = 0;
+    const void *seg1;
+    const void *seg2;
+    size_t len1;
+    size_t len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t), .overwrite = false};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Move head and tail close to the end, so the stored elements are split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+
+    result = RING_BUFFER_PeekSpans(&rb, 2, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekSpans(%p, %d, ...) -> Expected %d, but got %d.", &rb,
+                  2, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, len1, "Expected %d, but got %zu.", 2, len1);
+    ASSERT_EQ_MSG(2, len2, "Expected %d, but got %zu.", 2, len2);
+
+    result = RING_BUFFER_PeekSpans(&rb, 10, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekSpans(%p, %d, ...) -> Expected %d, but got %d.", &rb,
+                  10, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (buffer + 6 == (const uint8_t *)seg1), "Expected seg1 %p, but got %p.", buffer + 6, seg1);
+    ASSERT_EQ_MSG(2, len1, "Expected %d, but got %zu.", 2, len1);
+    ASSERT_EQ_MSG(1, (buffer == (const uint8_t *)seg2), "Expected seg2 %p, but got %p.", buffer, seg2);
+    ASSERT_EQ_MSG(4, len2, "Expected %d, but got %zu.", 4, len2);
+
+    // Parse in place, the elements stay in the buffer until consumed
+    memcpy(&read_data[0], seg1, len1);
+    memcpy(&read_data[1], seg2, len2);
+    ASSERT_EQ_MSG(0, memcmp(data, read_data, sizeof(data)), "Expected %d, but got %d.", 0,
+                  memcmp(data, read_data, sizeof(data)));
+    ASSERT_EQ_MSG(3, rb.count, "Expected %d, but got %zu.", 3, rb.count);
+
+    result = RING_BUFFER_Consume(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Consume(%p, %d) -> Expected %d, but got %d.", &rb, 2,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, rb.count, "Expected %d, but got %zu.", 1, rb.count);
+    ASSERT_EQ_MSG(2, rb.tail, "Expected %d, but got %zu.", 2, rb.tail);
+
+    result = RING_BUFFER_Retrieve(&rb, &read_data[0]);
+    ASSERT_EQ_MSG(data[2], read_data[0], "Expected %d, but got %d.", data[2], read_data[0]);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_spsc_init_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    ring_buffer_spsc_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = true};
+
+    result = RING_BUFFER_SPSC_Init(NULL, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_SPSC_Init(%p, conf) -> Expected %d, but got %d.", NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Overwrite is not supported, the producer must never move the tail
+    result = RING_BUFFER_SPSC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_SPSC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    conf.overwrite = false;
+    conf.element_size = sizeof(buffer) + 1;
+    result = RING_BUFFER_SPSC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_SPSC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    conf.element_size = 2;
+    result = RING_BUFFER_SPSC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SPSC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, rb.max_elements, "Expected %d, but got %zu.", 4, rb.max_elements);
+
+    result = RING_BUFFER_SPSC_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SPSC_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_SPSC_Insert(&rb, buffer);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result,
+                  "RING_BUFFER_SPSC_Insert(%p, %p) -> Expected %d, but got %d.", &rb, buffer,
+                  RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_spsc_insert_full_buffer(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[3];
+    uint8_t data = 0xAA;
+    size_t count = 0;
+    ring_buffer_spsc_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_SPSC_Init(&rb, conf);
+
+    for (size_t i = 0; i < sizeof(buffer); i++)
+    {
+        result = RING_BUFFER_SPSC_Insert(&rb, &data);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SPSC_Insert(%p, %p) -> Expected %d, but got %d.", &rb,
+                      &data, RING_BUFFER_STATUS_OK, result);
+    }
+
+    result = RING_BUFFER_SPSC_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_SPSC_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    result = RING_BUFFER_SPSC_GetCount(&rb, &count);
+    ASSERT_EQ_MSG(3, count, "Expected %d, but got %zu.", 3, count);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_spsc_insert_retrieve(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint16_t buffer[3];
+    uint16_t read_data;
+    size_t count = 0;
+    ring_buffer_spsc_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint16_t),
+        .overwrite = false,
+    };
+
+    result = RING_BUFFER_SPSC_Init(&rb, conf);
+
+    result = RING_BUFFER_SPSC_Retrieve(&rb, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_SPSC_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb, &read_data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // Several laps with a non power-of-two capacity, so the positions wrap at both limits
+    for (uint16_t i = 0; i < 20; i++)
+    {
+        uint16_t value = (uint16_t)(0x1000 + i);
+        result = RING_BUFFER_SPSC_Insert(&rb, &value);
+        value++;
+        result = RING_BUFFER_SPSC_Insert(&rb, &value);
+
+        result = RING_BUFFER_SPSC_GetCount(&rb, &count);
+        ASSERT_EQ_MSG(2, count, "Expected %d, but got %zu.", 2, count);
+
+        result = RING_BUFFER_SPSC_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(0x1000 + i, read_data, "Expected %d, but got %d.", 0x1000 + i, read_data);
+        result = RING_BUFFER_SPSC_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(0x1001 + i, read_data, "Expected %d, but got %d.", 0x1001 + i, read_data);
+    }
+
+    result = RING_BUFFER_SPSC_GetCount(&rb, &count);
+    ASSERT_EQ_MSG(0, count, "Expected %d, but got %zu.", 0, count);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_spsc_many_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[5];
+    uint8_t data[7] = {1, 2, 3, 4, 5, 6, 7};
+    uint8_t read_data[7] = {0};
+    size_t written = 0;
+    size_t read = 0;
+    ring_buffer_spsc_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = false};
+
+    result = RING_BUFFER_SPSC_Init(&rb, conf);
+
+    result = RING_BUFFER_SPSC_InsertMany(&rb, data, 3, &written);
+    result = RING_BUFFER_SPSC_RetrieveMany(&rb, read_data, 3, &read);
+
+    // Only the free elements are accepted, split at the wrap point
+    result = RING_BUFFER_SPSC_InsertMany(&rb, data, 7, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_SPSC_InsertMany(%p, %p, %d, %p) -> Expected %d, but got %d.", &rb, data, 7, &written,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(5, written, "Expected %d, but got %zu.", 5, written);
+
+    result = RING_BUFFER_SPSC_InsertMany(&rb, data, 1, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_SPSC_InsertMany(%p, %p, %d, %p) -> Expected %d, but got %d.", &rb, data, 1, &written,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    result = RING_BUFFER_SPSC_RetrieveMany(&rb, read_data, 7, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_SPSC_RetrieveMany(%p, %p, %d, %p) -> Expected %d, but got %d.", &rb, read_data, 7, &read,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(5, read, "Expected %d, but got %zu.", 5, read);
+    ASSERT_EQ_MSG(0, memcmp(data, read_data, 5), "Expected %d, but got %d.", 0, memcmp(data, read_data, 5));
+
+    result = RING_BUFFER_SPSC_RetrieveMany(&rb, read_data, 7, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_SPSC_RetrieveMany(%p, %p, %d, %p) -> Expected %d, but got %d.", &rb, read_data, 7, &read,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mpmc_init_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static size_t buffer[RING_BUFFER_MPMC_BUFFER_SIZE(4, 4) / sizeof(size_t) + 1];
+    ring_buffer_mpmc_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = RING_BUFFER_MPMC_SLOT_SIZE(4) - 1, .element_size = 4};
+
+    result = RING_BUFFER_MPMC_Init(NULL, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MPMC_Init(%p, conf) -> Expected %d, but got %d.", NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Buffer smaller than one slot
+    result = RING_BUFFER_MPMC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MPMC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Sequence numbers need an aligned buffer
+    conf.buffer = (uint8_t *)buffer + 1;
+    conf.buffer_size = RING_BUFFER_MPMC_BUFFER_SIZE(4, 4);
+    result = RING_BUFFER_MPMC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MPMC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    conf.buffer = (uint8_t *)buffer;
+    conf.overwrite = true;
+    result = RING_BUFFER_MPMC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MPMC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Three slots fit, only the largest power of two is used
+    conf.overwrite = false;
+    conf.buffer_size = RING_BUFFER_MPMC_BUFFER_SIZE(4, 3);
+    result = RING_BUFFER_MPMC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MPMC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, rb.max_elements, "Expected %d, but got %zu.", 2, rb.max_elements);
+    ASSERT_EQ_MSG(0, rb.slot_size % RING_BUFFER_CONF_CACHE_LINE_SIZE, "Expected %d, but got %zu.", 0,
+                  rb.slot_size % RING_BUFFER_CONF_CACHE_LINE_SIZE);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mpmc_insert_full_buffer(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static size_t buffer[RING_BUFFER_MPMC_BUFFER_SIZE(1, 4) / sizeof(size_t)];
+    uint8_t data = 0xAA;
+    size_t count = 0;
+    ring_buffer_mpmc_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    result = RING_BUFFER_MPMC_Init(&rb, conf);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        result = RING_BUFFER_MPMC_Insert(&rb, &data);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MPMC_Insert(%p, %p) -> Expected %d, but got %d.", &rb,
+                      &data, RING_BUFFER_STATUS_OK, result);
+    }
+
+    result = RING_BUFFER_MPMC_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_MPMC_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    result = RING_BUFFER_MPMC_GetCount(&rb, &count);
+    ASSERT_EQ_MSG(4, count, "Expected %d, but got %zu.", 4, count);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mpmc_insert_retrieve(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static size_t buffer[RING_BUFFER_MPMC_BUFFER_SIZE(sizeof(uint32_t), 2) / sizeof(size_t)];
+    uint32_t read_data;
+    size_t count = 0;
+    ring_buffer_mpmc_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    result = RING_BUFFER_MPMC_Init(&rb, conf);
+
+    result = RING_BUFFER_MPMC_Retrieve(&rb, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_MPMC_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb, &read_data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // Several laps, so every slot sequence number moves on a few times
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        uint32_t value = 0xA0000000u + i;
+        result = RING_BUFFER_MPMC_Insert(&rb, &value);
+        value += 0x100;
+        result = RING_BUFFER_MPMC_Insert(&rb, &value);
+
+        result = RING_BUFFER_MPMC_GetCount(&rb, &count);
+        ASSERT_EQ_MSG(2, count, "Expected %d, but got %zu.", 2, count);
+
+        result = RING_BUFFER_MPMC_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(0xA0000000u + i, read_data, "Expected %u, but got %u.", 0xA0000000u + i, read_data);
+        result = RING_BUFFER_MPMC_Retrieve(&rb, &read_data);
+        ASSERT_EQ_MSG(0xA0000100u + i, read_data, "Expected %u, but got %u.", 0xA0000100u + i, read_data);
+    }
+
+    result = RING_BUFFER_MPMC_Retrieve(&rb, &read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_MPMC_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb, &read_data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mpsc_init_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static size_t buffer[RING_BUFFER_MPSC_BUFFER_SIZE(sizeof(uint32_t), 4) / sizeof(size_t) + 1];
+    ring_buffer_mpsc_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint32_t),
+        .overwrite = true,
+    };
+
+    result = RING_BUFFER_MPSC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MPSC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    conf.overwrite = false;
+    conf.buffer = (uint8_t *)buffer + 1;
+    result = RING_BUFFER_MPSC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MPSC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Room for four slots and a bit, rounded down to a power of two
+    conf.buffer = (uint8_t *)buffer;
+    result = RING_BUFFER_MPSC_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MPSC_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, rb.max_elements, "Expected %d, but got %zu.", 4, rb.max_elements);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mpsc_insert_full_buffer(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static size_t buffer[(RING_BUFFER_MPSC_BUFFER_SIZE(1, 4) + sizeof(size_t) - 1) / sizeof(size_t)];
+    uint8_t data = 0xAA;
+    ring_buffer_mpsc_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    result = RING_BUFFER_MPSC_Init(&rb, conf);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        result = RING_BUFFER_MPSC_Insert(&rb, &data);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MPSC_Insert(%p, %p) -> Expected %d, but got %d.", &rb,
+                      &data, RING_BUFFER_STATUS_OK, result);
+    }
+
+    // A rejected insert must not take a position, the next retrieve / insert pair keeps working
+    result = RING_BUFFER_MPSC_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_MPSC_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    result = RING_BUFFER_MPSC_Retrieve(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MPSC_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb,
+                  &data, RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_MPSC_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MPSC_Insert(%p, %p) -> Expected %d, but got %d.", &rb,
+                  &data, RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mpsc_retrieve_many(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static size_t buffer[RING_BUFFER_MPSC_BUFFER_SIZE(sizeof(uint32_t), 4) / sizeof(size_t)];
+    uint32_t read_data[4];
+    size_t read = 0;
+    ring_buffer_mpsc_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    result = RING_BUFFER_MPSC_Init(&rb, conf);
+
+    result = RING_BUFFER_MPSC_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_MPSC_RetrieveMany(%p, %p, 4, %p) -> Expected %d, but got %d.", &rb, read_data, &read,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // Several laps with the batch crossing the wrap
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        for (uint32_t j = 0; j < 3; j++)
+        {
+            uint32_t value = 0xA0000000u + i * 0x100 + j;
+            result = RING_BUFFER_MPSC_Insert(&rb, &value);
+        }
+
+        result = RING_BUFFER_MPSC_RetrieveMany(&rb, read_data, 4, &read);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                      "RING_BUFFER_MPSC_RetrieveMany(%p, %p, 4, %p) -> Expected %d, but got %d.", &rb, read_data,
+                      &read, RING_BUFFER_STATUS_OK, result);
+        ASSERT_EQ_MSG(3, read, "Expected %d, but got %zu.", 3, read);
+
+        for (uint32_t j = 0; j < 3; j++)
+        {
+            ASSERT_EQ_MSG(0xA0000000u + i * 0x100 + j, read_data[j], "Expected %u, but got %u.",
+                          0xA0000000u + i * 0x100 + j, read_data[j]);
+        }
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mpsc_retrieve_stops_at_unpublished(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static size_t buffer[RING_BUFFER_MPSC_BUFFER_SIZE(sizeof(uint32_t), 4) / sizeof(size_t)];
+    uint32_t value = 0x11;
+    uint32_t read_data[4];
+    size_t read = 0;
+    ring_buffer_mpsc_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    result = RING_BUFFER_MPSC_Init(&rb, conf);
+
+    result = RING_BUFFER_MPSC_Insert(&rb, &value);
+
+    // Emulate a producer that claimed position 1 but did not publish it yet, position 2 is published
+    atomic_fetch_sub(&rb.credits, 2);
+    atomic_fetch_add(&rb.head, 2);
+    value = 0x33;
+    memcpy(rb.data + 2 * sizeof(uint32_t), &value, sizeof(uint32_t));
+    atomic_store(&rb.flags[2], 3);
+
+    result = RING_BUFFER_MPSC_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(1, read, "Expected %d, but got %zu.", 1, read);
+    ASSERT_EQ_MSG(0x11, read_data[0], "Expected %u, but got %u.", 0x11, read_data[0]);
+
+    result = RING_BUFFER_MPSC_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_MPSC_RetrieveMany(%p, %p, 4, %p) -> Expected %d, but got %d.", &rb, read_data, &read,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // The slow producer publishes, both elements come out in position order
+    value = 0x22;
+    memcpy(rb.data + 1 * sizeof(uint32_t), &value, sizeof(uint32_t));
+    atomic_store(&rb.flags[1], 2);
+
+    result = RING_BUFFER_MPSC_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(2, read, "Expected %d, but got %zu.", 2, read);
+    ASSERT_EQ_MSG(0x22, read_data[0], "Expected %u, but got %u.", 0x22, read_data[0]);
+    ASSERT_EQ_MSG(0x33, read_data[1], "Expected %u, but got %u.", 0x33, read_data[1]);
+
+    return failed_assertions;
+}
+
+static void _counter_lock(void *ctx)
+{
+    lock_counter_t *counter = (lock_counter_t *)ctx;
+
+    counter->held++;
+    counter->taken++;
+
+    if (counter->held > counter->max_held)
+    {
+        counter->max_held = counter->held;
+    }
+}
+
+static void _counter_unlock(void *ctx)
+{
+    ((lock_counter_t *)ctx)->held--;
+}
+
+static int32_t test_ring_buffer_lock_invalid_hook(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    lock_counter_t counter = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    conf.producer_lock.lock = _counter_lock;
+    conf.producer_lock.ctx = &counter;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "RING_BUFFER_Init(%p, conf) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    conf.producer_lock.unlock = _counter_unlock;
+    conf.consumer_lock.unlock = _counter_unlock;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "RING_BUFFER_Init(%p, conf) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_LOCK_Pthread(&conf.consumer_lock, NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_LOCK_Pthread(%p, NULL) -> Expected %d, but got %d.", &conf.consumer_lock,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_lock_split_sides(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[2];
+    uint8_t data = 0x5A;
+    size_t count = 0;
+    void *wseg1, *wseg2;
+    const void *rseg1, *rseg2;
+    size_t len1, len2;
+    lock_counter_t producer = {0};
+    lock_counter_t consumer = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    conf.producer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &producer};
+    conf.consumer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &consumer};
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Inserting only takes the producer lock, also when the buffer is full
+    result = RING_BUFFER_Insert(&rb, &data);
+    result = RING_BUFFER_InsertMany(&rb, &data, 1, &count);
+    result = RING_BUFFER_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    ASSERT_EQ_MSG(3, producer.taken, "Expected %d, but got %d.", 3, producer.taken);
+    ASSERT_EQ_MSG(0, consumer.taken, "Expected %d, but got %d.", 0, consumer.taken);
+
+    // Retrieving only takes the consumer lock, also when the buffer is empty
+    result = RING_BUFFER_Peek(&rb, 0, &data);
+    result = RING_BUFFER_Retrieve(&rb, &data);
+    result = RING_BUFFER_RetrieveMany(&rb, &data, 1, &count);
+    result = RING_BUFFER_Retrieve(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    ASSERT_EQ_MSG(3, producer.taken, "Expected %d, but got %d.", 3, producer.taken);
+    ASSERT_EQ_MSG(4, consumer.taken, "Expected %d, but got %d.", 4, consumer.taken);
+
+    // Zero-copy pairs keep their lock from the first call to the second one
+    result = RING_BUFFER_ReserveWrite(&rb, 1, &wseg1, &len1, &wseg2, &len2);
+    ASSERT_EQ_MSG(1, producer.held, "Expected %d, but got %d.", 1, producer.held);
+    result = RING_BUFFER_CommitWrite(&rb, 1);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+
+    result = RING_BUFFER_PeekSpans(&rb, 1, &rseg1, &len1, &rseg2, &len2);
+    ASSERT_EQ_MSG(1, consumer.held, "Expected %d, but got %d.", 1, consumer.held);
+    result = RING_BUFFER_Consume(&rb, 1);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+
+    result = RING_BUFFER_PeekSpans(&rb, 1, &rseg1, &len1, &rseg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_PeekSpans(%p, 1, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+    ASSERT_EQ_MSG(1, producer.max_held, "Expected %d, but got %d.", 1, producer.max_held);
+    ASSERT_EQ_MSG(1, consumer.max_held, "Expected %d, but got %d.", 1, consumer.max_held);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_lock_overwrite_evicts(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[2];
+    uint8_t data = 0;
+    void *wseg1, *wseg2;
+    size_t len1, len2;
+    lock_counter_t producer = {0};
+    lock_counter_t consumer = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = true};
+
+    conf.producer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &producer};
+    conf.consumer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &consumer};
+    result = RING_BUFFER_Init(&rb, conf);
+
+    for (uint8_t i = 1; i <= 2; i++)
+    {
+        result = RING_BUFFER_Insert(&rb, &i);
+    }
+    ASSERT_EQ_MSG(0, consumer.taken, "Expected %d, but got %d.", 0, consumer.taken);
+
+    // Eviction moves the tail, so the producer also takes the consumer lock
+    data = 3;
+    result = RING_BUFFER_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, consumer.taken, "Expected %d, but got %d.", 1, consumer.taken);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+
+    result = RING_BUFFER_ReserveWrite(&rb, 1, &wseg1, &len1, &wseg2, &len2);
+    ASSERT_EQ_MSG(1, consumer.held, "Expected %d, but got %d.", 1, consumer.held);
+    *(uint8_t *)wseg1 = 4;
+    result = RING_BUFFER_CommitWrite(&rb, 1);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+
+    result = RING_BUFFER_Retrieve(&rb, &data);
+    ASSERT_EQ_MSG(3, data, "Expected %d, but got %d.", 3, data);
+    result = RING_BUFFER_Retrieve(&rb, &data);
+    ASSERT_EQ_MSG(4, data, "Expected %d, but got %d.", 4, data);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_lock_commit_write_error_unlocks(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[2];
+    uint8_t data = 0x5A;
+    void *seg1, *seg2;
+    size_t len1, len2;
+    lock_counter_t producer = {0};
+    lock_counter_t consumer = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1, .overwrite = true};
+
+    conf.producer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &producer};
+    conf.consumer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &consumer};
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_InsertMany(&rb, buffer, 2, &len1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, %p, 2, ...) -> Expected %d, but got %d.",
+                  &rb, buffer, RING_BUFFER_STATUS_OK, result);
+
+    // Full buffer in overwrite mode, the reservation holds both locks
+    result = RING_BUFFER_ReserveWrite(&rb, 1, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ReserveWrite(%p, 1, ...) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, producer.held, "Expected %d, but got %d.", 1, producer.held);
+    ASSERT_EQ_MSG(1, consumer.held, "Expected %d, but got %d.", 1, consumer.held);
+
+    result = RING_BUFFER_CommitWrite(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_CommitWrite(%p, 2) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+
+    // Nothing was committed and both sides keep working without taking a lock twice
+    result = RING_BUFFER_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Retrieve(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb,
+                  &data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(buffer[1], data, "Expected %u, but got %u.", buffer[1], data);
+    ASSERT_EQ_MSG(1, producer.max_held, "Expected %d, but got %d.", 1, producer.max_held);
+    ASSERT_EQ_MSG(1, consumer.max_held, "Expected %d, but got %d.", 1, consumer.max_held);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_lock_commit_write_without_reservation(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[2];
+    uint8_t data[2] = {0x11, 0x22};
+    void *seg1, *seg2;
+    size_t len1, len2;
+    size_t count = 0;
+    lock_counter_t producer = {0};
+    lock_counter_t consumer = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    conf.producer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &producer};
+    conf.consumer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &consumer};
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // A commit before any reservation releases nothing
+    result = RING_BUFFER_CommitWrite(&rb, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_CommitWrite(%p, 0) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+
+    // A reservation failing on a full buffer gave its lock back already, the commit after it must not unlock again
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, %p, 2, ...) -> Expected %d, but got %d.",
+                  &rb, data, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_ReserveWrite(&rb, 1, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_ReserveWrite(%p, 1, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+    result = RING_BUFFER_CommitWrite(&rb, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_CommitWrite(%p, 0) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+
+    // A second commit of the same reservation publishes nothing and releases nothing
+    result = RING_BUFFER_Retrieve(&rb, &data[0]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb,
+                  &data[0], RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_ReserveWrite(&rb, 1, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ReserveWrite(%p, 1, ...) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, producer.held, "Expected %d, but got %d.", 1, producer.held);
+    *(uint8_t *)seg1 = 0x33;
+    result = RING_BUFFER_CommitWrite(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_CommitWrite(%p, 1) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+    result = RING_BUFFER_CommitWrite(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_CommitWrite(%p, 1) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+    ASSERT_EQ_MSG(2, rb.count, "Expected %d, but got %zu.", 2, rb.count);
+    ASSERT_EQ_MSG(1, producer.max_held, "Expected %d, but got %d.", 1, producer.max_held);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_lock_consume_error_unlocks(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    uint8_t data = 0x11;
+    const void *seg1, *seg2;
+    size_t len1, len2;
+    lock_counter_t producer = {0};
+    lock_counter_t consumer = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    conf.producer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &producer};
+    conf.consumer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &consumer};
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_PeekSpans(&rb, 4, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekSpans(%p, 4, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, consumer.held, "Expected %d, but got %d.", 1, consumer.held);
+
+    result = RING_BUFFER_Consume(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "RING_BUFFER_Consume(%p, 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+
+    // The element is still stored and both sides keep working without taking a lock twice
+    data = 0x22;
+    result = RING_BUFFER_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, %p) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Retrieve(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Retrieve(%p, %p) -> Expected %d, but got %d.", &rb,
+                  &data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0x11, data, "Expected %u, but got %u.", 0x11, data);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+    ASSERT_EQ_MSG(1, consumer.max_held, "Expected %d, but got %d.", 1, consumer.max_held);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_lock_consume_without_peek(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    uint8_t data[3] = {0x11, 0x22, 0x33};
+    const void *seg1, *seg2;
+    size_t len1, len2;
+    size_t count = 0;
+    lock_counter_t producer = {0};
+    lock_counter_t consumer = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    conf.producer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &producer};
+    conf.consumer_lock = (ring_buffer_lock_t){.lock = _counter_lock, .unlock = _counter_unlock, .ctx = &consumer};
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // A peek of an empty buffer gave its lock back already, the consume after it must not unlock again
+    result = RING_BUFFER_PeekSpans(&rb, 4, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_PeekSpans(%p, 4, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_Consume(&rb, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "RING_BUFFER_Consume(%p, 0) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+
+    // Stored but not peeked elements cannot be consumed
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, %p, 3, ...) -> Expected %d, but got %d.",
+                  &rb, data, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_PeekSpans(&rb, 2, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekSpans(%p, 2, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Consume(&rb, 3);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "RING_BUFFER_Consume(%p, 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+    ASSERT_EQ_MSG(3, rb.count, "Expected %d, but got %zu.", 3, rb.count);
+
+    // A second consume of the same peek releases nothing
+    result = RING_BUFFER_PeekSpans(&rb, 2, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekSpans(%p, 2, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Consume(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Consume(%p, 2) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Consume(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "RING_BUFFER_Consume(%p, 1) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, consumer.held, "Expected %d, but got %d.", 0, consumer.held);
+    ASSERT_EQ_MSG(1, rb.count, "Expected %d, but got %zu.", 1, rb.count);
+    ASSERT_EQ_MSG(1, consumer.max_held, "Expected %d, but got %d.", 1, consumer.max_held);
+    ASSERT_EQ_MSG(0, producer.held, "Expected %d, but got %d.", 0, producer.held);
+
+    return failed_assertions;
+}
+
+static void *_lock_producer(void *arg)
+{
+    ring_buffer_t *rb = (ring_buffer_t *)arg;
+
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        while (RING_BUFFER_STATUS_OK != RING_BUFFER_Insert(rb, &i))
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static int32_t test_ring_buffer_lock_pthread_transfer(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[16];
+    uint32_t data = 0;
+    uint32_t expected = 0;
+    pthread_mutex_t producer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t producer;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = 4};
+
+    result = RING_BUFFER_LOCK_Pthread(&conf.producer_lock, &producer_mutex);
+    result = RING_BUFFER_LOCK_Pthread(&conf.consumer_lock, &consumer_mutex);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_LOCK_Pthread(%p, %p) -> Expected %d, but got %d.",
+                  &conf.consumer_lock, &consumer_mutex, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Init(&rb, conf);
+
+    pthread_create(&producer, NULL, _lock_producer, &rb);
+
+    while (expected < 10000)
+    {
+        if (RING_BUFFER_STATUS_OK == RING_BUFFER_Retrieve(&rb, &data))
+        {
+            ASSERT_EQ_MSG(expected, data, "Expected %u, but got %u.", expected, data);
+            expected++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    pthread_join(producer, NULL);
+
+    result = RING_BUFFER_IsEmpty(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_IsEmpty(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static void *_wait_late_producer(void *arg)
+{
+    ring_buffer_t *rb = (ring_buffer_t *)arg;
+    struct timespec delay = {.tv_sec = 0, .tv_nsec = 20 * 1000000L};
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        nanosleep(&delay, NULL);
+        RING_BUFFER_Insert(rb, &i);
+    }
+
+    return NULL;
+}
+
+static int32_t test_ring_buffer_wait_timeout(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[2];
+    uint8_t data = 0x11;
+    size_t read = 0;
+    struct timespec start, end;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    result = RING_BUFFER_Init(&rb, conf);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    result = RING_BUFFER_RetrieveWait(&rb, &data, 20);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_RetrieveWait(%p, %p, 20) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    long elapsed_ms = (long)(end.tv_sec - start.tv_sec) * 1000L + (end.tv_nsec - start.tv_nsec) / 1000000L;
+    ASSERT_EQ_MSG(true, elapsed_ms >= 19, "Expected at least %d ms, but got %ld ms.", 19, elapsed_ms);
+
+    result = RING_BUFFER_RetrieveManyWait(&rb, &data, 1, &read, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_RetrieveManyWait(%p, %p, 1, %p, 0) -> Expected %d, but got %d.", &rb, &data, &read,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    result = RING_BUFFER_InsertWait(&rb, &data, 0);
+    result = RING_BUFFER_InsertWait(&rb, &data, 0);
+    result = RING_BUFFER_InsertWait(&rb, &data, 5);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_InsertWait(%p, %p, 5) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    result = RING_BUFFER_RetrieveWait(&rb, &data, 5);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveWait(%p, %p, 5) -> Expected %d, but got %d.", &rb,
+                  &data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0x11, data, "Expected %d, but got %d.", 0x11, data);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_wait_forever_without_hooks(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[1];
+    uint8_t data = 0x11;
+    size_t read = 1;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, conf) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Nothing could wake a parked thread, the waits are rejected instead of sleeping forever
+    result = RING_BUFFER_RetrieveWait(&rb, &data, RING_BUFFER_WAIT_FOREVER);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_RetrieveWait(%p, %p, %u) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_WAIT_FOREVER, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_RetrieveManyWait(&rb, &data, 1, &read, RING_BUFFER_WAIT_FOREVER);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_RetrieveManyWait(%p, %p, 1, %p, %u) -> Expected %d, but got %d.", &rb, &data, &read,
+                  RING_BUFFER_WAIT_FOREVER, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    ASSERT_EQ_MSG(0, read, "Expected %d, but got %zu.", 0, read);
+
+    result = RING_BUFFER_InsertWait(&rb, &data, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertWait(%p, %p, 0) -> Expected %d, but got %d.", &rb,
+                  &data, RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_InsertWait(&rb, &data, RING_BUFFER_WAIT_FOREVER);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_InsertWait(%p, %p, %u) -> Expected %d, but got %d.", &rb, &data,
+                  RING_BUFFER_WAIT_FOREVER, RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_wait_woken_by_insert(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[4];
+    uint32_t data = 0;
+    uint32_t batch[4] = {0};
+    size_t read = 0;
+    pthread_mutex_t producer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t producer;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = 4};
+
+    RING_BUFFER_LOCK_Pthread(&conf.producer_lock, &producer_mutex);
+    RING_BUFFER_LOCK_Pthread(&conf.consumer_lock, &consumer_mutex);
+    result = RING_BUFFER_Init(&rb, conf);
+
+    // Parked consumer is woken by a plain insert from another thread
+    pthread_create(&producer, NULL, _wait_late_producer, &rb);
+
+    result = RING_BUFFER_RetrieveWait(&rb, &data, RING_BUFFER_WAIT_FOREVER);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveWait(%p, %p, %u) -> Expected %d, but got %d.",
+                  &rb, &data, RING_BUFFER_WAIT_FOREVER, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, data, "Expected %u, but got %u.", 0, data);
+
+    // Batch collects the two remaining elements as they arrive and returns early once it has them
+    result = RING_BUFFER_RetrieveManyWait(&rb, batch, 2, &read, 5000);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveManyWait(%p, %p, 2, %p, 5000) -> Expected %d, but got %d.", &rb, batch, &read,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, read, "Expected %d, but got %zu.", 2, read);
+    ASSERT_EQ_MSG(1, batch[0], "Expected %u, but got %u.", 1, batch[0]);
+    ASSERT_EQ_MSG(2, batch[1], "Expected %u, but got %u.", 2, batch[1]);
+
+    pthread_join(producer, NULL);
+
+    // Nothing more arrives, the batch returns what it has by the deadline
+    data = 7;
+    result = RING_BUFFER_Insert(&rb, &data);
+    result = RING_BUFFER_RetrieveManyWait(&rb, batch, 4, &read, 10);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveManyWait(%p, %p, 4, %p, 10) -> Expected %d, but got %d.", &rb, batch, &read,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, read, "Expected %d, but got %zu.", 1, read);
+    ASSERT_EQ_MSG(0, rb.data_waiters, "Expected %d, but got %u.", 0, rb.data_waiters);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_wait_strategies(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[4];
+    uint32_t data = 0;
+    pthread_mutex_t producer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t producer;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = 4};
+
+    RING_BUFFER_LOCK_Pthread(&conf.producer_lock, &producer_mutex);
+    RING_BUFFER_LOCK_Pthread(&conf.consumer_lock, &consumer_mutex);
+
+    for (ring_buffer_wait_e strategy = RING_BUFFER_WAIT_PARK; strategy < RING_BUFFER_WAIT_MAX; strategy++)
+    {
+        conf.wait.strategy = strategy;
+        conf.wait.spin = (RING_BUFFER_WAIT_SPIN_PARK == strategy) ? 64 : 0;
+        result = RING_BUFFER_Init(&rb, conf);
+
+        result = RING_BUFFER_RetrieveWait(&rb, &data, 5);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                      "RING_BUFFER_RetrieveWait(%p, %p, 5) -> Expected %d, but got %d (strategy %d).", &rb, &data,
+                      RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, strategy);
+
+        pthread_create(&producer, NULL, _wait_late_producer, &rb);
+
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            result = RING_BUFFER_RetrieveWait(&rb, &data, RING_BUFFER_WAIT_FOREVER);
+            ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                          "RING_BUFFER_RetrieveWait(%p, %p, %u) -> Expected %d, but got %d (strategy %d).", &rb, &data,
+                          RING_BUFFER_WAIT_FOREVER, RING_BUFFER_STATUS_OK, result, strategy);
+            ASSERT_EQ_MSG(i, data, "Expected %u, but got %u (strategy %d).", i, data, strategy);
+        }
+
+        pthread_join(producer, NULL);
+        RING_BUFFER_DeInit(&rb);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_notify_edges(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[4];
+    uint8_t data[4] = {1, 2, 3, 4};
+    uint64_t value = 0;
+    size_t written = 0;
+    int data_fd = -1;
+    int space_fd = -1;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 1};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    result = RING_BUFFER_GetNotifyFd(&rb, RING_BUFFER_NOTIFY_DATA, &data_fd);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result, "Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result);
+
+    result = RING_BUFFER_NotifyInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_NotifyInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_GetNotifyFd(&rb, RING_BUFFER_NOTIFY_DATA, &data_fd);
+    result = RING_BUFFER_GetNotifyFd(&rb, RING_BUFFER_NOTIFY_SPACE, &space_fd);
+    ASSERT_EQ_MSG(true, data_fd >= 0, "Expected a valid fd, but got %d.", data_fd);
+
+    // Empty buffer starts writable but not readable
+    ASSERT_EQ_MSG(-1, (int)read(data_fd, &value, sizeof(value)), "Expected %d for an empty buffer.", -1);
+    ASSERT_EQ_MSG(8, (int)read(space_fd, &value, sizeof(value)), "Expected %d for a buffer with space.", 8);
+
+    // A burst of inserts signals the empty to non-empty edge with one write only
+    for (size_t i = 0; i < 3; i++)
+    {
+        result = RING_BUFFER_Insert(&rb, &data[i]);
+    }
+    ASSERT_EQ_MSG(8, (int)read(data_fd, &value, sizeof(value)), "Expected %d after the first insert.", 8);
+    ASSERT_EQ_MSG(1, value, "Expected %d write, but got %llu.", 1, (unsigned long long)value);
+
+    // Emptying and refilling before the ack stays quiet (edges coalesce until then)
+    result = RING_BUFFER_RetrieveMany(&rb, data, 3, &written);
+    result = RING_BUFFER_Insert(&rb, &data[0]);
+    ASSERT_EQ_MSG(-1, (int)read(data_fd, &value, sizeof(value)), "Expected %d before the ack.", -1);
+
+    // After the ack the next edge signals again, inserts into a non-empty buffer do not
+    result = RING_BUFFER_NotifyAck(&rb, RING_BUFFER_NOTIFY_DATA);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_NotifyAck(%p, DATA) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Insert(&rb, &data[1]);
+    ASSERT_EQ_MSG(-1, (int)read(data_fd, &value, sizeof(value)), "Expected %d for a non-empty buffer.", -1);
+    result = RING_BUFFER_RetrieveMany(&rb, data, 2, &written);
+    result = RING_BUFFER_Insert(&rb, &data[0]);
+    ASSERT_EQ_MSG(8, (int)read(data_fd, &value, sizeof(value)), "Expected %d after the edge.", 8);
+
+    // Full to not full edge signals the space notifier once it is re-armed
+    result = RING_BUFFER_NotifyAck(&rb, RING_BUFFER_NOTIFY_SPACE);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(-1, (int)read(space_fd, &value, sizeof(value)), "Expected %d while filling.", -1);
+    result = RING_BUFFER_Retrieve(&rb, &data[0]);
+    ASSERT_EQ_MSG(8, (int)read(space_fd, &value, sizeof(value)), "Expected %d after the full edge.", 8);
+
+    result = RING_BUFFER_NotifyAck(&rb, RING_BUFFER_NOTIFY_MAX);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // DeInit closes the notifiers
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(-1, fcntl(data_fd, F_GETFD), "Expected fd %d to be closed.", data_fd);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_notify_epoll(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[4];
+    uint32_t data = 0;
+    uint32_t received = 0;
+    int fd = -1;
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    struct epoll_event event = {.events = EPOLLIN};
+    pthread_mutex_t producer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t producer;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = 4};
+
+    RING_BUFFER_LOCK_Pthread(&conf.producer_lock, &producer_mutex);
+    RING_BUFFER_LOCK_Pthread(&conf.consumer_lock, &consumer_mutex);
+
+    result = RING_BUFFER_Init(&rb, conf);
+    result = RING_BUFFER_NotifyInit(&rb);
+    result = RING_BUFFER_GetNotifyFd(&rb, RING_BUFFER_NOTIFY_DATA, &fd);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetNotifyFd(%p, DATA, %p) -> Expected %d, but got %d.",
+                  &rb, &fd, RING_BUFFER_STATUS_OK, result);
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+
+    // Event loop sleeps in epoll_wait, acks and drains on every readiness until all elements arrived
+    pthread_create(&producer, NULL, _wait_late_producer, &rb);
+
+    while (received < 3)
+    {
+        if (1 != epoll_wait(epoll_fd, &event, 1, 5000))
+        {
+            break;
+        }
+
+        result = RING_BUFFER_NotifyAck(&rb, RING_BUFFER_NOTIFY_DATA);
+
+        while (RING_BUFFER_STATUS_OK == RING_BUFFER_Retrieve(&rb, &data))
+        {
+            ASSERT_EQ_MSG(received, data, "Expected %u, but got %u.", received, data);
+            received++;
+        }
+    }
+
+    ASSERT_EQ_MSG(3, received, "Expected %d elements through epoll, but got %u.", 3, received);
+
+    pthread_join(producer, NULL);
+    RING_BUFFER_DeInit(&rb);
+    close(epoll_fd);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mirrored_alloc(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    ring_buffer_conf_t conf = {.element_size = 3};
+
+    result = RING_BUFFER_MirrorAlloc(&conf, 100);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorAlloc(%p, 100) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, conf.mirrored, "Expected a mirrored configuration.");
+    ASSERT_EQ_MSG(0, conf.buffer_size % (size_t)sysconf(_SC_PAGESIZE), "Expected whole pages, but got %zu bytes.",
+                  conf.buffer_size);
+
+    // Both halves are the same memory
+    conf.buffer[0] = 0x5A;
+    ASSERT_EQ_MSG(0x5A, conf.buffer[conf.buffer_size], "Expected %d in the mirror, but got %u.", 0x5A,
+                  conf.buffer[conf.buffer_size]);
+    conf.buffer[2 * conf.buffer_size - 1] = 0xA5;
+    ASSERT_EQ_MSG(0xA5, conf.buffer[conf.buffer_size - 1], "Expected %d in the buffer, but got %u.", 0xA5,
+                  conf.buffer[conf.buffer_size - 1]);
+
+    result = RING_BUFFER_MirrorFree(&conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorFree(%p) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (NULL == conf.buffer) && (0 == conf.buffer_size) && (false == conf.mirrored),
+                  "Expected a cleared configuration.");
+
+    // Nothing left to unmap
+    result = RING_BUFFER_MirrorFree(&conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result,
+                  "RING_BUFFER_MirrorFree(%p) twice -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result);
+
+    result = RING_BUFFER_MirrorAlloc(NULL, 100);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MirrorAlloc(NULL, 100) -> Expected %d, but got %d.", RING_BUFFER_STATUS_ERROR_INPUT_ARGS,
+                  result);
+    result = RING_BUFFER_MirrorAlloc(&conf, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MirrorAlloc(%p, 0) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mirrored_alloc_limit(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    ring_buffer_conf_t confs[RING_BUFFER_CONF_MIRROR_MAX + 1] = {0};
+
+    for (size_t i = 0; i < RING_BUFFER_CONF_MIRROR_MAX; i++)
+    {
+        result = RING_BUFFER_MirrorAlloc(&confs[i], 1);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorAlloc(%zu) -> Expected %d, but got %d.", i,
+                      RING_BUFFER_STATUS_OK, result);
+    }
+
+    // Every tracked entry is taken
+    result = RING_BUFFER_MirrorAlloc(&confs[RING_BUFFER_CONF_MIRROR_MAX], 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "RING_BUFFER_MirrorAlloc(full) -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    ASSERT_EQ_MSG(true, (NULL == confs[RING_BUFFER_CONF_MIRROR_MAX].buffer) &&
+                            (false == confs[RING_BUFFER_CONF_MIRROR_MAX].mirrored),
+                  "Expected the configuration untouched.");
+
+    // Freeing one makes room again
+    result = RING_BUFFER_MirrorFree(&confs[0]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorFree(0) -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_MirrorAlloc(&confs[RING_BUFFER_CONF_MIRROR_MAX], 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorAlloc(freed) -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_OK, result);
+
+    for (size_t i = 1; i <= RING_BUFFER_CONF_MIRROR_MAX; i++)
+    {
+        result = RING_BUFFER_MirrorFree(&confs[i]);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorFree(%zu) -> Expected %d, but got %d.", i,
+                      RING_BUFFER_STATUS_OK, result);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mirrored_flag_by_hand(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[30];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3, .mirrored = true};
+    ring_buffer_conf_t mirror = {.element_size = 3};
+
+    // A plain array has no second view past its end
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Init(%p, mirrored by hand) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_MirrorFree(&conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MirrorFree(%p, mirrored by hand) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // A real mapping does not vouch for another buffer or size
+    result = RING_BUFFER_MirrorAlloc(&mirror, 100);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorAlloc(%p, 100) -> Expected %d, but got %d.",
+                  &mirror, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, 100 < mirror.buffer_size, "Expected the size rounded up to a page, but got %zu bytes.",
+                  mirror.buffer_size);
+    conf.buffer_size = mirror.buffer_size;
+    conf.buffer = mirror.buffer + 3;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Init(%p, shifted buffer) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    conf = mirror;
+    conf.buffer_size *= 2;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Init(%p, grown buffer) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Without the flag the same memory is an ordinary buffer
+    conf = (ring_buffer_conf_t){.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3};
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, plain) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // A copy of the configuration outlives the mapping, but not its tracking
+    conf = mirror;
+    result = RING_BUFFER_MirrorFree(&mirror);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorFree(%p) -> Expected %d, but got %d.", &mirror,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Init(%p, freed mapping) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_MirrorFree(&conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MirrorFree(%p, freed mapping) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mirrored_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t element[3];
+    uint8_t out[3];
+    const void *seg1, *seg2;
+    void *wseg1, *wseg2;
+    size_t len1, len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.element_size = 3};
+
+    result = RING_BUFFER_MirrorAlloc(&conf, 100);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorAlloc(%p, 100) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, mirrored) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        RING_BUFFER_MirrorFree(&conf);
+        return failed_assertions;
+    }
+
+    // Walk the 3-byte elements around the page sized buffer a few times, so they straddle the wrap point
+    for (size_t i = 0; i < 3 * conf.buffer_size; i++)
+    {
+        element[0] = (uint8_t)i;
+        element[1] = (uint8_t)(i >> 8);
+        element[2] = 0xC3;
+        result = RING_BUFFER_Insert(&rb, element);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Insert -> Expected %d, but got %d at %zu.", RING_BUFFER_STATUS_OK,
+                      result, i);
+
+        // Elements are exposed in one piece, also across the wrap point
+        result = RING_BUFFER_PeekSpans(&rb, 1, &seg1, &len1, &seg2, &len2);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "PeekSpans -> Expected %d, but got %d at %zu.",
+                      RING_BUFFER_STATUS_OK, result, i);
+        ASSERT_EQ_MSG(true, (3 == len1) && (NULL == seg2), "Expected one span at %zu, but got %zu + %zu.", i, len1,
+                      len2);
+        ASSERT_EQ_MSG(0, memcmp(seg1, element, sizeof(element)), "Expected the element in place at %zu.", i);
+        result = RING_BUFFER_Consume(&rb, 0);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Consume -> Expected %d, but got %d at %zu.",
+                      RING_BUFFER_STATUS_OK, result, i);
+
+        result = RING_BUFFER_Retrieve(&rb, out);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Retrieve -> Expected %d, but got %d at %zu.",
+                      RING_BUFFER_STATUS_OK, result, i);
+        ASSERT_EQ_MSG(0, memcmp(out, element, sizeof(element)), "Expected the element back at %zu.", i);
+
+        // Reservations are contiguous too
+        result = RING_BUFFER_ReserveWrite(&rb, 2, &wseg1, &len1, &wseg2, &len2);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "ReserveWrite -> Expected %d, but got %d at %zu.",
+                      RING_BUFFER_STATUS_OK, result, i);
+        ASSERT_EQ_MSG(true, (6 == len1) && (NULL == wseg2), "Expected one region at %zu, but got %zu + %zu.", i, len1,
+                      len2);
+        result = RING_BUFFER_CommitWrite(&rb, 0);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "CommitWrite -> Expected %d, but got %d at %zu.",
+                      RING_BUFFER_STATUS_OK, result, i);
+    }
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_MirrorFree(&conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorFree(%p) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_mirrored_full_empty(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t element[3] = {1, 2, 3};
+    const void *seg1, *seg2;
+    void *wseg1, *wseg2;
+    size_t len1, len2;
+    size_t count = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.element_size = 3};
+
+    result = RING_BUFFER_MirrorAlloc(&conf, 100);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorAlloc(%p, 100) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, mirrored) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        RING_BUFFER_MirrorFree(&conf);
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_PeekSpans(&rb, 1, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "PeekSpans on empty -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_Retrieve(&rb, element);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Retrieve on empty -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // Move the head off the start so the full run of elements wraps
+    result = RING_BUFFER_Insert(&rb, element);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Insert -> Expected %d, but got %d.", RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Retrieve(&rb, element);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Retrieve -> Expected %d, but got %d.", RING_BUFFER_STATUS_OK, result);
+
+    for (count = 0; count < conf.buffer_size / 3; count++)
+    {
+        result = RING_BUFFER_Insert(&rb, element);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Insert -> Expected %d, but got %d at %zu.", RING_BUFFER_STATUS_OK,
+                      result, count);
+    }
+
+    result = RING_BUFFER_Insert(&rb, element);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result, "Insert on full -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    result = RING_BUFFER_ReserveWrite(&rb, 1, &wseg1, &len1, &wseg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result, "ReserveWrite on full -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    // All stored elements in one span, across the wrap point
+    result = RING_BUFFER_PeekSpans(&rb, SIZE_MAX, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "PeekSpans on full -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (3 * (conf.buffer_size / 3) == len1) && (NULL == seg2),
+                  "Expected one span of %zu bytes, but got %zu + %zu.", 3 * (conf.buffer_size / 3), len1, len2);
+    result = RING_BUFFER_Consume(&rb, conf.buffer_size / 3);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Consume -> Expected %d, but got %d.", RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_PeekSpans(&rb, 1, &seg1, &len1, &seg2, &len2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "PeekSpans after consume -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_MirrorFree(&conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MirrorFree(%p) -> Expected %d, but got %d.", &conf,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_records_lengths(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[32];
+    char out[32];
+    size_t len = 0;
+    size_t free_bytes = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .overwrite = false, .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Records of different lengths come back as inserted, each taking its header and payload only
+    result = RING_BUFFER_InsertRecord(&rb, "hello", 5);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 5) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, "", 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 0) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, "log line", 8);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 8) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_GetFreeElements(&rb, &free_bytes);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(32 - 3 * RING_BUFFER_RECORD_HEADER_SIZE - 13, free_bytes, "Expected %zu free bytes, but got %zu.",
+                  32 - 3 * RING_BUFFER_RECORD_HEADER_SIZE - 13, free_bytes);
+
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (5 == len) && (0 == memcmp(out, "hello", 5)), "Expected \"hello\", but got %zu bytes.", len);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, len, "Expected an empty record, but got %zu bytes.", len);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (8 == len) && (0 == memcmp(out, "log line", 8)), "Expected \"log line\", but got %zu bytes.",
+                  len);
+
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Retrieve from empty -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_GetFreeElements(&rb, &free_bytes);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(32, free_bytes, "Expected %d free bytes, but got %zu.", 32, free_bytes);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_records_retrieve_overflow(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[32];
+    char out[32];
+    size_t len = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .overwrite = false, .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_InsertRecord(&rb, "hello", 5);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 5) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    // A too small output reports the length and keeps the record
+    result = RING_BUFFER_RetrieveRecord(&rb, out, 4, &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_OVERFLOW, result, "Expected %d for a small buffer, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_OVERFLOW, result);
+    ASSERT_EQ_MSG(5, len, "Expected length %d, but got %zu.", 5, len);
+
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (5 == len) && (0 == memcmp(out, "hello", 5)), "Expected \"hello\", but got %zu bytes.", len);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_records_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[32];
+    char out[32];
+    size_t len = 0;
+    size_t free_bytes = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .overwrite = false, .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Bytes 0..27 are used, the third record does not fit the 4 byte end and is stored at the start
+    result = RING_BUFFER_InsertRecord(&rb, "abcdefghij", 10);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 10) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, "0123456789", 10);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 10) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (10 == len) && (0 == memcmp(out, "abcdefghij", 10)),
+                  "Expected \"abcdefghij\", but got %zu bytes.", len);
+    result = RING_BUFFER_InsertRecord(&rb, "klmno", 5);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 5) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    // The skipped end counts as used
+    result = RING_BUFFER_GetFreeElements(&rb, &free_bytes);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(5, free_bytes, "Expected %d free bytes, but got %zu.", 5, free_bytes);
+
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (10 == len) && (0 == memcmp(out, "0123456789", 10)),
+                  "Expected \"0123456789\", but got %zu bytes.", len);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (5 == len) && (0 == memcmp(out, "klmno", 5)), "Expected \"klmno\", but got %zu bytes.", len);
+
+    // An empty buffer starts over instead of skipping or splitting
+    result = RING_BUFFER_InsertRecord(&rb, "0123456789abcdefghij", 20);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 20) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (20 == len) && (0 == memcmp(out, "0123456789abcdefghij", 20)),
+                  "Expected \"0123456789abcdefghij\", but got %zu bytes.", len);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_records_full(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    const char *chars = "0123456789abcdefghijklmnopqrstuv";
+    uint8_t buffer[32];
+    char out[32];
+    size_t len = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .overwrite = false, .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Oversized records never fit, a full buffer rejects the record without evicting
+    result = RING_BUFFER_InsertRecord(&rb, chars, 32);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_OVERFLOW, result,
+                  "RING_BUFFER_InsertRecord(%p, ..., 32) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_OVERFLOW, result);
+    result = RING_BUFFER_InsertRecord(&rb, chars, 29);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_OVERFLOW, result,
+                  "RING_BUFFER_InsertRecord(%p, ..., 29) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_OVERFLOW, result);
+    result = RING_BUFFER_InsertRecord(&rb, chars, 20);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 20) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, "klmnopqrst", 10);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_InsertRecord(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    result = RING_BUFFER_InsertRecord(&rb, "klmn", 4);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, "", 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_InsertRecord(%p, ..., 0) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (20 == len) && (0 == memcmp(out, chars, 20)),
+                  "Expected the first 20 characters, but got %zu bytes.", len);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (4 == len) && (0 == memcmp(out, "klmn", 4)), "Expected \"klmn\", but got %zu bytes.", len);
+
+    // The largest record fits an empty buffer exactly
+    result = RING_BUFFER_InsertRecord(&rb, chars, 28);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 28) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (28 == len) && (0 == memcmp(out, chars, 28)),
+                  "Expected the first 28 characters, but got %zu bytes.", len);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_records_overwrite(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    const char *chars = "0123456789abcdefghijklmnopqrstuv";
+    uint8_t buffer[32];
+    char out[32];
+    size_t len = 0;
+    char last = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .overwrite = true, .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Overwrite mode evicts whole oldest records until the new one fits
+    for (char c = 'a'; c <= 'h'; c++)
+    {
+        char record[3] = {c, c, c};
+        result = RING_BUFFER_InsertRecord(&rb, record, (size_t)(c - 'a') % 4);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, '%c') -> Expected %d, but got %d.",
+                      &rb, c, RING_BUFFER_STATUS_OK, result);
+    }
+
+    result = RING_BUFFER_InsertRecord(&rb, "overwrite-wins", 14);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 14) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    // Remaining records are whole and in order, the newest one last
+    while (RING_BUFFER_STATUS_OK == (result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len)))
+    {
+        if (14 == len)
+        {
+            ASSERT_EQ_MSG(0, memcmp(out, "overwrite-wins", 14), "Expected the newest record.");
+            break;
+        }
+
+        for (size_t i = 0; i < len; i++)
+        {
+            ASSERT_EQ_MSG(out[0], out[i], "Expected a whole record of '%c'.", out[0]);
+        }
+
+        ASSERT_EQ_MSG(true, (0 == len) || (out[0] > last), "Expected records in order, got '%c' after '%c'.", out[0],
+                      last);
+        last = (0 == len) ? last : out[0];
+    }
+
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(14, len, "Expected the newest record last, but got %zu bytes.", len);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Retrieve from empty -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // Larger than the whole buffer is still rejected, nothing is evicted for it
+    result = RING_BUFFER_InsertRecord(&rb, "abc", 3);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, chars, 29);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_OVERFLOW, result,
+                  "RING_BUFFER_InsertRecord(%p, ..., 29) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_OVERFLOW, result);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (3 == len) && (0 == memcmp(out, "abc", 3)), "Expected \"abc\", but got %zu bytes.", len);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_records_element_mode(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[32];
+    char out[32];
+    size_t len = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 4};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Record functions need record mode
+    result = RING_BUFFER_InsertRecord(&rb, "abcd", 4);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_InsertRecord(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_records_reject_element_functions(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e results[15];
+    ring_buffer_status_e result;
+    uint8_t buffer[16];
+    uint8_t data[4] = {0xEE, 0xEE, 0xEE, 0xEE};
+    char out[16];
+    size_t count = 0;
+    size_t len = 0;
+    void *wseg1, *wseg2;
+    const void *rseg1, *rseg2;
+    size_t len1, len2;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .overwrite = true, .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Fills the buffer, so an overwriting Insert would have to evict
+    result = RING_BUFFER_InsertRecord(&rb, "0123456789ab", 12);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 12) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    // Every function working on single elements (single bytes in record mode) is rejected
+    results[0] = RING_BUFFER_Insert(&rb, data);
+    results[1] = RING_BUFFER_Retrieve(&rb, data);
+    results[2] = RING_BUFFER_InsertMany(&rb, data, 4, &count);
+    results[3] = RING_BUFFER_RetrieveMany(&rb, data, 4, &count);
+    results[4] = RING_BUFFER_InsertWait(&rb, data, 0);
+    results[5] = RING_BUFFER_RetrieveWait(&rb, data, 0);
+    results[6] = RING_BUFFER_RetrieveManyWait(&rb, data, 4, &count, 0);
+    results[7] = RING_BUFFER_ReserveWrite(&rb, 4, &wseg1, &len1, &wseg2, &len2);
+    results[8] = RING_BUFFER_CommitWrite(&rb, 0);
+    results[9] = RING_BUFFER_PeekSpans(&rb, 4, &rseg1, &len1, &rseg2, &len2);
+    results[10] = RING_BUFFER_Consume(&rb, 0);
+    results[11] = RING_BUFFER_Peek(&rb, 0, data);
+    results[12] = RING_BUFFER_Replace(&rb, 0, data);
+    results[13] = RING_BUFFER_PeekRange(&rb, 0, 4, data);
+    results[14] = RING_BUFFER_ReplaceRange(&rb, 0, 4, data);
+
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++)
+    {
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, results[i], "Call %zu -> Expected %d, but got %d.", i,
+                      RING_BUFFER_STATUS_ERROR_INPUT_ARGS, results[i]);
+    }
+
+    ASSERT_EQ_MSG(0, count, "Expected %d, but got %zu.", 0, count);
+    ASSERT_EQ_MSG(true, (NULL == wseg1) && (NULL == rseg1), "Expected no regions to be exposed.");
+
+    // The record stream is untouched
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveRecord(%p, ...) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (12 == len) && (0 == memcmp(out, "0123456789ab", 12)), "Expected the record, but got %zu.",
+                  len);
+
+    result = RING_BUFFER_IsEmpty(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_IsEmpty(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_shm_create_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    ring_buffer_shm_t rb;
+
+    result = RING_BUFFER_SHM_Create(&rb, NULL, 0, 16);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_SHM_Create(%p, NULL, 0, 16) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_SHM_Create(&rb, NULL, sizeof(uint32_t), 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_SHM_Create(%p, NULL, 4, 0) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // The region size would wrap around
+    result = RING_BUFFER_SHM_Create(&rb, NULL, SIZE_MAX / 4, 8);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_SHM_Create(%p, NULL, SIZE_MAX / 4, 8) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_SHM_Create(&rb, NULL, 1, SIZE_MAX / 2 + 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_SHM_Create(%p, NULL, 1, SIZE_MAX / 2 + 1) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_shm_create_existing(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char name[64];
+    ring_buffer_shm_t rb;
+    ring_buffer_shm_t other;
+
+    snprintf(name, sizeof(name), "/ring_buffer_ctest_existing_%d", (int)getpid());
+
+    result = RING_BUFFER_SHM_Attach(&other, name);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Attach to a missing region -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+
+    result = RING_BUFFER_SHM_Create(&rb, name, sizeof(uint32_t), 16);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Create(%p, %s, 4, 16) -> Expected %d, but got %d.",
+                  &rb, name, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_SHM_Create(&other, name, sizeof(uint32_t), 16);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Creating an existing region -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+
+    result = RING_BUFFER_SHM_Unlink(name);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Unlink(%s) -> Expected %d, but got %d.", name,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_SHM_Unlink(name);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Unlinking a missing region -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    result = RING_BUFFER_SHM_Detach(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_shm_full_empty_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t data[6] = {0, 1, 2, 3, 4, 5};
+    uint32_t out[6] = {0};
+    size_t done = 0;
+    ring_buffer_shm_t rb;
+
+    result = RING_BUFFER_SHM_Create(&rb, NULL, sizeof(uint32_t), 4);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Create(%p, NULL, 4, 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_SHM_Retrieve(&rb, &out[0]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Retrieve from empty -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // Six elements into a four element ring are cut to four
+    result = RING_BUFFER_SHM_InsertMany(&rb, data, 6, &done);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_InsertMany(%p, ..., 6) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, done, "Expected %d written, but got %zu.", 4, done);
+    result = RING_BUFFER_SHM_Insert(&rb, &data[4]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result, "Insert into full -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    // Free three slots so the next batch wraps around the end of the storage
+    result = RING_BUFFER_SHM_RetrieveMany(&rb, out, 3, &done);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (3 == done) && (0 == out[0]) && (2 == out[2]), "Expected 0..2, but got %zu elements.", done);
+    result = RING_BUFFER_SHM_InsertMany(&rb, &data[4], 2, &done);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_InsertMany(%p, ..., 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, done, "Expected %d written, but got %zu.", 2, done);
+
+    result = RING_BUFFER_SHM_RetrieveMany(&rb, out, 6, &done);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_RetrieveMany(%p, ..., 6) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (3 == done) && (3 == out[0]) && (4 == out[1]) && (5 == out[2]),
+                  "Expected 3..5 across the wrap, but got %zu elements.", done);
+
+    result = RING_BUFFER_SHM_Detach(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_shm_processes(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char name[64];
+    uint32_t data = 0;
+    uint32_t expected = 0;
+    int status = -1;
+    ring_buffer_shm_t rb;
+
+    snprintf(name, sizeof(name), "/ring_buffer_ctest_%d", (int)getpid());
+
+    result = RING_BUFFER_SHM_Create(&rb, name, sizeof(uint32_t), 16);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Create(%p, %s, 4, 16) -> Expected %d, but got %d.",
+                  &rb, name, RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+
+    // Producer process attaches by name and streams values through the 16 element ring
+    pid_t child = fork();
+    if (0 == child)
+    {
+        ring_buffer_shm_t producer;
+
+        if (RING_BUFFER_STATUS_OK != RING_BUFFER_SHM_Attach(&producer, name))
+        {
+            _exit(1);
+        }
+
+        for (uint32_t i = 0; i < 1000; i++)
+        {
+            while (RING_BUFFER_STATUS_OK != RING_BUFFER_SHM_Insert(&producer, &i))
+            {
+                sched_yield();
+            }
+        }
+
+        RING_BUFFER_SHM_Detach(&producer);
+        _exit(0);
+    }
+
+    while ((expected < 1000) && (0 == failed_assertions))
+    {
+        if (RING_BUFFER_STATUS_OK == RING_BUFFER_SHM_Retrieve(&rb, &data))
+        {
+            ASSERT_EQ_MSG(expected, data, "Expected %u, but got %u.", expected, data);
+            expected = data + 1;
+        }
+        else if (0 != waitpid(child, &status, WNOHANG))
+        {
+            // Producer gave up before sending everything
+            ASSERT_EQ_MSG(1000, expected, "Expected %d values, but the producer exited after %u.", 1000, expected);
+            child = -1;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    if (child > 0)
+    {
+        waitpid(child, &status, 0);
+    }
+    ASSERT_EQ_MSG(0, status, "Expected the producer process to exit with %d, but got %d.", 0, status);
+
+    result = RING_BUFFER_SHM_Unlink(name);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Unlink(%s) -> Expected %d, but got %d.", name,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_SHM_Detach(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_shm_attach_fd(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t data = 42;
+    size_t count = 0;
+    ring_buffer_shm_t rb;
+    ring_buffer_shm_t other;
+
+    // A memfd region is shared through its descriptor, the second mapping sees the same ring at another address
+    result = RING_BUFFER_SHM_Create(&rb, NULL, sizeof(uint32_t), 4);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Create(%p, NULL, 4, 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_SHM_AttachFd(&other, rb.fd);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_AttachFd(%p, %d) -> Expected %d, but got %d.", &other,
+                  rb.fd, RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    ASSERT_EQ_MSG(true, (void *)rb.ctrl != (void *)other.ctrl, "Expected two mappings of the region.");
+
+    result = RING_BUFFER_SHM_Insert(&rb, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Insert(%p, 42) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_SHM_GetCount(&other, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_GetCount(%p) -> Expected %d, but got %d.", &other,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d element, but got %zu.", 1, count);
+    data = 0;
+    result = RING_BUFFER_SHM_Retrieve(&other, &data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Retrieve(%p) -> Expected %d, but got %d.", &other,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(42, data, "Expected %d, but got %u.", 42, data);
+
+    result = RING_BUFFER_SHM_Detach(&other);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &other,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_SHM_Detach(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_shm_attach_corrupt_layout(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    ring_buffer_shm_t rb;
+    ring_buffer_shm_t other;
+
+    result = RING_BUFFER_SHM_Create(&rb, NULL, sizeof(uint32_t), 4);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Create(%p, NULL, 4, 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+
+    ring_buffer_shm_ctrl_t saved = {0};
+    saved.element_size = rb.ctrl->element_size;
+    saved.max_elements = rb.ctrl->max_elements;
+    saved.limit = rb.ctrl->limit;
+    saved.data_offset = rb.ctrl->data_offset;
+
+    // Each field a peer could corrupt is rejected on its own
+    for (int32_t field = 0; field < 5; field++)
+    {
+        rb.ctrl->element_size = saved.element_size;
+        rb.ctrl->max_elements = saved.max_elements;
+        rb.ctrl->limit = saved.limit;
+        rb.ctrl->data_offset = saved.data_offset;
+
+        switch (field)
+        {
+            case 0:
+                rb.ctrl->max_elements = 0;
+                break;
+            case 1:
+                rb.ctrl->limit = saved.max_elements;
+                break;
+            case 2:
+                rb.ctrl->data_offset = 0;
+                break;
+            case 3:
+                // element_size * max_elements wraps around to a value inside the region
+                rb.ctrl->element_size = SIZE_MAX / saved.max_elements + 1;
+                break;
+            default:
+                rb.ctrl->element_size = 0;
+                break;
+        }
+
+        result = RING_BUFFER_SHM_AttachFd(&other, rb.fd);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Attach to corrupt field %d -> Expected %d, but got %d.", field,
+                      RING_BUFFER_STATUS_ERROR, result);
+        if (RING_BUFFER_STATUS_OK == result)
+        {
+            RING_BUFFER_SHM_Detach(&other);
+        }
+    }
+
+    rb.ctrl->element_size = saved.element_size;
+    rb.ctrl->max_elements = saved.max_elements;
+    rb.ctrl->limit = saved.limit;
+    rb.ctrl->data_offset = saved.data_offset;
+
+    result = RING_BUFFER_SHM_AttachFd(&other, rb.fd);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Attach to the restored block -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK == result)
+    {
+        RING_BUFFER_SHM_Detach(&other);
+    }
+
+    result = RING_BUFFER_SHM_Detach(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_shm_corrupt_positions(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t data[4] = {1, 2, 3, 4};
+    size_t count = 0;
+    ring_buffer_shm_t rb;
+    ring_buffer_shm_t other;
+
+    result = RING_BUFFER_SHM_Create(&rb, NULL, sizeof(uint32_t), 4);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Create(%p, NULL, 4, 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_SHM_AttachFd(&other, rb.fd);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_AttachFd(%p, %d) -> Expected %d, but got %d.", &other,
+                  rb.fd, RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        RING_BUFFER_SHM_Detach(&rb);
+        return failed_assertions;
+    }
+
+    // A geometry rewritten after the attach is ignored, both sides keep the checked one
+    rb.ctrl->max_elements = 1000;
+    rb.ctrl->limit = 2000;
+    rb.ctrl->element_size = 4096;
+    result = RING_BUFFER_SHM_InsertMany(&rb, data, 4, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_InsertMany(%p, ..., 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, count, "Expected %d inserted elements, but got %zu.", 4, count);
+    result = RING_BUFFER_SHM_Insert(&rb, data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_SHM_Insert(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    result = RING_BUFFER_SHM_RetrieveMany(&other, data, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_SHM_RetrieveMany(%p, ..., 2) -> Expected %d, but got %d.", &other,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, count, "Expected %d retrieved elements, but got %zu.", 2, count);
+    ASSERT_EQ_MSG(true, (1 == data[0]) && (2 == data[1]), "Expected 1 and 2, but got %u and %u.", data[0], data[1]);
+
+    // A head claiming more elements than the ring holds, or past the wrap limit, is rejected by the consumer
+    atomic_store(&rb.ctrl->head, 1);
+    result = RING_BUFFER_SHM_RetrieveMany(&other, data, 4, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Retrieve behind a corrupt head -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d retrieved elements, but got %zu.", 0, count);
+    atomic_store(&rb.ctrl->head, 100);
+    result = RING_BUFFER_SHM_GetCount(&other, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Count behind a corrupt head -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    result = RING_BUFFER_SHM_AttachFd(&other, rb.fd);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Attach behind a corrupt head -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+
+    // A tail claiming more elements than the ring holds is rejected by the producer
+    atomic_store(&rb.ctrl->head, 4);
+    atomic_store(&rb.ctrl->tail, 7);
+    result = RING_BUFFER_SHM_InsertMany(&rb, data, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Insert behind a corrupt tail -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d inserted elements, but got %zu.", 0, count);
+
+    // Restored positions work again
+    atomic_store(&rb.ctrl->tail, 2);
+    result = RING_BUFFER_SHM_InsertMany(&rb, data, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_InsertMany(%p, ..., 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, count, "Expected %d inserted elements, but got %zu.", 2, count);
+
+    result = RING_BUFFER_SHM_Detach(&other);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &other,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_SHM_Detach(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_SHM_Detach(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_open_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_invalid_%d.rb", (int)getpid());
+    unlink(path);
+
+    conf.element_size = 0;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Zero element size -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    conf.element_size = sizeof(uint32_t);
+    conf.elements = 0;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Zero elements -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    conf.elements = SIZE_MAX / 8;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "File size wraps around -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    conf.element_size = SIZE_MAX - 4;
+    conf.elements = 1;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Slot size wraps around -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    conf.element_size = sizeof(uint32_t);
+    conf.elements = 8;
+    conf.sync = RING_BUFFER_FILE_SYNC_MAX;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Invalid sync policy -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    conf.path = NULL;
+    conf.sync = RING_BUFFER_FILE_SYNC_BATCH;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "NULL path -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_full_empty_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_wrap_%d.rb", (int)getpid());
+    unlink(path);
+
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    ASSERT_EQ_MSG(RING_BUFFER_FILE_RECOVERY_NEW, rb.recovery, "Expected a new file, but got recovery %d.", rb.recovery);
+
+    result = RING_BUFFER_FILE_Retrieve(&rb, out);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Retrieve from empty -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 8) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(8, count, "Expected %d inserted elements, but got %zu.", 8, count);
+    result = RING_BUFFER_FILE_Insert(&rb, &data[0]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result, "Insert into full -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    // Free five slots, the next batch wraps around the end of the file
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 5, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 5) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(5, count, "Expected %d retrieved elements, but got %zu.", 5, count);
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 5, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 5) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(5, count, "Expected %d inserted elements, but got %zu.", 5, count);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 8) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(8, count, "Expected %d retrieved elements, but got %zu.", 8, count);
+    ASSERT_EQ_MSG(0, memcmp(out, &data[5], 3 * sizeof(uint32_t)), "Expected the elements 5 to 7 first.");
+    ASSERT_EQ_MSG(0, memcmp(&out[3], data, 5 * sizeof(uint32_t)), "Expected the elements 0 to 4 last.");
+
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_recovery_header(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_header_%d.rb", (int)getpid());
+    unlink(path);
+
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 5, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 5) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(5, count, "Expected %d inserted elements, but got %zu.", 5, count);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 2) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(2, count, "Expected %d retrieved elements, but got %zu.", 2, count);
+    ASSERT_EQ_MSG(1, out[1], "Expected %d, but got %u.", 1, out[1]);
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Reopening re-attaches from the header
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        unlink(path);
+        return failed_assertions;
+    }
+    ASSERT_EQ_MSG(RING_BUFFER_FILE_RECOVERY_HEADER, rb.recovery, "Expected recovery %d, but got %d.",
+                  RING_BUFFER_FILE_RECOVERY_HEADER, rb.recovery);
+    result = RING_BUFFER_FILE_GetCount(&rb, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_GetCount(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, count, "Expected %d elements, but got %zu.", 3, count);
+    result = RING_BUFFER_FILE_Retrieve(&rb, out);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Retrieve(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, out[0], "Expected %d, but got %u.", 2, out[0]);
+
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_recovery_torn_header(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_torn_%d.rb", (int)getpid());
+    unlink(path);
+
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 5, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 5) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(5, count, "Expected %d inserted elements, but got %zu.", 5, count);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 2) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(2, count, "Expected %d retrieved elements, but got %zu.", 2, count);
+    result = RING_BUFFER_FILE_Insert(&rb, &data[5]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Insert(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tear the newest header copy, the older one and the slot at its head still give the whole state
+    size_t newest = (size_t)(rb.generation & 1U) * sizeof(ring_buffer_file_header_t);
+    rb.map[newest + offsetof(ring_buffer_file_header_t, head)] ^= 0xFF;
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        unlink(path);
+        return failed_assertions;
+    }
+    ASSERT_EQ_MSG(RING_BUFFER_FILE_RECOVERY_HEADER, rb.recovery, "Expected recovery %d, but got %d.",
+                  RING_BUFFER_FILE_RECOVERY_HEADER, rb.recovery);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 8) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(4, count, "Expected %d retrieved elements, but got %zu.", 4, count);
+    ASSERT_EQ_MSG(0, memcmp(out, &data[2], 4 * sizeof(uint32_t)), "Expected the elements 2 to 5 in order.");
+
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_recovery_scan(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_scan_%d.rb", (int)getpid());
+    unlink(path);
+
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 6, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 6) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(6, count, "Expected %d inserted elements, but got %zu.", 6, count);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(3, count, "Expected %d retrieved elements, but got %zu.", 3, count);
+
+    // Tear both copies, the scan rebuilds the ring from the slots and hands the retrieved elements out again
+    memset(rb.map, 0xFF, 2 * sizeof(ring_buffer_file_header_t));
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        unlink(path);
+        return failed_assertions;
+    }
+    ASSERT_EQ_MSG(RING_BUFFER_FILE_RECOVERY_SCAN, rb.recovery, "Expected recovery %d, but got %d.",
+                  RING_BUFFER_FILE_RECOVERY_SCAN, rb.recovery);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 8) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(6, count, "Expected %d retrieved elements, but got %zu.", 6, count);
+    ASSERT_EQ_MSG(0, memcmp(out, data, 6 * sizeof(uint32_t)), "Expected the elements 0 to 5 in order.");
+
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_open_other_geometry(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_geometry_%d.rb", (int)getpid());
+    unlink(path);
+
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // A file of another geometry is refused
+    conf.elements = 16;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Another geometry -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_retrieve_corrupt_slot(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_corrupt_%d.rb", (int)getpid());
+    unlink(path);
+
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 6, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 6) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(6, count, "Expected %d inserted elements, but got %zu.", 6, count);
+
+    // Flip the first element byte (after the 16 byte slot header) of sequence number 2, its CRC no longer matches
+    size_t data_offset = rb.map_size - rb.slot_size * conf.elements;
+    rb.map[data_offset + 2 * rb.slot_size + 16] ^= 0xFF;
+
+    // The intact elements before the slot are retrieved, the ring ends at the slot
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Retrieve over a corrupt slot -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    ASSERT_EQ_MSG(2, count, "Expected %d retrieved elements, but got %zu.", 2, count);
+    ASSERT_EQ_MSG(0, memcmp(out, data, 2 * sizeof(uint32_t)), "Expected the elements 0 and 1.");
+    result = RING_BUFFER_FILE_GetCount(&rb, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_GetCount(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d elements, but got %zu.", 0, count);
+
+    // The ring keeps working after the corrupt slot was dropped
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, count, "Expected %d inserted elements, but got %zu.", 2, count);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 8) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(2, count, "Expected %d retrieved elements, but got %zu.", 2, count);
+
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_corrupt_slot_scan(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_corrupt_scan_%d.rb", (int)getpid());
+    unlink(path);
+
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_FILE_InsertMany(&rb, data, 6, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_InsertMany(%p, ..., 6) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    // Sequence number 2 is corrupted, the retrieve drops it together with the intact slots 3 to 5 behind it
+    size_t data_offset = rb.map_size - rb.slot_size * conf.elements;
+    rb.map[data_offset + 2 * rb.slot_size + 16] ^= 0xFF;
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Retrieve over a corrupt slot -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    ASSERT_EQ_MSG(2, count, "Expected %d retrieved elements, but got %zu.", 2, count);
+
+    // With both header copies torn the scan finds only the retrieved elements 0 and 1, not the dropped ones
+    memset(rb.map, 0xFF, 2 * sizeof(ring_buffer_file_header_t));
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        unlink(path);
+        return failed_assertions;
+    }
+    ASSERT_EQ_MSG(RING_BUFFER_FILE_RECOVERY_SCAN, rb.recovery, "Expected recovery %d, but got %d.",
+                  RING_BUFFER_FILE_RECOVERY_SCAN, rb.recovery);
+    result = RING_BUFFER_FILE_RetrieveMany(&rb, out, 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_FILE_RetrieveMany(%p, ..., 8) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(2, count, "Expected %d retrieved elements, but got %zu.", 2, count);
+    ASSERT_EQ_MSG(0, memcmp(out, data, 2 * sizeof(uint32_t)), "Expected the elements 0 and 1.");
+
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_file_sync_periodic(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint32_t out[8] = {0};
+    size_t count = 0;
+    ring_buffer_file_t rb;
+    ring_buffer_file_conf_t conf = {
+        .path = path, .element_size = sizeof(uint32_t), .elements = 8, .sync = RING_BUFFER_FILE_SYNC_BATCH};
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_periodic_%d.rb", (int)getpid());
+    unlink(path);
+
+    conf.sync = RING_BUFFER_FILE_SYNC_PERIODIC;
+    result = RING_BUFFER_FILE_Open(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Open(%p, %s) -> Expected %d, but got %d.", &rb, path,
+                  RING_BUFFER_STATUS_OK, result);
+    if (RING_BUFFER_STATUS_OK != result)
+    {
+        return failed_assertions;
+    }
+    result = RING_BUFFER_FILE_Insert(&rb, &data[7]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Periodic insert -> Expected %d, but got %d.", RING_BUFFER_STATUS_OK,
+                  result);
+    result = RING_BUFFER_FILE_Sync(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Sync(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_FILE_Close(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FILE_Close(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    unlink(path);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_drain_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[10];
+    uint32_t data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint32_t out[10] = {0};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Stored elements wrap around the buffer end, one writev sends both regions
+    result = RING_BUFFER_InsertMany(&rb, data, 6, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 6) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(6, count, "Expected %d inserted elements, but got %zu.", 6, count);
+    result = RING_BUFFER_RetrieveMany(&rb, out, 4, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveMany(%p, ..., 4) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(4, count, "Expected %d retrieved elements, but got %zu.", 4, count);
+    result = RING_BUFFER_InsertMany(&rb, &data[6], 4, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, count, "Expected %d inserted elements, but got %zu.", 4, count);
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 2) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, count, "Expected %d inserted elements, but got %zu.", 2, count);
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, %d, 10) -> Expected %d, but got %d.", &rb,
+                  fds[1], RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(8, count, "Expected %d drained elements, but got %zu.", 8, count);
+    ASSERT_EQ_MSG(8 * sizeof(uint32_t), (size_t)read(fds[0], out, sizeof(out)), "Expected 8 elements in the pipe.");
+    ASSERT_EQ_MSG(0, memcmp(out, &data[4], 6 * sizeof(uint32_t)), "Expected the elements 4 to 9 first.");
+    ASSERT_EQ_MSG(0, memcmp(&out[6], data, 2 * sizeof(uint32_t)), "Expected the elements 0 and 1 last.");
+
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Drain of an empty buffer -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_fill_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[10];
+    uint32_t data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint32_t out[10] = {0};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Move the positions so the free space wraps around the buffer end
+    result = RING_BUFFER_InsertMany(&rb, data, 6, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 6) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(6, count, "Expected %d inserted elements, but got %zu.", 6, count);
+    result = RING_BUFFER_RetrieveMany(&rb, out, 6, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveMany(%p, ..., 6) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(6, count, "Expected %d retrieved elements, but got %zu.", 6, count);
+
+    // One readv fills both free regions
+    ASSERT_EQ_MSG(sizeof(data), (size_t)write(fds[1], data, sizeof(data)), "Expected 10 elements in the pipe.");
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(10, count, "Expected %d filled elements, but got %zu.", 10, count);
+    result = RING_BUFFER_RetrieveMany(&rb, out, 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveMany(%p, ..., 10) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(10, count, "Expected %d retrieved elements, but got %zu.", 10, count);
+    ASSERT_EQ_MSG(0, memcmp(out, data, sizeof(data)), "Expected the elements 0 to 9 in order.");
+
+    // An empty non-blocking pipe adds nothing
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d filled elements, but got %zu.", 0, count);
+
+    // A full buffer takes nothing from the descriptor
+    result = RING_BUFFER_InsertMany(&rb, data, 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(10, count, "Expected %d inserted elements, but got %zu.", 10, count);
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result, "Fill of a full buffer -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_fill_partial_element(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[10];
+    uint32_t data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint32_t out[10] = {0};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Only the first byte of the second element arrives, the call returns without waiting for the rest
+    ASSERT_EQ_MSG(5, (size_t)write(fds[1], data, 5), "Expected 5 bytes in the pipe.");
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d filled elements, but got %zu.", 1, count);
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d filled elements, but got %zu.", 0, count);
+
+    // The next call continues the element where the previous one stopped
+    ASSERT_EQ_MSG(7, (size_t)write(fds[1], (const uint8_t *)data + 5, 7), "Expected 7 bytes in the pipe.");
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, count, "Expected %d filled elements, but got %zu.", 2, count);
+    result = RING_BUFFER_RetrieveMany(&rb, out, 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveMany(%p, ..., 10) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(3, count, "Expected %d retrieved elements, but got %zu.", 3, count);
+    ASSERT_EQ_MSG(0, memcmp(out, data, 3 * sizeof(uint32_t)), "Expected the elements 0 to 2 in order.");
+
+    // End of file inside an element adds nothing and is reported as an error, a clean end of file as empty
+    ASSERT_EQ_MSG(2, (size_t)write(fds[1], data, 2), "Expected 2 bytes in the pipe.");
+    close(fds[1]);
+    fds[1] = -1;
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Fill of a torn element -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d filled elements, but got %zu.", 0, count);
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "End of file inside an element -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d filled elements, but got %zu.", 0, count);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_drain_partial_element(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result = RING_BUFFER_STATUS_ERROR;
+    static uint8_t buffer[6000];
+    static uint8_t stream[6000];
+    static uint8_t chunk[6000];
+    size_t streamed = 0;
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3};
+
+    for (size_t i = 0; i < sizeof(stream); i++)
+    {
+        stream[i] = (uint8_t)(i * 7U);
+    }
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(4096, fcntl(fds[1], F_SETPIPE_SZ, 4096), "Expected a 4096 byte pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    ASSERT_EQ_MSG(0, fcntl(fds[1], F_SETFL, O_NONBLOCK), "Expected a non-blocking write end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stream, sizeof(buffer) / 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(sizeof(buffer) / 3, count, "Expected %zu inserted elements, but got %zu.", sizeof(buffer) / 3, count);
+
+    // 4096 bytes are 1365 elements and one byte of the next, the call returns at once instead of waiting for room
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], sizeof(buffer) / 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1365, count, "Expected %d drained elements, but got %zu.", 1365, count);
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], sizeof(buffer) / 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Drain into a full pipe -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d drained elements, but got %zu.", 0, count);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Each call continues the torn element, the stream carries every byte exactly once and in order
+    for (int32_t round = 0; (round < 8) && (streamed < sizeof(stream)); round++)
+    {
+        ssize_t got = read(fds[0], chunk, sizeof(chunk));
+
+        ASSERT_EQ_MSG(true, got > 0, "Expected bytes in the pipe in round %d.", round);
+        if (got <= 0)
+        {
+            break;
+        }
+
+        ASSERT_EQ_MSG(0, memcmp(chunk, &stream[streamed], (size_t)got), "Expected the stream from byte %zu.", streamed);
+        streamed += (size_t)got;
+
+        result = RING_BUFFER_DrainToFd(&rb, fds[1], sizeof(buffer) / 3, &count);
+        ASSERT_EQ_MSG(true, (RING_BUFFER_STATUS_OK == result) || (RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY == result),
+                      "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d or %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                      RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    }
+
+    ASSERT_EQ_MSG(sizeof(stream), streamed, "Expected %zu streamed bytes, but got %zu.", sizeof(stream), streamed);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Drain of an empty buffer -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_drain_error_keeps_element(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static uint8_t buffer[6000];
+    static uint8_t stream[6000];
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3};
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(4096, fcntl(fds[1], F_SETPIPE_SZ, 4096), "Expected a 4096 byte pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    ASSERT_EQ_MSG(0, fcntl(fds[1], F_SETFL, O_NONBLOCK), "Expected a non-blocking write end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stream, sizeof(buffer) / 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(sizeof(buffer) / 3, count, "Expected %zu inserted elements, but got %zu.", sizeof(buffer) / 3, count);
+
+    // 4096 bytes are 1365 elements and one byte of the next, the call returns at once instead of waiting for room
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], sizeof(buffer) / 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1365, count, "Expected %d drained elements, but got %zu.", 1365, count);
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], sizeof(buffer) / 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "Drain into a full pipe -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d drained elements, but got %zu.", 0, count);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // The reader goes away while an element is torn, the error removes nothing and the torn element stays pending
+    signal(SIGPIPE, SIG_IGN);
+    close(fds[0]);
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], sizeof(buffer) / 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "Drain into a closed pipe -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d drained elements, but got %zu.", 0, count);
+    ASSERT_EQ_MSG(1, rb.drain_partial, "Expected %d pending byte, but got %zu.", 1, rb.drain_partial);
+
+    result = RING_BUFFER_GetFreeElements(&rb, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1365, count, "Expected %d free elements, but got %zu.", 1365, count);
+
+    // Clearing the buffer drops the torn element, the next stream starts on an element boundary
+    result = RING_BUFFER_Clear(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Clear(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.drain_partial, "Expected %d pending bytes, but got %zu.", 0, rb.drain_partial);
+
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_drain_partial_retrieve(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static uint8_t buffer[6000];
+    static uint8_t stream[6000];
+    static uint8_t chunk[6000];
+    uint8_t out[3] = {0};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3};
+
+    for (size_t i = 0; i < sizeof(stream); i++)
+    {
+        stream[i] = (uint8_t)(i * 7U);
+    }
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(4096, fcntl(fds[1], F_SETPIPE_SZ, 4096), "Expected a 4096 byte pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    ASSERT_EQ_MSG(0, fcntl(fds[1], F_SETFL, O_NONBLOCK), "Expected a non-blocking write end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_InsertMany(&rb, stream, 2000, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // 4096 bytes are 1365 elements and the first byte of element 1365
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 2000, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1365, count, "Expected %d drained elements, but got %zu.", 1365, count);
+    ASSERT_EQ_MSG(1, rb.drain_partial, "Expected %d pending byte, but got %zu.", 1, rb.drain_partial);
+
+    // Retrieving the torn element hands out all of it and drops the pending offset
+    result = RING_BUFFER_Retrieve(&rb, out);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Retrieve(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, memcmp(out, &stream[1365 * 3], 3), "Expected element %d.", 1365);
+    ASSERT_EQ_MSG(0, rb.drain_partial, "Expected %d pending bytes, but got %zu.", 0, rb.drain_partial);
+
+    // The next drain starts at the beginning of element 1366
+    ASSERT_EQ_MSG(4096, read(fds[0], chunk, sizeof(chunk)), "Expected 4096 bytes in the pipe.");
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 1, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d drained element, but got %zu.", 1, count);
+    ASSERT_EQ_MSG(3, read(fds[0], chunk, sizeof(chunk)), "Expected 3 bytes in the pipe.");
+    ASSERT_EQ_MSG(0, memcmp(chunk, &stream[1366 * 3], 3), "Expected element %d.", 1366);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_drain_partial_evict(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static uint8_t buffer[6000];
+    static uint8_t stream[6000];
+    static uint8_t chunk[6000];
+    uint8_t element[3] = {0xAA, 0xBB, 0xCC};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3, .overwrite = true};
+
+    for (size_t i = 0; i < sizeof(stream); i++)
+    {
+        stream[i] = (uint8_t)(i * 7U);
+    }
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(4096, fcntl(fds[1], F_SETPIPE_SZ, 4096), "Expected a 4096 byte pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    ASSERT_EQ_MSG(0, fcntl(fds[1], F_SETFL, O_NONBLOCK), "Expected a non-blocking write end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_InsertMany(&rb, stream, 2000, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 2000, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1365, count, "Expected %d drained elements, but got %zu.", 1365, count);
+
+    // Filling the free space evicts nothing, the torn element stays pending
+    result = RING_BUFFER_InsertMany(&rb, stream, 1365, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, rb.drain_partial, "Expected %d pending byte, but got %zu.", 1, rb.drain_partial);
+
+    // The next insert evicts the torn element and drops the pending offset
+    result = RING_BUFFER_Insert(&rb, element);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.drain_partial, "Expected %d pending bytes, but got %zu.", 0, rb.drain_partial);
+
+    // The next drain starts at the beginning of the new oldest element 1366
+    ASSERT_EQ_MSG(4096, read(fds[0], chunk, sizeof(chunk)), "Expected 4096 bytes in the pipe.");
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 1, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d drained element, but got %zu.", 1, count);
+    ASSERT_EQ_MSG(3, read(fds[0], chunk, sizeof(chunk)), "Expected 3 bytes in the pipe.");
+    ASSERT_EQ_MSG(0, memcmp(chunk, &stream[1366 * 3], 3), "Expected element %d.", 1366);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_fd_fill_partial_insert(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[10];
+    uint32_t data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint32_t out[10] = {0};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // One element and the first byte of the next one arrive
+    ASSERT_EQ_MSG(5, (size_t)write(fds[1], data, 5), "Expected 5 bytes in the pipe.");
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d filled elements, but got %zu.", 1, count);
+    ASSERT_EQ_MSG(1, rb.fill_partial, "Expected %d pending byte, but got %zu.", 1, rb.fill_partial);
+
+    // Inserting takes the slot of the torn element, the pending byte is dropped
+    result = RING_BUFFER_Insert(&rb, &data[9]);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.fill_partial, "Expected %d pending bytes, but got %zu.", 0, rb.fill_partial);
+
+    // The next fill starts a whole element behind the inserted one
+    ASSERT_EQ_MSG(4, (size_t)write(fds[1], &data[2], 4), "Expected 4 bytes in the pipe.");
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d filled elements, but got %zu.", 1, count);
+    result = RING_BUFFER_RetrieveMany(&rb, out, 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveMany(%p, ..., 10) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(3, count, "Expected %d retrieved elements, but got %zu.", 3, count);
+    ASSERT_EQ_MSG(0, out[0], "Expected %u, but got %u.", 0U, out[0]);
+    ASSERT_EQ_MSG(9, out[1], "Expected %u, but got %u.", 9U, out[1]);
+    ASSERT_EQ_MSG(2, out[2], "Expected %u, but got %u.", 2U, out[2]);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+/**
+ * @brief   Drains ten elements wrapping around the buffer end with writes of 6 bytes that split the elements.
+ */
+static int32_t _aio_drain_wrap(ring_buffer_aio_backend_e backend)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    char path[64];
+    uint32_t buffer[10];
+    uint32_t data[16];
+    uint32_t out[16] = {0};
+    size_t count = 0;
+    ring_buffer_t rb;
+    ring_buffer_aio_t aio;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+    ring_buffer_aio_conf_t aio_conf = {.fd = -1, .offset = 0, .depth = 4, .chunk = 6, .backend = backend};
+
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        data[i] = 0x01010101U * i;
+    }
+
+    snprintf(path, sizeof(path), "/tmp/ring_buffer_ctest_aio_%d_%d", (int)getpid(), (int)backend);
+    aio_conf.fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    ASSERT_EQ_MSG(true, 0 <= aio_conf.fd, "Expected a file descriptor for %s.", path);
+    unlink(path);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Ten stored elements wrapping around the buffer end, the first four retrieved ones are not drained
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 6, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, out, 4, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, &data[6], 8, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        close(aio_conf.fd);
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_AIO_Init(&aio, &rb, aio_conf);
+    if ((RING_BUFFER_AIO_BACKEND_IO_URING == backend) && (RING_BUFFER_STATUS_ERROR == result))
+    {
+        // Kernel without io_uring, the pwrite threads are covered by their own test
+        close(aio_conf.fd);
+        result = RING_BUFFER_DeInit(&rb);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                      RING_BUFFER_STATUS_OK, result);
+
+        return failed_assertions;
+    }
+
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Init(backend %d) -> Expected %d, but got %d.",
+                  backend, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(backend, aio.backend, "Expected backend %d, but got %d.", backend, aio.backend);
+    if (0 != failed_assertions)
+    {
+        close(aio_conf.fd);
+        RING_BUFFER_DeInit(&rb);
+        return failed_assertions;
+    }
+
+    // Writes of 6 bytes split the elements, an element leaves the ring only once it is written completely
+    result = RING_BUFFER_AIO_Submit(&aio, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Submit(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(24, count, "Expected %d submitted bytes, but got %zu.", 24, count);
+    result = RING_BUFFER_AIO_Flush(&aio);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Flush(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_GetFreeElements(&rb, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(10, count, "Expected %d free elements, but got %zu.", 10, count);
+
+    // Elements inserted after a flush continue at the file offset reached
+    result = RING_BUFFER_InsertMany(&rb, &data[14], 2, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_AIO_Flush(&aio);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Flush(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_AIO_GetInFlight(&aio, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_GetInFlight(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d writes in flight, but got %zu.", 0, count);
+    result = RING_BUFFER_AIO_DeInit(&aio);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_DeInit(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+
+    ASSERT_EQ_MSG(12 * sizeof(uint32_t), (size_t)pread(aio_conf.fd, out, sizeof(out), 0),
+                  "Expected 12 elements in the file (backend %d).", backend);
+    ASSERT_EQ_MSG(0, memcmp(out, &data[4], 12 * sizeof(uint32_t)), "Expected the elements 4 to 15 (backend %d).",
+                  backend);
+
+    close(aio_conf.fd);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_aio_drain_io_uring(void)
+{
+    return _aio_drain_wrap(RING_BUFFER_AIO_BACKEND_IO_URING);
+}
+
+static int32_t test_ring_buffer_aio_drain_threads(void)
+{
+    return _aio_drain_wrap(RING_BUFFER_AIO_BACKEND_THREADS);
+}
+
+static int32_t test_ring_buffer_aio_drain_empty(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[4];
+    size_t count = 1;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_aio_t aio;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+    ring_buffer_aio_conf_t aio_conf = {.fd = -1, .backend = RING_BUFFER_AIO_BACKEND_AUTO};
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    aio_conf.fd = fds[1];
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_AIO_Init(&aio, &rb, aio_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Init(%p, ...) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Nothing stored, nothing to submit, wait or release
+    result = RING_BUFFER_AIO_Submit(&aio, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Submit(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d submitted bytes, but got %zu.", 0, count);
+    count = 1;
+    result = RING_BUFFER_AIO_Reap(&aio, true, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Reap(%p, true) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d released elements, but got %zu.", 0, count);
+    result = RING_BUFFER_AIO_Flush(&aio);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Flush(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_AIO_DeInit(&aio);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_DeInit(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // A stopped engine is not initialized any more
+    result = RING_BUFFER_AIO_Submit(&aio, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result,
+                  "RING_BUFFER_AIO_Submit(%p) after DeInit -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_aio_init_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[4];
+    ring_buffer_t rb = {0};
+    ring_buffer_aio_t aio;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+    ring_buffer_aio_conf_t aio_conf = {.fd = STDOUT_FILENO, .backend = RING_BUFFER_AIO_BACKEND_THREADS};
+    ring_buffer_aio_conf_t bad_conf;
+
+    result = RING_BUFFER_AIO_Init(&aio, &rb, aio_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result,
+                  "Ring buffer not initialized -> Expected %d, but got %d.", RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED,
+                  result);
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    bad_conf = aio_conf;
+    bad_conf.fd = -1;
+    result = RING_BUFFER_AIO_Init(&aio, &rb, bad_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Negative fd -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    bad_conf = aio_conf;
+    bad_conf.backend = RING_BUFFER_AIO_BACKEND_MAX;
+    result = RING_BUFFER_AIO_Init(&aio, &rb, bad_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Unknown backend -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    bad_conf = aio_conf;
+    bad_conf.depth = RING_BUFFER_CONF_AIO_DEPTH + 1;
+    result = RING_BUFFER_AIO_Init(&aio, &rb, bad_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Depth over the limit -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    bad_conf = aio_conf;
+    bad_conf.threads = RING_BUFFER_CONF_AIO_THREADS + 1;
+    result = RING_BUFFER_AIO_Init(&aio, &rb, bad_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Threads over the limit -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Evicting elements in flight is not possible
+    conf.overwrite = true;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, overwrite) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_AIO_Init(&aio, &rb, aio_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Overwrite ring buffer -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Skip markers of records are no file content
+    conf.overwrite = false;
+    conf.records = true;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_AIO_Init(&aio, &rb, aio_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Record mode ring buffer -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_aio_write_error(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[4];
+    uint32_t data[3] = {1, 2, 3};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_aio_t aio;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+    ring_buffer_aio_conf_t aio_conf = {.fd = -1, .backend = RING_BUFFER_AIO_BACKEND_THREADS};
+
+    // The read end of a pipe cannot be written
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    aio_conf.fd = fds[0];
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_AIO_Init(&aio, &rb, aio_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_Init(%p, ...) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // A failed write releases nothing, the elements stay stored
+    result = RING_BUFFER_AIO_Flush(&aio);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR, result, "RING_BUFFER_AIO_Flush(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_ERROR, result);
+    result = RING_BUFFER_GetFreeElements(&rb, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d free element, but got %zu.", 1, count);
+
+    result = RING_BUFFER_AIO_DeInit(&aio);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_AIO_DeInit(%p) -> Expected %d, but got %d.", &aio,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_GetFreeElements(&rb, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d free element after DeInit, but got %zu.", 1, count);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_empty(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_Discard(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_Discard(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_DiscardNewest(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_DiscardNewest(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    // Clearing an empty buffer is fine
+    result = RING_BUFFER_Clear(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Clear(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_oldest_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t stored[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[4] = {0};
+    size_t written = 0;
+    size_t read = 0;
+    uint16_t expected[1] = {0x5566};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6 and head at byte 4, so the stored elements wrap around the buffer end
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Tail moves forward across the wrap point
+    result = RING_BUFFER_Discard(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Discard(%p, %d) -> Expected %d, but got %d.", &rb, 2,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, rb.count, "Expected %d, but got %zu.", 1, rb.count);
+    ASSERT_EQ_MSG(2, rb.tail, "Expected %d, but got %zu.", 2, rb.tail);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, read, "Expected %d elements, but got %zu.", 1, read);
+    ASSERT_EQ_MSG(0, memcmp(expected, read_data, 1 * sizeof(uint16_t)), "Expected the remaining elements in order.");
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_newest_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t stored[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[4] = {0};
+    size_t read = 0;
+    uint16_t data[3] = {0x7788, 0x99AA, 0xBBCC};
+    uint16_t expected[4] = {0x1122, 0x7788, 0x99AA, 0xBBCC};
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6 and head at byte 4, so the stored elements wrap around the buffer end
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Head moves back across the wrap point
+    result = RING_BUFFER_DiscardNewest(&rb, 2);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DiscardNewest(%p, %d) -> Expected %d, but got %d.", &rb,
+                  2, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, rb.count, "Expected %d, but got %zu.", 1, rb.count);
+    ASSERT_EQ_MSG(0, rb.head, "Expected %d, but got %zu.", 0, rb.head);
+
+    // The freed space is reused right after the kept element
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, written, "Expected %d, but got %zu.", 3, written);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, read, "Expected %d elements, but got %zu.", 4, read);
+    ASSERT_EQ_MSG(0, memcmp(expected, read_data, 4 * sizeof(uint16_t)), "Expected the remaining elements in order.");
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_more_than_stored(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t stored[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[4] = {0};
+    size_t read = 0;
+    uint16_t data[4] = {0x1122, 0x3344, 0x5566, 0x7788};
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6 and head at byte 4, so the stored elements wrap around the buffer end
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // More than stored drops everything, from either end
+    result = RING_BUFFER_Discard(&rb, 100000);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Discard(%p, %d) -> Expected %d, but got %d.", &rb,
+                  100000, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.count, "Expected %d, but got %zu.", 0, rb.count);
+    ASSERT_EQ_MSG(rb.head, rb.tail, "Expected %zu, but got %zu.", rb.head, rb.tail);
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_DiscardNewest(&rb, 100000);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DiscardNewest(%p, %d) -> Expected %d, but got %d.", &rb,
+                  100000, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.count, "Expected %d, but got %zu.", 0, rb.count);
+    ASSERT_EQ_MSG(rb.tail, rb.head, "Expected %zu, but got %zu.", rb.tail, rb.head);
+
+    // The whole buffer is free again
+    result = RING_BUFFER_InsertMany(&rb, data, 4, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, read, "Expected %d elements, but got %zu.", 4, read);
+    ASSERT_EQ_MSG(0, memcmp(data, read_data, 4 * sizeof(uint16_t)), "Expected the remaining elements in order.");
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_power_of_two(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t stored[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[4] = {0};
+    size_t written = 0;
+    size_t read = 0;
+    uint16_t expected[1] = {0x3344};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t), .power_of_two = true};
+
+    // Power-of-two positions run freely, both ends still move across the wrap point
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6 and head at byte 4, so the stored elements wrap around the buffer end
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_DiscardNewest(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DiscardNewest(%p, %d) -> Expected %d, but got %d.", &rb,
+                  1, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Discard(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Discard(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, read, "Expected %d elements, but got %zu.", 1, read);
+    ASSERT_EQ_MSG(0, memcmp(expected, read_data, 1 * sizeof(uint16_t)), "Expected the remaining elements in order.");
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_clear(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t stored[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[4] = {0};
+    size_t read = 0;
+    uint16_t data[4] = {0x1122, 0x3344, 0x5566, 0x7788};
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6 and head at byte 4, so the stored elements wrap around the buffer end
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, stored, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_Clear(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Clear(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.count, "Expected %d, but got %zu.", 0, rb.count);
+
+    result = RING_BUFFER_InsertMany(&rb, data, 4, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, written, "Expected %d, but got %zu.", 4, written);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, read, "Expected %d elements, but got %zu.", 4, read);
+    ASSERT_EQ_MSG(0, memcmp(data, read_data, 4 * sizeof(uint16_t)), "Expected the remaining elements in order.");
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_record_mode(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[16];
+    char out[16];
+    size_t len = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, "abc", 3);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    // Record mode only supports clearing, dropping bytes would tear a record
+    result = RING_BUFFER_Discard(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_Discard(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_DiscardNewest(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_DiscardNewest(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    result = RING_BUFFER_Clear(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Clear(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveRecord(&rb, out, sizeof(out), &len);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result, "Retrieve after clear -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_partial_drain(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    static uint8_t buffer[6000];
+    static uint8_t stream[6000];
+    static uint8_t chunk[6000];
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = 3};
+
+    for (size_t i = 0; i < sizeof(stream); i++)
+    {
+        stream[i] = (uint8_t)(i * 7U);
+    }
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(4096, fcntl(fds[1], F_SETPIPE_SZ, 4096), "Expected a 4096 byte pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    ASSERT_EQ_MSG(0, fcntl(fds[1], F_SETFL, O_NONBLOCK), "Expected a non-blocking write end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_InsertMany(&rb, stream, 2000, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 2000, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1365, count, "Expected %d drained elements, but got %zu.", 1365, count);
+
+    // Discarding nothing keeps the torn element pending
+    result = RING_BUFFER_Discard(&rb, 0);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Discard(%p, %d) -> Expected %d, but got %d.", &rb, 0,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, rb.drain_partial, "Expected %d pending byte, but got %zu.", 1, rb.drain_partial);
+
+    // Discarding the torn element drops its pending byte
+    result = RING_BUFFER_Discard(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Discard(%p, %d) -> Expected %d, but got %d.", &rb, 1,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.drain_partial, "Expected %d pending bytes, but got %zu.", 0, rb.drain_partial);
+
+    ASSERT_EQ_MSG(4096, read(fds[0], chunk, sizeof(chunk)), "Expected 4096 bytes in the pipe.");
+    result = RING_BUFFER_DrainToFd(&rb, fds[1], 1, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DrainToFd(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d drained element, but got %zu.", 1, count);
+    ASSERT_EQ_MSG(3, read(fds[0], chunk, sizeof(chunk)), "Expected 3 bytes in the pipe.");
+    ASSERT_EQ_MSG(0, memcmp(chunk, &stream[1366 * 3], 3), "Expected element %d.", 1366);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_discard_newest_partial_fill(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint32_t buffer[10];
+    uint32_t data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint32_t out[10] = {0};
+    size_t count = 0;
+    int fds[2];
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint32_t)};
+
+    ASSERT_EQ_MSG(0, pipe(fds), "Expected a pipe.");
+    ASSERT_EQ_MSG(0, fcntl(fds[0], F_SETFL, O_NONBLOCK), "Expected a non-blocking read end.");
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    ASSERT_EQ_MSG(5, (size_t)write(fds[1], data, 5), "Expected 5 bytes in the pipe.");
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d filled elements, but got %zu.", 1, count);
+    ASSERT_EQ_MSG(1, rb.fill_partial, "Expected %d pending byte, but got %zu.", 1, rb.fill_partial);
+
+    // Dropping the newest element moves the head back, the byte read behind it is dropped too
+    result = RING_BUFFER_DiscardNewest(&rb, 1);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DiscardNewest(%p, %d) -> Expected %d, but got %d.", &rb,
+                  1, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, rb.fill_partial, "Expected %d pending bytes, but got %zu.", 0, rb.fill_partial);
+
+    // The next fill starts a whole element at the moved back head
+    ASSERT_EQ_MSG(4, (size_t)write(fds[1], &data[2], 4), "Expected 4 bytes in the pipe.");
+    result = RING_BUFFER_FillFromFd(&rb, fds[0], 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_FillFromFd(%p, ..., 10) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, count, "Expected %d filled elements, but got %zu.", 1, count);
+    result = RING_BUFFER_RetrieveMany(&rb, out, 10, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_RetrieveMany(%p, ..., 10) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_OK,
+                  result);
+    ASSERT_EQ_MSG(1, count, "Expected %d retrieved elements, but got %zu.", 1, count);
+    ASSERT_EQ_MSG(2, out[0], "Expected %u, but got %u.", 2U, out[0]);
+
+    close(fds[0]);
+    close(fds[1]);
+    result = RING_BUFFER_DeInit(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_DeInit(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_peek_range_empty(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[1] = {0x1122};
+    uint16_t read_data[1] = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_PeekRange(&rb, 0, 1, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 0, 1, read_data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_ReplaceRange(&rb, 0, 1, data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_ReplaceRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 0, 1, data,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_peek_range_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[3] = {0};
+    size_t count = 0;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 4, so the middle element is split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 2) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, written, "Expected %d inserted elements, but got %zu.", 3, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_PeekRange(&rb, 0, 3, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.",
+                  &rb, 0, 3, read_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, memcmp(data, read_data, sizeof(data)), "Expected %d, but got %d.", 0,
+                  memcmp(data, read_data, sizeof(data)));
+
+    // The split element alone, and the window after it
+    result = RING_BUFFER_PeekRange(&rb, 1, 1, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.",
+                  &rb, 1, 1, read_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(data[1], read_data[0], "Expected %d, but got %d.", data[1], read_data[0]);
+    result = RING_BUFFER_PeekRange(&rb, 2, 1, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.",
+                  &rb, 2, 1, read_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(data[2], read_data[0], "Expected %d, but got %d.", data[2], read_data[0]);
+
+    // Nothing was removed
+    result = RING_BUFFER_GetFreeElements(&rb, &count);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_GetFreeElements(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, count, "Expected %d free elements, but got %zu.", 0, count);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_peek_range_invalid_index(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t read_data[4] = {0};
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 4, so the middle element is split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 2) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, written, "Expected %d inserted elements, but got %zu.", 3, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_PeekRange(&rb, 1, 3, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 1, 3, read_data,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+    result = RING_BUFFER_PeekRange(&rb, 0, 4, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 0, 4, read_data,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+    result = RING_BUFFER_PeekRange(&rb, 3, 0, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 3, 0, read_data,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+
+    // start + n must not wrap around
+    result = RING_BUFFER_PeekRange(&rb, 1, SIZE_MAX, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "RING_BUFFER_PeekRange(%p, %d, SIZE_MAX, %p) -> Expected %d, but got %d.", &rb, 1, read_data,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_replace_range_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t new_data[2] = {0x99AA, 0xBBCC};
+    uint16_t read_data[3] = {0};
+    size_t read = 0;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 4, so the middle element is split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 2) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, written, "Expected %d inserted elements, but got %zu.", 3, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // The window starts with the split element
+    result = RING_BUFFER_ReplaceRange(&rb, 1, 2, new_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ReplaceRange(%p, %d, %d, %p) -> Expected %d, but got %d.",
+                  &rb, 1, 2, new_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, rb.count, "Expected %d, but got %zu.", 3, rb.count);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, read, "Expected %d, but got %zu.", 3, read);
+    ASSERT_EQ_MSG(0x1122, read_data[0], "Expected %d, but got %d.", 0x1122, read_data[0]);
+    ASSERT_EQ_MSG(new_data[0], read_data[1], "Expected %d, but got %d.", new_data[0], read_data[1]);
+    ASSERT_EQ_MSG(new_data[1], read_data[2], "Expected %d, but got %d.", new_data[1], read_data[2]);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_replace_range_invalid_index(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[3] = {0x1122, 0x3344, 0x5566};
+    uint16_t new_data[2] = {0x99AA, 0xBBCC};
+    uint16_t read_data[3] = {0};
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 4, so the middle element is split at the wrap point
+    result = RING_BUFFER_InsertMany(&rb, data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 2) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 2, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 2) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, written, "Expected %d inserted elements, but got %zu.", 3, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_ReplaceRange(&rb, 2, 2, new_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "RING_BUFFER_ReplaceRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 2, 2, new_data,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+    result = RING_BUFFER_ReplaceRange(&rb, 3, 1, new_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result,
+                  "RING_BUFFER_ReplaceRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 3, 1, new_data,
+                  RING_BUFFER_STATUS_ERROR_INVALID_INDEX, result);
+
+    // A rejected window writes nothing
+    result = RING_BUFFER_PeekRange(&rb, 0, 3, read_data);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.",
+                  &rb, 0, 3, read_data, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, memcmp(data, read_data, sizeof(data)), "Expected the stored elements unchanged.");
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_peek_range_record_mode(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[16];
+    uint8_t window[4] = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .records = true};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertRecord(&rb, "abcd", 4);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertRecord(%p, ..., 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+
+    // Byte windows would cut through record headers
+    result = RING_BUFFER_PeekRange(&rb, 0, 4, window);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_PeekRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 0, 4, window,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_ReplaceRange(&rb, 0, 4, window);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_ReplaceRange(%p, %d, %d, %p) -> Expected %d, but got %d.", &rb, 0, 4, window,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static bool _foreach_sum(const void *element, void *ctx)
+{
+    *(uint32_t *)ctx += *(const uint16_t *)element;
+
+    return true;
+}
+
+static bool _foreach_double(void *element, void *ctx)
+{
+    (void)ctx;
+    *(uint16_t *)element = (uint16_t)(*(uint16_t *)element * 2u);
+
+    return true;
+}
+
+static bool _foreach_stop(void *element, void *ctx)
+{
+    (void)element;
+
+    return (0 != --(*(uint32_t *)ctx));
+}
+
+static bool _foreach_segment(void *elements, size_t n, void *ctx)
+{
+    uint32_t *runs = (uint32_t *)ctx;
+
+    runs[runs[0] + 1] = (uint32_t)n;
+    runs[0]++;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        ((uint16_t *)elements)[i]++;
+    }
+
+    return true;
+}
+
+static bool _foreach_visit_stop(const void *element, void *ctx)
+{
+    (void)element;
+
+    return (0 != --(*(uint32_t *)ctx));
+}
+
+static int32_t test_ring_buffer_foreach_empty(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint32_t sum = 0;
+    uint32_t runs[3] = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_ForEach(&rb, NULL, &sum);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_ForEach(%p, NULL) -> Expected %d, but got %d.", &rb, RING_BUFFER_STATUS_ERROR_INPUT_ARGS,
+                  result);
+    result = RING_BUFFER_ForEach(&rb, _foreach_sum, &sum);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_ForEach(%p, %p, %p) -> Expected %d, but got %d.", &rb, _foreach_sum, &sum,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_MapInPlace(&rb, _foreach_double, NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_MapInPlace(%p, %p, %p) -> Expected %d, but got %d.", &rb, _foreach_double, NULL,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_ForEachSegment(&rb, _foreach_segment, runs);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_ForEachSegment(%p, %p, %p) -> Expected %d, but got %d.", &rb, _foreach_segment, runs,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    ASSERT_EQ_MSG(0, sum + runs[0], "Expected no callback, but got %u.", sum + runs[0]);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_foreach_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t data[4] = {1, 2, 3, 4};
+    uint16_t read_data[4] = {0};
+    uint32_t sum = 0;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6, so the elements 1 to 4 are stored in runs of 1 and 3
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 4, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, written, "Expected %d inserted elements, but got %zu.", 4, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_ForEach(&rb, _foreach_sum, &sum);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ForEach(%p, %p, %p) -> Expected %d, but got %d.", &rb,
+                  _foreach_sum, &sum, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(10, sum, "Expected %d, but got %u.", 10, sum);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_foreach_map_in_place(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t data[4] = {1, 2, 3, 4};
+    uint16_t read_data[4] = {0};
+    size_t read = 0;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6, so the elements 1 to 4 are stored in runs of 1 and 3
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 4, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, written, "Expected %d inserted elements, but got %zu.", 4, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_MapInPlace(&rb, _foreach_double, NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MapInPlace(%p, %p, %p) -> Expected %d, but got %d.",
+                  &rb, _foreach_double, NULL, RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (4 == read) && (2 == read_data[0]) && (4 == read_data[1]) && (6 == read_data[2]) &&
+                            (8 == read_data[3]),
+                  "Expected 2, 4, 6, 8 across the wrap point, but got %zu elements.", read);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_foreach_stop(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t data[4] = {1, 2, 3, 4};
+    uint16_t read_data[4] = {0};
+    size_t read = 0;
+    uint32_t left = 2;
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6, so the elements 1 to 4 are stored in runs of 1 and 3
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 4, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, written, "Expected %d inserted elements, but got %zu.", 4, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Both walks stop after the second element, which lies past the wrap point
+    result = RING_BUFFER_ForEach(&rb, _foreach_visit_stop, &left);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_ForEach(%p, %p, %p) -> Expected %d, but got %d.", &rb,
+                  _foreach_visit_stop, &left, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, left, "Expected %d, but got %u.", 0, left);
+
+    left = 2;
+    result = RING_BUFFER_MapInPlace(&rb, _foreach_stop, &left);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_MapInPlace(%p, %p, %p) -> Expected %d, but got %d.",
+                  &rb, _foreach_stop, &left, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(0, left, "Expected %d, but got %u.", 0, left);
+
+    // Walking removes nothing
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(true, (4 == read) && (1 == read_data[0]) && (4 == read_data[3]),
+                  "Expected the elements 1 to 4, but got %zu elements.", read);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_foreach_segment_wrap(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[8];
+    uint16_t data[4] = {1, 2, 3, 4};
+    uint16_t read_data[4] = {0};
+    size_t read = 0;
+    uint32_t runs[3] = {0};
+    size_t written = 0;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Tail at byte 6, so the elements 1 to 4 are stored in runs of 1 and 3
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 3) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 4, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 4) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(4, written, "Expected %d inserted elements, but got %zu.", 4, written);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_ForEachSegment(&rb, _foreach_segment, runs);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result,
+                  "RING_BUFFER_ForEachSegment(%p, %p, %p) -> Expected %d, but got %d.", &rb, _foreach_segment,
+                  runs, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, runs[0], "Expected %d, but got %u.", 2, runs[0]);
+    ASSERT_EQ_MSG(1, runs[1], "Expected %d, but got %u.", 1, runs[1]);
+    ASSERT_EQ_MSG(3, runs[2], "Expected %d, but got %u.", 3, runs[2]);
+
+    result = RING_BUFFER_RetrieveMany(&rb, read_data, 4, &read);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_RetrieveMany(%p, ..., 4) -> Expected %d, but got %d.",
+                  &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(2, read_data[0], "Expected %d, but got %d.", 2, read_data[0]);
+    ASSERT_EQ_MSG(5, read_data[3], "Expected %d, but got %d.", 5, read_data[3]);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_foreach_split_elements(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    uint8_t buffer[7];
+    uint16_t data[3] = {1, 2, 3};
+    size_t written = 0;
+    uint32_t sum = 0;
+    uint32_t runs[3] = {0};
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {.buffer = buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(uint16_t)};
+
+    // Elements could be split at the wrap point of a 7 byte buffer
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    result = RING_BUFFER_ForEach(&rb, _foreach_sum, &sum);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_ForEach(%p, %p, %p) -> Expected %d, but got %d.", &rb, _foreach_sum, &sum,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_MapInPlace(&rb, _foreach_double, NULL);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_MapInPlace(%p, %p, %p) -> Expected %d, but got %d.", &rb, _foreach_double, NULL,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    result = RING_BUFFER_ForEachSegment(&rb, _foreach_segment, runs);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_ForEachSegment(%p, %p, %p) -> Expected %d, but got %d.", &rb, _foreach_segment, runs,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_init_invalid(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int32_t buffer[4];
+    ring_buffer_t rb = {0};
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(int32_t)};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT32};
+
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result,
+                  "Ring buffer not initialized -> Expected %d, but got %d.", RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED,
+                  result);
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // The element size must match the type
+    stats_conf.type = RING_BUFFER_STATS_TYPE_INT16;
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Type of another size -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+    stats_conf.type = RING_BUFFER_STATS_TYPE_MAX;
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Unknown type -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Elements split at the wrap point cannot be walked in place
+    conf.buffer_size = sizeof(buffer) - 1;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    stats_conf.type = RING_BUFFER_STATS_TYPE_INT32;
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Split elements -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    // Record mode has no elements of a type
+    conf.buffer_size = sizeof(buffer);
+    conf.records = true;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, records) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    stats_conf.type = RING_BUFFER_STATS_TYPE_INT16;
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result, "Record mode -> Expected %d, but got %d.",
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_empty(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int32_t buffer[4];
+    int32_t value;
+    double sum = 1.0;
+    double mean = 0.0;
+    double variance = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int32_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT32, .resum = 100};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_STATS_GetSum(&stats, &sum);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p, %p) -> Expected %d, but got %d.",
+                  &stats, &sum, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, 0.0 == sum, "Expected %f, but got %f.", 0.0, sum);
+    result = RING_BUFFER_STATS_GetMean(&stats, &mean);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_STATS_GetMean(%p, %p) -> Expected %d, but got %d.", &stats, &mean,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &variance);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_STATS_GetVariance(%p, %p) -> Expected %d, but got %d.", &stats, &variance,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_STATS_Retrieve(&stats, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_STATS_Retrieve(%p, %p) -> Expected %d, but got %d.", &stats, &value,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_sliding(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int32_t buffer[4];
+    double got = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int32_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT32, .resum = 100};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Filling up, then the window slides by eviction and holds 7, 8, 9, 10
+    for (int32_t i = 1; i <= 3; i++)
+    {
+        result = RING_BUFFER_STATS_Insert(&stats, &i);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, i, RING_BUFFER_STATUS_OK, result);
+    }
+    ASSERT_EQ_MSG(3, stats.count, "Expected %d, but got %zu.", 3, stats.count);
+    result = RING_BUFFER_STATS_GetSum(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 6.0 - 0.001) && (got < 6.0 + 0.001), "Expected sum %f, but got %f.", 6.0, got);
+    result = RING_BUFFER_STATS_GetMean(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 2.0 - 0.001) && (got < 2.0 + 0.001), "Expected mean %f, but got %f.", 2.0, got);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetVariance(%p) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 2.0 / 3.0 - 0.001) && (got < 2.0 / 3.0 + 0.001), "Expected variance %f, but got %f.",
+                  2.0 / 3.0, got);
+    for (int32_t i = 4; i <= 10; i++)
+    {
+        result = RING_BUFFER_STATS_Insert(&stats, &i);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, i, RING_BUFFER_STATUS_OK, result);
+    }
+    ASSERT_EQ_MSG(4, stats.count, "Expected %d, but got %zu.", 4, stats.count);
+    result = RING_BUFFER_STATS_GetSum(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 34.0 - 0.001) && (got < 34.0 + 0.001), "Expected sum %f, but got %f.", 34.0, got);
+    result = RING_BUFFER_STATS_GetMean(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 8.5 - 0.001) && (got < 8.5 + 0.001), "Expected mean %f, but got %f.", 8.5, got);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetVariance(%p) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 1.25 - 0.001) && (got < 1.25 + 0.001), "Expected variance %f, but got %f.", 1.25, got);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_retrieve(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int32_t buffer[4];
+    int32_t value = 0;
+    double got = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int32_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT32, .resum = 100};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    for (int32_t i = 7; i <= 10; i++)
+    {
+        result = RING_BUFFER_STATS_Insert(&stats, &i);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, i, RING_BUFFER_STATUS_OK, result);
+    }
+
+    // Window holds 8, 9, 10
+    result = RING_BUFFER_STATS_Retrieve(&stats, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Retrieve(%p, %p) -> Expected %d, but got %d.",
+                  &stats, &value, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(7, value, "Expected %d, but got %d.", 7, value);
+    ASSERT_EQ_MSG(3, stats.count, "Expected %d, but got %zu.", 3, stats.count);
+    result = RING_BUFFER_STATS_GetSum(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 27.0 - 0.001) && (got < 27.0 + 0.001), "Expected sum %f, but got %f.", 27.0, got);
+    result = RING_BUFFER_STATS_GetMean(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 9.0 - 0.001) && (got < 9.0 + 0.001), "Expected mean %f, but got %f.", 9.0, got);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetVariance(%p) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 2.0 / 3.0 - 0.001) && (got < 2.0 / 3.0 + 0.001), "Expected variance %f, but got %f.",
+                  2.0 / 3.0, got);
+
+    // Window holds 10 only
+    result = RING_BUFFER_STATS_Retrieve(&stats, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Retrieve(%p, %p) -> Expected %d, but got %d.",
+                  &stats, &value, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Retrieve(&stats, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Retrieve(%p, %p) -> Expected %d, but got %d.",
+                  &stats, &value, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, stats.count, "Expected %d, but got %zu.", 1, stats.count);
+    result = RING_BUFFER_STATS_GetSum(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 10.0 - 0.001) && (got < 10.0 + 0.001), "Expected sum %f, but got %f.", 10.0, got);
+    result = RING_BUFFER_STATS_GetMean(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 10.0 - 0.001) && (got < 10.0 + 0.001), "Expected mean %f, but got %f.", 10.0, got);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetVariance(%p) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 0.0 - 0.001) && (got < 0.0 + 0.001), "Expected variance %f, but got %f.", 0.0, got);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_full(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int32_t buffer[4];
+    int32_t value = 100;
+    double got = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int32_t),
+                               .overwrite = false};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT32, .resum = 100};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    for (int32_t i = 1; i <= 4; i++)
+    {
+        result = RING_BUFFER_STATS_Insert(&stats, &i);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, i, RING_BUFFER_STATUS_OK, result);
+    }
+
+    // Without overwrite a rejected insert leaves the statistics alone
+    result = RING_BUFFER_STATS_Insert(&stats, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result,
+                  "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.", &stats, value,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_FULL, result);
+    ASSERT_EQ_MSG(4, stats.count, "Expected %d, but got %zu.", 4, stats.count);
+    result = RING_BUFFER_STATS_GetSum(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 10.0 - 0.001) && (got < 10.0 + 0.001), "Expected sum %f, but got %f.", 10.0, got);
+    result = RING_BUFFER_STATS_GetMean(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 2.5 - 0.001) && (got < 2.5 + 0.001), "Expected mean %f, but got %f.", 2.5, got);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetVariance(%p) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 1.25 - 0.001) && (got < 1.25 + 0.001), "Expected variance %f, but got %f.", 1.25, got);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_resync(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int32_t buffer[4];
+    int32_t value = -2;
+    double got = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int32_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT32, .resum = 100};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    for (int32_t i = 7; i <= 10; i++)
+    {
+        result = RING_BUFFER_STATS_Insert(&stats, &i);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, i, RING_BUFFER_STATUS_OK, result);
+    }
+
+    // Changes made without the companion are picked up by a re-summation
+    result = RING_BUFFER_Clear(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Clear(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Insert(&rb, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, %d) -> Expected %d, but got %d.", &rb, value,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Resync(&stats);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Resync(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, stats.count, "Expected %d, but got %zu.", 1, stats.count);
+    result = RING_BUFFER_STATS_GetSum(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > -2.0 - 0.001) && (got < -2.0 + 0.001), "Expected sum %f, but got %f.", -2.0, got);
+    result = RING_BUFFER_STATS_GetMean(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > -2.0 - 0.001) && (got < -2.0 + 0.001), "Expected mean %f, but got %f.", -2.0, got);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetVariance(%p) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 0.0 - 0.001) && (got < 0.0 + 0.001), "Expected variance %f, but got %f.", 0.0, got);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_init_stored(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int32_t buffer[4];
+    int32_t data[3] = {4, 5, 9};
+    size_t written = 0;
+    double got = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(int32_t)};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT32};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_InsertMany(&rb, data, 3, &written);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_InsertMany(%p, ..., 3) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // The window starts with the elements already stored
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, stats.count, "Expected %d, but got %zu.", 3, stats.count);
+    result = RING_BUFFER_STATS_GetSum(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetSum(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 18.0 - 0.001) && (got < 18.0 + 0.001), "Expected sum %f, but got %f.", 18.0, got);
+    result = RING_BUFFER_STATS_GetMean(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 6.0 - 0.001) && (got < 6.0 + 0.001), "Expected mean %f, but got %f.", 6.0, got);
+    result = RING_BUFFER_STATS_GetVariance(&stats, &got);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetVariance(%p) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, (got > 14.0 / 3.0 - 0.001) && (got < 14.0 / 3.0 + 0.001), "Expected variance %f, but got %f.",
+                  14.0 / 3.0, got);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_types(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    double doubles[2];
+    float floats[2];
+    int16_t shorts[2];
+    double d = -1.5;
+    float f = 2.25f;
+    int16_t s = -300;
+    double mean = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)doubles, .buffer_size = sizeof(doubles), .element_size = 8};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_DOUBLE};
+
+    // Each type is read with its own width and representation
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, double) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, double) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Insert(&stats, &d);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, double) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_GetMean(&stats, &mean);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, -1.5 == mean, "Expected %f, but got %f.", -1.5, mean);
+
+    conf = (ring_buffer_conf_t){.buffer = (uint8_t *)floats, .buffer_size = sizeof(floats), .element_size = 4};
+    stats_conf.type = RING_BUFFER_STATS_TYPE_FLOAT;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, float) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, float) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Insert(&stats, &f);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, float) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_GetMean(&stats, &mean);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, 2.25 == mean, "Expected %f, but got %f.", 2.25, mean);
+
+    conf = (ring_buffer_conf_t){.buffer = (uint8_t *)shorts, .buffer_size = sizeof(shorts), .element_size = 2};
+    stats_conf.type = RING_BUFFER_STATS_TYPE_INT16;
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, int16) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, int16) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Insert(&stats, &s);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, int16) -> Expected %d, but got %d.",
+                  &stats, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_GetMean(&stats, &mean);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_GetMean(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(1, -300.0 == mean, "Expected %f, but got %f.", -300.0, mean);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_window_not_configured(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int16_t buffer[4];
+    int16_t value = 1;
+    double min = 0.0;
+    double max = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(int16_t)};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT16};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Insert(&stats, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                  &stats, value, RING_BUFFER_STATUS_OK, result);
+
+    // Without deque storage there is no min / max, also with elements stored
+    result = RING_BUFFER_STATS_WindowMin(&stats, &min);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result,
+                  "RING_BUFFER_STATS_WindowMin(%p, %p) -> Expected %d, but got %d.", &stats, &min,
+                  RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result);
+    result = RING_BUFFER_STATS_WindowMax(&stats, &max);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result,
+                  "RING_BUFFER_STATS_WindowMax(%p, %p) -> Expected %d, but got %d.", &stats, &max,
+                  RING_BUFFER_STATUS_ERROR_NOT_INITIALIZED, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_window_storage_too_small(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int16_t buffer[4];
+    ring_buffer_stats_entry_t window[8];
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer, .buffer_size = sizeof(buffer), .element_size = sizeof(int16_t)};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT16,
+                                           .window = window,
+                                           .window_size = RING_BUFFER_STATS_WINDOW_SIZE(4) - 1};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+
+    // Storage for two deques of max_elements candidates is needed
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result,
+                  "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.", &stats, &rb,
+                  RING_BUFFER_STATUS_ERROR_INPUT_ARGS, result);
+
+    stats_conf.window_size = RING_BUFFER_STATS_WINDOW_SIZE(4);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_window_empty(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int16_t buffer[4];
+    ring_buffer_stats_entry_t window[8];
+    double min = 0.0;
+    double max = 0.0;
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int16_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT16,
+                                           .resum = 3,
+                                           .window = window,
+                                           .window_size = RING_BUFFER_STATS_WINDOW_SIZE(4)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    result = RING_BUFFER_STATS_WindowMin(&stats, &min);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_STATS_WindowMin(%p, %p) -> Expected %d, but got %d.", &stats, &min,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+    result = RING_BUFFER_STATS_WindowMax(&stats, &max);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_STATS_WindowMax(%p, %p) -> Expected %d, but got %d.", &stats, &max,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_window_sliding(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int16_t buffer[4];
+    int16_t values[10] = {5, 1, 4, 3, 2, 6, 0, 7, 7, -1};
+    double min = 0.0;
+    double max = 0.0;
+    ring_buffer_stats_entry_t window[8];
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int16_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT16,
+                                           .resum = 3,
+                                           .window = window,
+                                           .window_size = RING_BUFFER_STATS_WINDOW_SIZE(4)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    // Compare against a scan of the last four values (re-summations every 3 updates rebuild the deques)
+    for (size_t i = 0; i < 10; i++)
+    {
+        int16_t expected_min = values[i];
+        int16_t expected_max = values[i];
+
+        for (size_t j = (i >= 3) ? (i - 3) : 0; j < i; j++)
+        {
+            expected_min = (values[j] < expected_min) ? values[j] : expected_min;
+            expected_max = (values[j] > expected_max) ? values[j] : expected_max;
+        }
+
+        result = RING_BUFFER_STATS_Insert(&stats, &values[i]);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, values[i], RING_BUFFER_STATUS_OK, result);
+        result = RING_BUFFER_STATS_WindowMin(&stats, &min);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_WindowMin(%p) -> Expected %d, but got %d.",
+                      &stats, RING_BUFFER_STATUS_OK, result);
+        ASSERT_EQ_MSG(expected_min, (int16_t)min, "Expected min %d, but got %d.", expected_min, (int16_t)min);
+        result = RING_BUFFER_STATS_WindowMax(&stats, &max);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_WindowMax(%p) -> Expected %d, but got %d.",
+                      &stats, RING_BUFFER_STATUS_OK, result);
+        ASSERT_EQ_MSG(expected_max, (int16_t)max, "Expected max %d, but got %d.", expected_max, (int16_t)max);
+    }
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_window_retrieve(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int16_t buffer[4];
+    int16_t values[4] = {0, 7, 7, -1};
+    int16_t value;
+    int16_t expected_max;
+    double max = 0.0;
+    double min = 0.0;
+    ring_buffer_stats_entry_t window[8];
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int16_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT16,
+                                           .resum = 3,
+                                           .window = window,
+                                           .window_size = RING_BUFFER_STATS_WINDOW_SIZE(4)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        result = RING_BUFFER_STATS_Insert(&stats, &values[i]);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, values[i], RING_BUFFER_STATUS_OK, result);
+    }
+
+    // Retrieving shrinks the window from the oldest side, equal maxima leave one at a time
+    for (size_t i = 0; i < 3; i++)
+    {
+        result = RING_BUFFER_STATS_Retrieve(&stats, &value);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Retrieve(%p) -> Expected %d, but got %d.",
+                      &stats, RING_BUFFER_STATUS_OK, result);
+        ASSERT_EQ_MSG(values[i], value, "Expected %d, but got %d.", values[i], value);
+        expected_max = (2 == i) ? -1 : 7;
+        result = RING_BUFFER_STATS_WindowMin(&stats, &min);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_WindowMin(%p) -> Expected %d, but got %d.",
+                      &stats, RING_BUFFER_STATUS_OK, result);
+        ASSERT_EQ_MSG(-1, (int16_t)min, "Expected min %d, but got %d.", -1, (int16_t)min);
+        result = RING_BUFFER_STATS_WindowMax(&stats, &max);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_WindowMax(%p) -> Expected %d, but got %d.",
+                      &stats, RING_BUFFER_STATUS_OK, result);
+        ASSERT_EQ_MSG(expected_max, (int16_t)max, "Expected max %d, but got %d.", expected_max, (int16_t)max);
+    }
+
+    result = RING_BUFFER_STATS_Retrieve(&stats, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Retrieve(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_WindowMax(&stats, &max);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result,
+                  "RING_BUFFER_STATS_WindowMax(%p, %p) -> Expected %d, but got %d.", &stats, &max,
+                  RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, result);
+
+    return failed_assertions;
+}
+
+static int32_t test_ring_buffer_stats_window_resync(void)
+{
+    int32_t failed_assertions = 0;
+
+    ring_buffer_status_e result;
+    int16_t buffer[4];
+    int16_t values[2] = {-5, 9};
+    int16_t value = 3;
+    double min = 0.0;
+    double max = 0.0;
+    ring_buffer_stats_entry_t window[8];
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {.buffer = (uint8_t *)buffer,
+                               .buffer_size = sizeof(buffer),
+                               .element_size = sizeof(int16_t),
+                               .overwrite = true};
+    ring_buffer_stats_conf_t stats_conf = {.type = RING_BUFFER_STATS_TYPE_INT16,
+                                           .resum = 3,
+                                           .window = window,
+                                           .window_size = RING_BUFFER_STATS_WINDOW_SIZE(4)};
+
+    result = RING_BUFFER_Init(&rb, conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Init(%p, ...) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Init(&stats, &rb, stats_conf);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Init(%p, %p, ...) -> Expected %d, but got %d.",
+                  &stats, &rb, RING_BUFFER_STATUS_OK, result);
+    if (0 != failed_assertions)
+    {
+        return failed_assertions;
+    }
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        result = RING_BUFFER_STATS_Insert(&stats, &values[i]);
+        ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Insert(%p, %d) -> Expected %d, but got %d.",
+                      &stats, values[i], RING_BUFFER_STATUS_OK, result);
+    }
+
+    // The deques are rebuilt from the stored elements after changes made without the companion
+    result = RING_BUFFER_Clear(&rb);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Clear(%p) -> Expected %d, but got %d.", &rb,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_Insert(&rb, &value);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_Insert(%p, %d) -> Expected %d, but got %d.", &rb, value,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_Resync(&stats);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_Resync(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    result = RING_BUFFER_STATS_WindowMin(&stats, &min);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_WindowMin(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, (int16_t)min, "Expected min %d, but got %d.", 3, (int16_t)min);
+    result = RING_BUFFER_STATS_WindowMax(&stats, &max);
+    ASSERT_EQ_MSG(RING_BUFFER_STATUS_OK, result, "RING_BUFFER_STATS_WindowMax(%p) -> Expected %d, but got %d.", &stats,
+                  RING_BUFFER_STATUS_OK, result);
+    ASSERT_EQ_MSG(3, (int16_t)max, "Expected max %d, but got %d.", 3, (int16_t)max);
+
+    return failed_assertions;
+}
+
 // --- EOF -------------------------------------------------------------------------------------------------------------
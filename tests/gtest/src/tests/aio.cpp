@@ -0,0 +1,188 @@
+/***********************************************************************************************************************
+ *
+ * @file        aio.cpp
+ * @brief       Test to measure the component drain paths to a file (throughput and producer stall) with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-26
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_aio.h"
+#include "ring_buffer/ring_buffer_lock.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define AIO_ELEMENT_SIZE (64)                  //< Size of one log entry in bytes.
+#define AIO_ELEMENTS     (16384)               //< Capacity of the ring buffer under test (1 MiB).
+#define AIO_BATCH        (64)                  //< Entries inserted by the producer per call.
+#define AIO_TOTAL        (64u * 1024u * 1024u) //< Bytes produced per drain path.
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+/**
+ * @brief   Drain paths under test.
+ */
+typedef enum
+{
+    AIO_PATH_SYNC = 0, /// Draining thread blocks in writev (RING_BUFFER_DrainToFd).
+    AIO_PATH_IO_URING, /// Drain engine with io_uring.
+    AIO_PATH_THREADS,  /// Drain engine with pwrite threads.
+    AIO_PATH_MAX
+} aio_path_e;
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Gets a monotonic timestamp.
+ * @return  Nanoseconds.
+ */
+static uint64_t _now_ns(void)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// --- Aio Tests -------------------------------------------------------------------------------------------------------
+
+TEST(AioTest, DrainThroughputBenchmark)
+{
+    static uint8_t buffer[AIO_ELEMENTS * AIO_ELEMENT_SIZE];
+    static uint8_t batch[AIO_BATCH * AIO_ELEMENT_SIZE];
+    const char *names[AIO_PATH_MAX] = {"sync", "io_uring", "threads"};
+    pthread_mutex_t producer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = AIO_ELEMENT_SIZE,
+        .overwrite = false,
+    };
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&conf.producer_lock, &producer_mutex));
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&conf.consumer_lock, &consumer_mutex));
+
+    printf("%-12s%12s%12s\n", "path", "MB/s", "stall ms");
+
+    for (int path = AIO_PATH_SYNC; path < AIO_PATH_MAX; path++)
+    {
+        char name[] = "/tmp/ring_buffer_aio_XXXXXX";
+        int fd = mkstemp(name);
+        ASSERT_LE(0, fd);
+        unlink(name);
+
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, conf));
+
+        ring_buffer_aio_t aio;
+        ring_buffer_aio_conf_t aio_conf = {};
+        aio_conf.fd = fd;
+        aio_conf.backend =
+            (AIO_PATH_THREADS == path) ? RING_BUFFER_AIO_BACKEND_THREADS : RING_BUFFER_AIO_BACKEND_IO_URING;
+
+        if ((AIO_PATH_SYNC != path) && (RING_BUFFER_STATUS_OK != RING_BUFFER_AIO_Init(&aio, &rb, aio_conf)))
+        {
+            printf("%-12s%12s%12s\n", names[path], "n/a", "n/a");
+            RING_BUFFER_DeInit(&rb);
+            close(fd);
+            continue;
+        }
+
+        std::atomic<bool> produced(false);
+        uint64_t start = _now_ns();
+
+        // Draining thread, blocking writev or submit / reap of the engine
+        std::thread drain([&rb, &aio, &produced, fd, path]() {
+            size_t n;
+
+            while (true)
+            {
+                if (AIO_PATH_SYNC == path)
+                {
+                    if (RING_BUFFER_STATUS_OK == RING_BUFFER_DrainToFd(&rb, fd, AIO_ELEMENTS, &n))
+                    {
+                        continue;
+                    }
+                }
+                else
+                {
+                    size_t in_flight;
+
+                    RING_BUFFER_AIO_Submit(&aio, &n);
+                    RING_BUFFER_AIO_GetInFlight(&aio, &in_flight);
+
+                    if (0 != in_flight)
+                    {
+                        RING_BUFFER_AIO_Reap(&aio, true, &n);
+                        continue;
+                    }
+                }
+
+                if (produced.load() && (RING_BUFFER_STATUS_OK == RING_BUFFER_IsEmpty(&rb)))
+                {
+                    break;
+                }
+
+                sched_yield();
+            }
+        });
+
+        // Producer inserts batches and counts the time it finds the ring buffer full
+        uint64_t stall_ns = 0;
+
+        for (size_t sent = 0; sent < AIO_TOTAL / AIO_ELEMENT_SIZE;)
+        {
+            size_t written;
+
+            if (RING_BUFFER_STATUS_OK == RING_BUFFER_InsertMany(&rb, batch, AIO_BATCH, &written))
+            {
+                sent += written;
+                continue;
+            }
+
+            uint64_t stall_start = _now_ns();
+            while (RING_BUFFER_STATUS_OK != RING_BUFFER_InsertMany(&rb, batch, AIO_BATCH, &written))
+            {
+                sched_yield();
+            }
+            sent += written;
+            stall_ns += _now_ns() - stall_start;
+        }
+
+        produced.store(true);
+        drain.join();
+
+        uint64_t wall_ns = _now_ns() - start;
+
+        if (AIO_PATH_SYNC != path)
+        {
+            RING_BUFFER_AIO_DeInit(&aio);
+        }
+
+        EXPECT_LE((off_t)AIO_TOTAL, lseek(fd, 0, SEEK_END));
+        printf("%-12s%12.1f%12.1f\n", names[path], (double)AIO_TOTAL * 1000.0 / (double)wall_ns,
+               (double)stall_ns / 1e6);
+
+        RING_BUFFER_DeInit(&rb);
+        close(fd);
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
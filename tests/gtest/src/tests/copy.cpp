@@ -0,0 +1,157 @@
+/***********************************************************************************************************************
+ *
+ * @file        copy.cpp
+ * @brief       Test to compare component copy kernels with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-14
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_copy.h"
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+struct copy_kernel_t
+{
+    const char *name;
+    ring_buffer_copy_fn fn;
+};
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+static std::vector<copy_kernel_t> _copy_kernels(void)
+{
+    std::vector<copy_kernel_t> kernels = {
+        {"loop", RING_BUFFER_CopyLoop},
+        {"word", RING_BUFFER_CopyWord},
+        {"libc", RING_BUFFER_CopyLibc},
+    };
+
+#ifdef RING_BUFFER_COPY_X86_64
+    kernels.push_back({"sse2", RING_BUFFER_CopySse2});
+    if (RING_BUFFER_CopyAvx2Supported())
+    {
+        kernels.push_back({"avx2", RING_BUFFER_CopyAvx2});
+    }
+#endif /* RING_BUFFER_COPY_X86_64 */
+
+    kernels.push_back({"auto", RING_BUFFER_CopyAuto});
+
+    return kernels;
+}
+
+// --- Copy Kernel Tests -----------------------------------------------------------------------------------------------
+
+TEST(CopyTest, KernelsCopyAllSizesAndAlignments)
+{
+    uint8_t src[600];
+    uint8_t dst[600];
+
+    for (size_t i = 0; i < sizeof(src); i++)
+    {
+        src[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    RING_BUFFER_CopySelect();
+
+    for (const copy_kernel_t &kernel : _copy_kernels())
+    {
+        for (size_t offset = 0; offset < 8; offset++)
+        {
+            for (size_t len = 0; len <= 520; len++)
+            {
+                memset(dst, 0xEE, sizeof(dst));
+                kernel.fn(dst + offset, src + (offset * 3) % 8, len);
+
+                ASSERT_EQ(0, memcmp(dst + offset, src + (offset * 3) % 8, len)) << kernel.name << " len " << len;
+                ASSERT_EQ(0xEE, dst[offset + len]) << kernel.name << " wrote past len " << len;
+                if (offset > 0)
+                {
+                    ASSERT_EQ(0xEE, dst[offset - 1]) << kernel.name << " wrote before dst, len " << len;
+                }
+            }
+        }
+    }
+}
+
+TEST(CopyTest, SetKernels)
+{
+    uint8_t dst[80];
+
+    for (size_t len = 0; len < 64; len++)
+    {
+        memset(dst, 0, sizeof(dst));
+        RING_BUFFER_SetWord(dst + 3, 0xA5, len);
+        for (size_t i = 0; i < sizeof(dst); i++)
+        {
+            ASSERT_EQ((i >= 3 && i < 3 + len) ? 0xA5 : 0x00, dst[i]) << "len " << len << " byte " << i;
+        }
+
+        memset(dst, 0, sizeof(dst));
+        RING_BUFFER_SetLoop(dst + 3, 0x5A, len);
+        for (size_t i = 0; i < sizeof(dst); i++)
+        {
+            ASSERT_EQ((i >= 3 && i < 3 + len) ? 0x5A : 0x00, dst[i]) << "len " << len << " byte " << i;
+        }
+    }
+}
+
+TEST(CopyTest, KernelBenchmarkByElementSize)
+{
+    static uint8_t src[64 * 1024];
+    static uint8_t dst[64 * 1024 + 512];
+    const size_t element_sizes[] = {8, 16, 64, 128, 256, 512};
+    const size_t bytes_per_run = 64 * 1024 * 1024;
+
+    RING_BUFFER_CopySelect();
+
+    printf("%-6s", "size");
+    for (const copy_kernel_t &kernel : _copy_kernels())
+    {
+        printf("%10s", kernel.name);
+    }
+    printf("   [ns per element]\n");
+
+    for (size_t element_size : element_sizes)
+    {
+        printf("%-6zu", element_size);
+        for (const copy_kernel_t &kernel : _copy_kernels())
+        {
+            size_t elements = bytes_per_run / element_size;
+            size_t pos = 0;
+
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for (size_t i = 0; i < elements; i++)
+            {
+                kernel.fn(dst + pos, src + pos, element_size);
+                pos += element_size;
+                if (pos + element_size > sizeof(src))
+                {
+                    pos = 0;
+                }
+            }
+
+            auto end = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double, std::nano> elapsed = end - start;
+
+            printf("%10.2f", elapsed.count() / (double)elements);
+            ASSERT_EQ(0, memcmp(dst, src, element_size)) << kernel.name;
+        }
+        printf("\n");
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
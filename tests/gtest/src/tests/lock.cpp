@@ -0,0 +1,143 @@
+/***********************************************************************************************************************
+ *
+ * @file        lock.cpp
+ * @brief       Test to measure the component lock hooks (split producer / consumer locks) with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-22
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_lock.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define LOCK_ELEMENTS  (1024)        //< Capacity of the ring buffer under test.
+#define LOCK_TRANSFERS (1024 * 1024) //< Elements moved through the buffer per benchmark step.
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Moves LOCK_TRANSFERS elements through the ring buffer with a number of producer and consumer threads.
+ * @param   rb Ring buffer to use (initialized with lock hooks).
+ * @param   threads Number of producer threads, and the same number of consumer threads.
+ * @param   seen Per-value delivery counters (LOCK_TRANSFERS entries).
+ * @return  Elapsed time in seconds.
+ */
+static double _run(ring_buffer_t *rb, size_t threads, std::vector<std::atomic<uint8_t>> &seen)
+{
+    std::vector<std::thread> workers;
+    std::atomic<uint64_t> consumed(0);
+    const uint64_t per_producer = LOCK_TRANSFERS / threads;
+    const uint64_t total = per_producer * threads;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([rb, t, per_producer]() {
+            for (uint64_t i = t * per_producer; i < (t + 1) * per_producer; i++)
+            {
+                while (RING_BUFFER_STATUS_OK != RING_BUFFER_Insert(rb, &i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        workers.emplace_back([rb, total, &consumed, &seen]() {
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                uint64_t value;
+                if (RING_BUFFER_STATUS_OK == RING_BUFFER_Retrieve(rb, &value))
+                {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    return elapsed.count();
+}
+
+// --- Lock Tests ------------------------------------------------------------------------------------------------------
+
+TEST(LockTest, ContentionBenchmark)
+{
+    static uint64_t buffer[LOCK_ELEMENTS];
+    size_t max_threads = std::max<size_t>(4, std::thread::hardware_concurrency());
+    pthread_mutex_t producer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    ring_buffer_t rb;
+    ring_buffer_conf_t split = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint64_t),
+        .overwrite = false,
+    };
+    ring_buffer_conf_t global = split;
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&split.producer_lock, &producer_mutex));
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&split.consumer_lock, &consumer_mutex));
+
+    // Single global lock for comparison (both hooks on one mutex, valid only without overwrite)
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&global.producer_lock, &producer_mutex));
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&global.consumer_lock, &producer_mutex));
+
+    printf("%-12s%16s%16s\n", "prod x cons", "split M/s", "global M/s");
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::vector<std::atomic<uint8_t>> seen(LOCK_TRANSFERS);
+        std::vector<std::atomic<uint8_t>> global_seen(LOCK_TRANSFERS);
+        uint64_t total = (LOCK_TRANSFERS / threads) * threads;
+
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, split));
+        double elapsed = _run(&rb, threads, seen);
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_IsEmpty(&rb));
+        RING_BUFFER_DeInit(&rb);
+
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, global));
+        double global_elapsed = _run(&rb, threads, global_seen);
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_IsEmpty(&rb));
+        RING_BUFFER_DeInit(&rb);
+
+        printf("%zu x %-8zu%16.2f%16.2f\n", threads, threads, total / elapsed / 1e6, total / global_elapsed / 1e6);
+
+        // Every value is delivered exactly once
+        for (uint64_t i = 0; i < total; i++)
+        {
+            ASSERT_EQ(1, seen[i].load()) << "value " << i << " with " << threads << " threads";
+            ASSERT_EQ(1, global_seen[i].load()) << "value " << i << " with " << threads << " threads";
+        }
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,139 @@
+/***********************************************************************************************************************
+ *
+ * @file        mpmc.cpp
+ * @brief       Test to measure the component lock-free multi-producer / multi-consumer variant with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-20
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer_mpmc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define MPMC_ELEMENTS  (1024)        //< Capacity of the ring buffer under test.
+#define MPMC_TRANSFERS (1024 * 1024) //< Elements moved through the buffer per benchmark step.
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Moves MPMC_TRANSFERS elements through the ring buffer with a number of producer and consumer threads.
+ * @param   rb Ring buffer to use.
+ * @param   threads Number of producer threads, and the same number of consumer threads.
+ * @param   seen Per-value delivery counters (MPMC_TRANSFERS entries).
+ * @return  Elapsed time in seconds.
+ */
+static double _run(ring_buffer_mpmc_t *rb, size_t threads, std::vector<std::atomic<uint8_t>> &seen)
+{
+    std::vector<std::thread> workers;
+    std::atomic<uint64_t> consumed(0);
+    const uint64_t per_producer = MPMC_TRANSFERS / threads;
+    const uint64_t total = per_producer * threads;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([rb, t, per_producer]() {
+            for (uint64_t i = t * per_producer; i < (t + 1) * per_producer; i++)
+            {
+                while (RING_BUFFER_STATUS_OK != RING_BUFFER_MPMC_Insert(rb, &i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        workers.emplace_back([rb, total, &consumed, &seen]() {
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                uint64_t value;
+                if (RING_BUFFER_STATUS_OK == RING_BUFFER_MPMC_Retrieve(rb, &value))
+                {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    return elapsed.count();
+}
+
+// --- MPMC Tests ------------------------------------------------------------------------------------------------------
+
+TEST(MpmcTest, SlotsPaddedToCacheLines)
+{
+    ring_buffer_mpmc_t rb;
+
+    size_t head = (size_t)((uint8_t *)&rb.head - (uint8_t *)&rb);
+    size_t tail = (size_t)((uint8_t *)&rb.tail - (uint8_t *)&rb);
+
+    ASSERT_EQ(0u, RING_BUFFER_MPMC_SLOT_SIZE(1) % RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_EQ(0u, RING_BUFFER_MPMC_SLOT_SIZE(200) % RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_GE(RING_BUFFER_MPMC_SLOT_SIZE(200), sizeof(size_t) + 200);
+    ASSERT_GE(tail - head, (size_t)RING_BUFFER_CONF_CACHE_LINE_SIZE);
+}
+
+TEST(MpmcTest, ScalingBenchmark)
+{
+    alignas(RING_BUFFER_CONF_CACHE_LINE_SIZE) static uint8_t buffer[RING_BUFFER_MPMC_BUFFER_SIZE(8, MPMC_ELEMENTS)];
+    size_t max_threads = std::max<size_t>(4, std::thread::hardware_concurrency());
+    ring_buffer_mpmc_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint64_t),
+        .overwrite = false,
+    };
+
+    printf("%-12s%16s\n", "prod x cons", "M elements/s");
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::vector<std::atomic<uint8_t>> seen(MPMC_TRANSFERS);
+
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_MPMC_Init(&rb, conf));
+        ASSERT_EQ((size_t)MPMC_ELEMENTS, rb.max_elements);
+
+        double elapsed = _run(&rb, threads, seen);
+        uint64_t total = (MPMC_TRANSFERS / threads) * threads;
+
+        printf("%zu x %-8zu%16.2f\n", threads, threads, total / elapsed / 1e6);
+
+        // Every value is delivered exactly once
+        for (uint64_t i = 0; i < total; i++)
+        {
+            ASSERT_EQ(1, seen[i].load()) << "value " << i << " with " << threads << " threads";
+        }
+
+        RING_BUFFER_MPMC_DeInit(&rb);
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,176 @@
+/***********************************************************************************************************************
+ *
+ * @file        mpsc.cpp
+ * @brief       Test to measure the component wait-free multi-producer / single-consumer variant with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-21
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_mpsc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define MPSC_ELEMENTS  (1024)        //< Capacity of the ring buffers under test.
+#define MPSC_TRANSFERS (1024 * 1024) //< Elements moved through the buffer per benchmark step.
+#define MPSC_BATCH     (64)          //< Maximum elements drained by the consumer at once.
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Moves MPSC_TRANSFERS elements from a number of producer threads into the calling consumer thread.
+ * @param   insert Inserts one element, returns false when the buffer is full.
+ * @param   retrieve Retrieves up to MPSC_BATCH elements, returns how many were retrieved.
+ * @param   threads Number of producer threads.
+ * @param   seen Per-value delivery counters (MPSC_TRANSFERS entries).
+ * @return  Elapsed time in seconds.
+ */
+template <typename Insert, typename Retrieve>
+static double _run(Insert insert, Retrieve retrieve, size_t threads, std::vector<uint8_t> &seen)
+{
+    std::vector<std::thread> producers;
+    const uint64_t per_producer = MPSC_TRANSFERS / threads;
+    const uint64_t total = per_producer * threads;
+    uint64_t batch[MPSC_BATCH];
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        producers.emplace_back([&insert, t, per_producer]() {
+            for (uint64_t i = t * per_producer; i < (t + 1) * per_producer; i++)
+            {
+                while (false == insert(i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (uint64_t consumed = 0; consumed < total;)
+    {
+        size_t read = retrieve(batch);
+
+        for (size_t i = 0; i < read; i++)
+        {
+            seen[batch[i]]++;
+        }
+
+        if (0 == read)
+        {
+            std::this_thread::yield();
+        }
+
+        consumed += read;
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    return elapsed.count();
+}
+
+// --- MPSC Tests ------------------------------------------------------------------------------------------------------
+
+TEST(MpscTest, ProducerAndConsumerOnSeparateCacheLines)
+{
+    ring_buffer_mpsc_t rb;
+
+    size_t head = (size_t)((uint8_t *)&rb.head - (uint8_t *)&rb);
+    size_t tail = (size_t)((uint8_t *)&rb.tail - (uint8_t *)&rb);
+
+    ASSERT_EQ(0u, head % RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_EQ(0u, tail % RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_GE(tail - head, (size_t)RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_TRUE(std::atomic<ptrdiff_t>().is_lock_free());
+}
+
+TEST(MpscTest, FanInBenchmark)
+{
+    alignas(RING_BUFFER_CONF_CACHE_LINE_SIZE) static uint8_t buffer[RING_BUFFER_MPSC_BUFFER_SIZE(8, MPSC_ELEMENTS)];
+    static uint64_t locked_buffer[MPSC_ELEMENTS];
+    size_t max_threads = std::max<size_t>(4, std::thread::hardware_concurrency());
+    ring_buffer_mpsc_t rb;
+    ring_buffer_t locked_rb;
+    std::mutex lock;
+    ring_buffer_conf_t conf = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint64_t),
+        .overwrite = false,
+    };
+
+    auto mpsc_insert = [&rb](uint64_t value) { return RING_BUFFER_STATUS_OK == RING_BUFFER_MPSC_Insert(&rb, &value); };
+    auto mpsc_retrieve = [&rb](uint64_t *batch) {
+        size_t read = 0;
+        RING_BUFFER_MPSC_RetrieveMany(&rb, batch, MPSC_BATCH, &read);
+        return read;
+    };
+
+    // Generic ring buffer with every call wrapped in a mutex
+    auto locked_insert = [&locked_rb, &lock](uint64_t value) {
+        std::lock_guard<std::mutex> guard(lock);
+        return RING_BUFFER_STATUS_OK == RING_BUFFER_Insert(&locked_rb, &value);
+    };
+    auto locked_retrieve = [&locked_rb, &lock](uint64_t *batch) {
+        size_t read = 0;
+        std::lock_guard<std::mutex> guard(lock);
+        RING_BUFFER_RetrieveMany(&locked_rb, batch, MPSC_BATCH, &read);
+        return read;
+    };
+
+    printf("%-12s%16s%16s\n", "producers", "mpsc M/s", "mutex M/s");
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::vector<uint8_t> seen(MPSC_TRANSFERS);
+        std::vector<uint8_t> locked_seen(MPSC_TRANSFERS);
+        uint64_t total = (MPSC_TRANSFERS / threads) * threads;
+
+        conf.buffer = buffer;
+        conf.buffer_size = sizeof(buffer);
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_MPSC_Init(&rb, conf));
+        ASSERT_EQ((size_t)MPSC_ELEMENTS, rb.max_elements);
+        conf.buffer = (uint8_t *)locked_buffer;
+        conf.buffer_size = sizeof(locked_buffer);
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&locked_rb, conf));
+
+        double elapsed = _run(mpsc_insert, mpsc_retrieve, threads, seen);
+        double locked_elapsed = _run(locked_insert, locked_retrieve, threads, locked_seen);
+
+        printf("%-12zu%16.2f%16.2f\n", threads, total / elapsed / 1e6, total / locked_elapsed / 1e6);
+
+        // Every value is delivered exactly once
+        for (uint64_t i = 0; i < total; i++)
+        {
+            ASSERT_EQ(1, seen[i]) << "value " << i << " with " << threads << " producers";
+            ASSERT_EQ(1, locked_seen[i]) << "value " << i << " with " << threads << " producers";
+        }
+
+        RING_BUFFER_MPSC_DeInit(&rb);
+        RING_BUFFER_DeInit(&locked_rb);
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
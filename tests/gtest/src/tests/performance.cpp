@@ -15,6 +15,11 @@
 #include <gtest/gtest.h>
 
 #include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_typed.h"
+
+// --- Private Types Prototypes ----------------------------------------------------------------------------------------
+
+RING_BUFFER_DEFINE(perf_u32, uint32_t, 1024 * 1024 / sizeof(uint32_t))
 
 // --- Performance Tests -----------------------------------------------------------------------------------------------
 
@@ -76,4 +81,137 @@ TEST(PerformanceTest, InsertPerformance_1M)
     ASSERT_LT(elapsed.count(), 1.0);
 }
 
+TEST(PerformanceTest, InsertManyPerformance_1M)
+{
+    static char buffer[1024 * 1024];
+    static char data[1024];
+
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint8_t),
+        .overwrite = true,
+    };
+
+    RING_BUFFER_Init(&rb, conf);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < sizeof(buffer) / sizeof(data); i++)
+    {
+        size_t written = 0;
+        RING_BUFFER_InsertMany(&rb, data, sizeof(data), &written);
+        ASSERT_EQ(sizeof(data), written);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    ASSERT_EQ(rb.max_elements, rb.count);
+
+    RING_BUFFER_DeInit(&rb);
+
+    ASSERT_LT(elapsed.count(), 1.0);
+}
+
+TEST(PerformanceTest, RetrieveManyPerformance_1M)
+{
+    static char buffer[1024 * 1024];
+    static char data[1024];
+
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint8_t),
+        .overwrite = true,
+    };
+
+    RING_BUFFER_Init(&rb, conf);
+
+    for (size_t i = 0; i < sizeof(buffer) / sizeof(data); i++)
+    {
+        size_t written = 0;
+        RING_BUFFER_InsertMany(&rb, data, sizeof(data), &written);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < sizeof(buffer) / sizeof(data); i++)
+    {
+        size_t read = 0;
+        RING_BUFFER_RetrieveMany(&rb, data, sizeof(data), &read);
+        ASSERT_EQ(sizeof(data), read);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    ASSERT_EQ(0u, rb.count);
+
+    RING_BUFFER_DeInit(&rb);
+
+    ASSERT_LT(elapsed.count(), 1.0);
+}
+
+TEST(PerformanceTest, InsertPerformance_1M_PowerOfTwo)
+{
+    static uint32_t buffer[1024 * 1024 / sizeof(uint32_t)];
+
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint32_t),
+        .overwrite = true,
+        .power_of_two = true,
+    };
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, conf));
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Two laps, so the second one runs the overwrite path on every insert
+    for (uint32_t i = 0; i < 2 * rb.max_elements; i++)
+    {
+        RING_BUFFER_Insert(&rb, &i);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    uint32_t oldest = 0;
+    RING_BUFFER_Peek(&rb, 0, &oldest);
+    ASSERT_EQ(rb.max_elements, oldest);
+
+    RING_BUFFER_DeInit(&rb);
+
+    ASSERT_LT(elapsed.count(), 1.0);
+}
+
+TEST(PerformanceTest, InsertPerformance_1M_Typed)
+{
+    static perf_u32_t rb;
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, perf_u32_init(&rb, true));
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Two laps, so the second one runs the overwrite path on every insert
+    for (uint32_t i = 0; i < 2 * (uint32_t)(sizeof(rb.items) / sizeof(rb.items[0])); i++)
+    {
+        perf_u32_push(&rb, i);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    uint32_t oldest = 0;
+    perf_u32_peek(&rb, 0, &oldest);
+    ASSERT_EQ(sizeof(rb.items) / sizeof(rb.items[0]), oldest);
+
+    ASSERT_LT(elapsed.count(), 1.0);
+}
+
 // --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,203 @@
+/***********************************************************************************************************************
+ *
+ * @file        spsc.cpp
+ * @brief       Test to measure the component lock-free single-producer / single-consumer variant with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-19
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_spsc.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define SPSC_ELEMENTS   (1024)            //< Capacity of the ring buffers under test.
+#define SPSC_TRANSFERS  (4 * 1024 * 1024) //< Elements moved from the producer to the consumer thread.
+#define SPSC_ROUNDTRIPS (100 * 1000)      //< Ping-pong round trips for the latency test.
+
+// --- SPSC Tests ------------------------------------------------------------------------------------------------------
+
+TEST(SpscTest, IndicesOnSeparateCacheLines)
+{
+    ring_buffer_spsc_t rb;
+
+    size_t producer = (size_t)((uint8_t *)&rb.producer - (uint8_t *)&rb);
+    size_t consumer = (size_t)((uint8_t *)&rb.consumer - (uint8_t *)&rb);
+
+    ASSERT_EQ(0u, producer % RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_EQ(0u, consumer % RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_GE(consumer - producer, (size_t)RING_BUFFER_CONF_CACHE_LINE_SIZE);
+    ASSERT_TRUE(std::atomic<size_t>().is_lock_free());
+}
+
+TEST(SpscTest, TwoThreadThroughput)
+{
+    static uint64_t buffer[SPSC_ELEMENTS];
+    static uint64_t locked_buffer[SPSC_ELEMENTS];
+    ring_buffer_spsc_t rb;
+    ring_buffer_t locked_rb;
+    std::mutex lock;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint64_t),
+        .overwrite = false,
+    };
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_SPSC_Init(&rb, conf));
+    conf.buffer = (uint8_t *)locked_buffer;
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&locked_rb, conf));
+
+    // Lock-free variant
+    uint64_t sum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::thread producer([&rb]() {
+        for (uint64_t i = 0; i < SPSC_TRANSFERS; i++)
+        {
+            while (RING_BUFFER_STATUS_OK != RING_BUFFER_SPSC_Insert(&rb, &i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (uint64_t i = 0; i < SPSC_TRANSFERS; i++)
+    {
+        uint64_t value;
+        while (RING_BUFFER_STATUS_OK != RING_BUFFER_SPSC_Retrieve(&rb, &value))
+        {
+            std::this_thread::yield();
+        }
+        ASSERT_EQ(i, value);
+        sum += value;
+    }
+
+    producer.join();
+    auto middle = std::chrono::high_resolution_clock::now();
+
+    // Generic ring buffer with every call wrapped in a mutex
+    uint64_t locked_sum = 0;
+
+    std::thread locked_producer([&locked_rb, &lock]() {
+        for (uint64_t i = 0; i < SPSC_TRANSFERS; i++)
+        {
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (RING_BUFFER_STATUS_OK == RING_BUFFER_Insert(&locked_rb, &i))
+                    {
+                        break;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (uint64_t i = 0; i < SPSC_TRANSFERS; i++)
+    {
+        uint64_t value;
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                if (RING_BUFFER_STATUS_OK == RING_BUFFER_Retrieve(&locked_rb, &value))
+                {
+                    break;
+                }
+            }
+            std::this_thread::yield();
+        }
+        locked_sum += value;
+    }
+
+    locked_producer.join();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = middle - start;
+    std::chrono::duration<double> locked_elapsed = end - middle;
+
+    printf("spsc    %8.2f M elements/s\n", SPSC_TRANSFERS / elapsed.count() / 1e6);
+    printf("mutex   %8.2f M elements/s\n", SPSC_TRANSFERS / locked_elapsed.count() / 1e6);
+
+    ASSERT_EQ(sum, locked_sum);
+    ASSERT_EQ((uint64_t)SPSC_TRANSFERS * (SPSC_TRANSFERS - 1) / 2, sum);
+
+    RING_BUFFER_SPSC_DeInit(&rb);
+    RING_BUFFER_DeInit(&locked_rb);
+}
+
+TEST(SpscTest, TwoThreadLatency)
+{
+    static uint64_t ping_buffer[SPSC_ELEMENTS];
+    static uint64_t pong_buffer[SPSC_ELEMENTS];
+    ring_buffer_spsc_t ping;
+    ring_buffer_spsc_t pong;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)ping_buffer,
+        .buffer_size = sizeof(ping_buffer),
+        .element_size = sizeof(uint64_t),
+        .overwrite = false,
+    };
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_SPSC_Init(&ping, conf));
+    conf.buffer = (uint8_t *)pong_buffer;
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_SPSC_Init(&pong, conf));
+
+    // Echo thread sends every element straight back, one round trip is two hand-overs between threads
+    std::thread echo([&ping, &pong]() {
+        for (uint64_t i = 0; i < SPSC_ROUNDTRIPS; i++)
+        {
+            uint64_t value;
+            while (RING_BUFFER_STATUS_OK != RING_BUFFER_SPSC_Retrieve(&ping, &value))
+            {
+                std::this_thread::yield();
+            }
+            while (RING_BUFFER_STATUS_OK != RING_BUFFER_SPSC_Insert(&pong, &value))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint64_t i = 0; i < SPSC_ROUNDTRIPS; i++)
+    {
+        uint64_t value;
+        while (RING_BUFFER_STATUS_OK != RING_BUFFER_SPSC_Insert(&ping, &i))
+        {
+            std::this_thread::yield();
+        }
+        while (RING_BUFFER_STATUS_OK != RING_BUFFER_SPSC_Retrieve(&pong, &value))
+        {
+            std::this_thread::yield();
+        }
+        ASSERT_EQ(i, value);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    echo.join();
+
+    std::chrono::duration<double, std::nano> elapsed = end - start;
+    printf("spsc    %8.2f ns per round trip\n", elapsed.count() / SPSC_ROUNDTRIPS);
+
+    RING_BUFFER_SPSC_DeInit(&ping);
+    RING_BUFFER_SPSC_DeInit(&pong);
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,182 @@
+/***********************************************************************************************************************
+ *
+ * @file        stats.cpp
+ * @brief       Test to measure the component sliding-window statistics (cost per sample and accuracy) with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-27
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_stats.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define STATS_WINDOW  (1024)   //< Samples in the sliding window.
+#define STATS_SAMPLES (200000) //< Samples inserted per method.
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Gets a monotonic timestamp.
+ * @return  Nanoseconds.
+ */
+static uint64_t _now_ns(void)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @brief   Generates a sensor-like sample (slow drift, large offset and noise).
+ * @param   i Sample number.
+ * @return  Sample value.
+ */
+static double _sample(uint32_t i)
+{
+    return 1.0e6 + 100.0 * std::sin((double)i * 0.001) + (double)((i * 2654435761u) >> 20) * 1.0e-3;
+}
+
+// --- Stats Tests -----------------------------------------------------------------------------------------------------
+
+TEST(StatsTest, WindowBenchmark)
+{
+    static double buffer[STATS_WINDOW];
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(double),
+        .overwrite = true,
+    };
+    ring_buffer_stats_conf_t stats_conf = {RING_BUFFER_STATS_TYPE_DOUBLE, 0};
+    double mean = 0.0;
+    double variance = 0.0;
+
+    // Recompute mean and variance with a Peek loop on every sample
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, conf));
+
+    uint64_t start = _now_ns();
+    for (uint32_t i = 0; i < STATS_SAMPLES; i++)
+    {
+        double x = _sample(i);
+        double sum = 0.0;
+        double m2 = 0.0;
+        size_t free_elements;
+
+        RING_BUFFER_Insert(&rb, &x);
+        RING_BUFFER_GetFreeElements(&rb, &free_elements);
+        size_t count = STATS_WINDOW - free_elements;
+
+        for (size_t j = 0; j < count; j++)
+        {
+            RING_BUFFER_Peek(&rb, j, &x);
+            sum += x;
+        }
+        mean = sum / (double)count;
+        for (size_t j = 0; j < count; j++)
+        {
+            RING_BUFFER_Peek(&rb, j, &x);
+            m2 += (x - mean) * (x - mean);
+        }
+        variance = m2 / (double)count;
+    }
+    uint64_t scan_ns = _now_ns() - start;
+
+    double scan_mean = mean;
+    double scan_variance = variance;
+
+    // Same window through the companion
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, conf));
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_STATS_Init(&stats, &rb, stats_conf));
+
+    start = _now_ns();
+    for (uint32_t i = 0; i < STATS_SAMPLES; i++)
+    {
+        double x = _sample(i);
+
+        RING_BUFFER_STATS_Insert(&stats, &x);
+        RING_BUFFER_STATS_GetMean(&stats, &mean);
+        RING_BUFFER_STATS_GetVariance(&stats, &variance);
+    }
+    uint64_t stats_ns = _now_ns() - start;
+
+    printf("%-12s%16s%16s\n", "method", "ns / sample", "variance");
+    printf("%-12s%16.1f%16.6f\n", "peek loop", (double)scan_ns / STATS_SAMPLES, scan_variance);
+    printf("%-12s%16.1f%16.6f\n", "companion", (double)stats_ns / STATS_SAMPLES, variance);
+
+    EXPECT_NEAR(scan_mean, mean, 1.0e-6);
+    EXPECT_NEAR(scan_variance, variance, scan_variance * 1.0e-6);
+    EXPECT_LT(stats_ns, scan_ns);
+}
+
+TEST(StatsTest, WindowMinMaxBenchmark)
+{
+    static int16_t buffer[STATS_WINDOW];
+    static ring_buffer_stats_entry_t window[2 * STATS_WINDOW];
+    ring_buffer_t rb;
+    ring_buffer_stats_t stats;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(int16_t),
+        .overwrite = true,
+    };
+    ring_buffer_stats_conf_t stats_conf = {RING_BUFFER_STATS_TYPE_INT16, 0, window, sizeof(window)};
+    uint64_t scan_ns = 0;
+    uint64_t deque_ns = 0;
+    size_t mismatches = 0;
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, conf));
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_STATS_Init(&stats, &rb, stats_conf));
+
+    // Both methods see the same window, the scan runs over the stored elements in place
+    for (uint32_t i = 0; i < STATS_SAMPLES; i++)
+    {
+        int16_t x = (int16_t)((i * 2654435761u) >> 16);
+        double min = 0.0;
+        double max = 0.0;
+
+        uint64_t start = _now_ns();
+        RING_BUFFER_STATS_Insert(&stats, &x);
+        RING_BUFFER_STATS_WindowMin(&stats, &min);
+        RING_BUFFER_STATS_WindowMax(&stats, &max);
+        deque_ns += _now_ns() - start;
+
+        start = _now_ns();
+        int16_t scan_min = INT16_MAX;
+        int16_t scan_max = INT16_MIN;
+        size_t free_elements;
+        RING_BUFFER_GetFreeElements(&rb, &free_elements);
+        for (size_t j = 0; j < STATS_WINDOW - free_elements; j++)
+        {
+            RING_BUFFER_Peek(&rb, j, &x);
+            scan_min = (x < scan_min) ? x : scan_min;
+            scan_max = (x > scan_max) ? x : scan_max;
+        }
+        scan_ns += _now_ns() - start;
+
+        mismatches += ((double)scan_min != min) || ((double)scan_max != max);
+    }
+
+    printf("%-12s%16s\n", "method", "ns / sample");
+    printf("%-12s%16.1f\n", "peek scan", (double)scan_ns / STATS_SAMPLES);
+    printf("%-12s%16.1f\n", "deque", (double)deque_ns / STATS_SAMPLES);
+
+    EXPECT_EQ(0u, mismatches);
+    EXPECT_LT(deque_ns, scan_ns);
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,303 @@
+/***********************************************************************************************************************
+ *
+ * @file        template.cpp
+ * @brief       Test to check the component C++ template against the C API with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-18
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer.hpp"
+
+// --- Compile Time Checks ---------------------------------------------------------------------------------------------
+
+static_assert(bbaskovc::ring_buffer<uint32_t, 8>::power_of_two);
+static_assert(7 == bbaskovc::ring_buffer<uint32_t, 8>::mask);
+static_assert(false == bbaskovc::ring_buffer<uint32_t, 3>::power_of_two);
+static_assert(noexcept(std::declval<bbaskovc::ring_buffer<uint32_t, 8> &>().push(1u)));
+static_assert(noexcept(std::declval<bbaskovc::ring_buffer<uint32_t, 8> &>().try_pop()));
+static_assert(false == noexcept(std::declval<bbaskovc::ring_buffer<std::string, 8> &>().push(
+                                std::declval<const std::string &>())));
+
+// --- Template Tests --------------------------------------------------------------------------------------------------
+
+TEST(TemplateTest, PushPopOrder)
+{
+    bbaskovc::ring_buffer<uint32_t, 4> rb;
+    uint32_t value = 0;
+
+    ASSERT_TRUE(rb.empty());
+    ASSERT_EQ(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, rb.pop(value));
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, rb.push(i));
+    }
+    ASSERT_EQ(3u, rb.size());
+    ASSERT_EQ(1u, rb.free_elements());
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, rb.pop(value));
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_TRUE(rb.empty());
+}
+
+TEST(TemplateTest, FullWithoutOverwrite)
+{
+    bbaskovc::ring_buffer<uint8_t, 3> rb;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, rb.push(i));
+    }
+    ASSERT_TRUE(rb.full());
+    ASSERT_EQ(RING_BUFFER_STATUS_ERROR_BUFFER_FULL, rb.push(0xAA));
+    ASSERT_EQ(0u, rb[0]);
+    ASSERT_EQ(2u, rb[2]);
+}
+
+TEST(TemplateTest, OverwriteEvictsOldest)
+{
+    bbaskovc::ring_buffer<uint16_t, 3, true> rb;
+
+    for (uint16_t i = 0; i < 7; i++)
+    {
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, rb.push(i));
+    }
+    ASSERT_TRUE(rb.full());
+    ASSERT_EQ(4u, rb[0]);
+    ASSERT_EQ(5u, rb[1]);
+    ASSERT_EQ(6u, rb[2]);
+}
+
+TEST(TemplateTest, TryPop)
+{
+    bbaskovc::ring_buffer<uint32_t, 2> rb;
+
+    ASSERT_FALSE(rb.try_pop().has_value());
+
+    rb.push(0xAABBCCDDu);
+    std::optional<uint32_t> value = rb.try_pop();
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(0xAABBCCDDu, *value);
+    ASSERT_FALSE(rb.try_pop().has_value());
+}
+
+TEST(TemplateTest, PeekReplace)
+{
+    bbaskovc::ring_buffer<uint8_t, 10> rb;
+    uint8_t value = 0;
+
+    ASSERT_EQ(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, rb.peek(0, value));
+    ASSERT_EQ(RING_BUFFER_STATUS_ERROR_BUFFER_EMPTY, rb.replace(0, 0xBB));
+
+    for (int i = 0; i < 5; i++)
+    {
+        rb.push(0xAA);
+    }
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, rb.replace(2, 0xBB));
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, rb.peek(2, value));
+    ASSERT_EQ(0xBB, value);
+    ASSERT_EQ(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, rb.peek(5, value));
+    ASSERT_EQ(RING_BUFFER_STATUS_ERROR_INVALID_INDEX, rb.replace(5, 0xBB));
+
+    rb[3] = 0xCC;
+    ASSERT_EQ(0xCC, rb[3]);
+}
+
+TEST(TemplateTest, MoveOnlyElements)
+{
+    bbaskovc::ring_buffer<std::unique_ptr<int>, 2, true> rb;
+
+    rb.push(std::make_unique<int>(1));
+    rb.push(std::make_unique<int>(2));
+    rb.push(std::make_unique<int>(3));
+
+    std::optional<std::unique_ptr<int>> value = rb.try_pop();
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(2, **value);
+    ASSERT_EQ(3, *rb[0]);
+}
+
+TEST(TemplateTest, ThrowingPushKeepsOldest)
+{
+    // Assignment throws on request, like an allocation failure while copying
+    struct element
+    {
+        int value = 0;
+        bool fail = false;
+
+        element &operator=(const element &other)
+        {
+            if (other.fail)
+            {
+                throw std::runtime_error("assignment");
+            }
+            value = other.value;
+            return *this;
+        }
+    };
+
+    bbaskovc::ring_buffer<element, 2, true> rb;
+    element value;
+
+    value.value = 1;
+    rb.push(value);
+    value.value = 2;
+    rb.push(value);
+
+    value.fail = true;
+    ASSERT_THROW(rb.push(value), std::runtime_error);
+    ASSERT_EQ(2u, rb.size());
+    ASSERT_EQ(1, rb[0].value);
+    ASSERT_EQ(2, rb[1].value);
+
+    value.fail = false;
+    value.value = 3;
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, rb.push(value));
+    ASSERT_EQ(2, rb[0].value);
+    ASSERT_EQ(3, rb[1].value);
+}
+
+TEST(TemplateTest, ClearReleasesElements)
+{
+    bbaskovc::ring_buffer<std::shared_ptr<int>, 3> rb;
+    std::shared_ptr<int> value = std::make_shared<int>(1);
+
+    rb.push(value);
+    rb.push(value);
+    ASSERT_EQ(3, value.use_count());
+
+    rb.clear();
+    ASSERT_TRUE(rb.empty());
+    ASSERT_EQ(1, value.use_count());
+
+    rb.push(value);
+    ASSERT_EQ(value, rb[0]);
+}
+
+TEST(TemplateTest, MatchesCApi)
+{
+    uint16_t buffer[5];
+    ring_buffer_t crb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint16_t),
+        .overwrite = true,
+    };
+    bbaskovc::ring_buffer<uint16_t, 5, true> rb;
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&crb, conf));
+
+    // Random sequence of operations must give the same results through both interfaces
+    for (int i = 0; i < 1000; i++)
+    {
+        size_t index = (size_t)(rand() % 6);
+        uint16_t value = (uint16_t)rand();
+        uint16_t cvalue = 0;
+        uint16_t tvalue = 0;
+
+        switch (rand() % 4)
+        {
+            case 0:
+                ASSERT_EQ(RING_BUFFER_Insert(&crb, &value), rb.push(value)) << "step " << i;
+                break;
+            case 1:
+                ASSERT_EQ(RING_BUFFER_Retrieve(&crb, &cvalue), rb.pop(tvalue)) << "step " << i;
+                ASSERT_EQ(cvalue, tvalue) << "step " << i;
+                break;
+            case 2:
+                ASSERT_EQ(RING_BUFFER_Peek(&crb, index, &cvalue), rb.peek(index, tvalue)) << "step " << i;
+                ASSERT_EQ(cvalue, tvalue) << "step " << i;
+                break;
+            default:
+                ASSERT_EQ(RING_BUFFER_Replace(&crb, index, &value), rb.replace(index, value)) << "step " << i;
+                break;
+        }
+
+        ASSERT_EQ(crb.count, rb.size()) << "step " << i;
+    }
+
+    RING_BUFFER_DeInit(&crb);
+}
+
+// --- Template Benchmark ----------------------------------------------------------------------------------------------
+
+TEST(TemplateTest, BenchmarkAgainstCApi)
+{
+    static uint32_t buffer[1024];
+    static bbaskovc::ring_buffer<uint32_t, 1024, true> rb;
+    const uint32_t operations = 16 * 1024 * 1024;
+    uint32_t csum = 0;
+    uint32_t tsum = 0;
+
+    ring_buffer_t crb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint32_t),
+        .overwrite = true,
+        .power_of_two = true,
+    };
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&crb, conf));
+
+    // Keep the buffers half full so both the insert and the retrieve side run on every iteration
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint32_t i = 0; i < operations; i++)
+    {
+        uint32_t value = 0;
+        RING_BUFFER_Insert(&crb, &i);
+        if (i >= 512)
+        {
+            RING_BUFFER_Retrieve(&crb, &value);
+            csum += value;
+        }
+    }
+
+    auto middle = std::chrono::high_resolution_clock::now();
+
+    for (uint32_t i = 0; i < operations; i++)
+    {
+        uint32_t value = 0;
+        rb.push(i);
+        if (i >= 512)
+        {
+            rb.pop(value);
+            tsum += value;
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::nano> celapsed = middle - start;
+    std::chrono::duration<double, std::nano> telapsed = end - middle;
+
+    printf("C API    %8.2f ns per push/pop\n", celapsed.count() / operations);
+    printf("template %8.2f ns per push/pop\n", telapsed.count() / operations);
+
+    RING_BUFFER_DeInit(&crb);
+
+    ASSERT_EQ(csum, tsum);
+    ASSERT_LT(telapsed.count() / 1e9, 1.0);
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------
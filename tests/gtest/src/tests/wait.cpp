@@ -0,0 +1,138 @@
+/***********************************************************************************************************************
+ *
+ * @file        wait.cpp
+ * @brief       Test to measure the component wait strategies (hand-over latency and CPU usage) with googletest.
+ * @author      Blaz Baskovc
+ * @copyright   Copyright 2025 Blaz Baskovc
+ * @date        2025-03-23
+ *
+ **********************************************************************************************************************/
+
+// --- Includes --------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_lock.h"
+
+// --- Private Defines -------------------------------------------------------------------------------------------------
+
+#define WAIT_ELEMENTS (64)   //< Capacity of the ring buffer under test.
+#define WAIT_MESSAGES (2000) //< Messages handed over per strategy.
+#define WAIT_GAP_US   (50)   //< Pause of the producer between messages, so the consumer has to wait for each one.
+#define WAIT_LIMIT_MS (5000) //< Upper bound of a single wait, so a failing side cannot leave the other one stuck.
+
+// --- Private Functions Definitions -----------------------------------------------------------------------------------
+
+/**
+ * @brief   Gets a monotonic timestamp.
+ * @return  Nanoseconds.
+ */
+static uint64_t _now_ns(void)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @brief   Gets the CPU time used by the calling thread.
+ * @return  Nanoseconds.
+ */
+static uint64_t _thread_cpu_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// --- Wait Tests ------------------------------------------------------------------------------------------------------
+
+TEST(WaitTest, StrategyLatencyBenchmark)
+{
+    static uint64_t buffer[WAIT_ELEMENTS];
+    const char *names[RING_BUFFER_WAIT_MAX] = {"park", "spin", "spin-yield", "spin-park"};
+    pthread_mutex_t producer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t consumer_mutex = PTHREAD_MUTEX_INITIALIZER;
+    ring_buffer_t rb;
+    ring_buffer_conf_t conf = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .element_size = sizeof(uint64_t),
+        .overwrite = false,
+    };
+
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&conf.producer_lock, &producer_mutex));
+    ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_LOCK_Pthread(&conf.consumer_lock, &consumer_mutex));
+
+    printf("%-12s%12s%12s%12s%12s\n", "strategy", "p50 ns", "p99 ns", "p99.9 ns", "cpu %");
+
+    for (int strategy = RING_BUFFER_WAIT_PARK; strategy < RING_BUFFER_WAIT_MAX; strategy++)
+    {
+        std::vector<uint64_t> latency(WAIT_MESSAGES);
+        uint64_t cpu_ns = 0;
+        uint64_t wall_ns = 0;
+
+        conf.wait.strategy = (ring_buffer_wait_e)strategy;
+        ASSERT_EQ(RING_BUFFER_STATUS_OK, RING_BUFFER_Init(&rb, conf));
+
+        // Consumer waits for every message, the producer stamps each one right before inserting it
+        std::thread consumer([&rb, &latency, &cpu_ns, &wall_ns]() {
+            uint64_t cpu_start = _thread_cpu_ns();
+            uint64_t wall_start = _now_ns();
+
+            for (size_t i = 0; i < WAIT_MESSAGES; i++)
+            {
+                uint64_t stamp;
+                if (RING_BUFFER_STATUS_OK != RING_BUFFER_RetrieveWait(&rb, &stamp, WAIT_LIMIT_MS))
+                {
+                    break;
+                }
+
+                latency[i] = _now_ns() - stamp;
+            }
+
+            cpu_ns = _thread_cpu_ns() - cpu_start;
+            wall_ns = _now_ns() - wall_start;
+        });
+
+        for (size_t i = 0; i < WAIT_MESSAGES; i++)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(WAIT_GAP_US));
+
+            // A fatal assertion would return with the consumer thread still joinable (std::terminate)
+            uint64_t stamp = _now_ns();
+            ring_buffer_status_e status = RING_BUFFER_InsertWait(&rb, &stamp, WAIT_LIMIT_MS);
+            EXPECT_EQ(RING_BUFFER_STATUS_OK, status);
+            if (RING_BUFFER_STATUS_OK != status)
+            {
+                break;
+            }
+        }
+
+        consumer.join();
+        RING_BUFFER_DeInit(&rb);
+
+        if (HasFailure())
+        {
+            return;
+        }
+
+        std::sort(latency.begin(), latency.end());
+        printf("%-12s%12llu%12llu%12llu%12.1f\n", names[strategy], (unsigned long long)latency[WAIT_MESSAGES / 2],
+               (unsigned long long)latency[WAIT_MESSAGES * 99 / 100],
+               (unsigned long long)latency[WAIT_MESSAGES * 999 / 1000], 100.0 * cpu_ns / wall_ns);
+    }
+}
+
+// --- EOF -------------------------------------------------------------------------------------------------------------